@@ -70,13 +70,6 @@ BEGIN_KEY_TABLE_LIST
   &KEY_TABLE_DEFINITION(all),
 END_KEY_TABLE_LIST
 
-typedef struct {
-  unsigned char hasChanged:1;
-
-  unsigned char force;
-  unsigned char cells[];
-} RowEntry;
-
 typedef BrailleResponseResult ProbeResponseHandler (
   BrailleDisplay *brl,
   const unsigned char *response, size_t size
@@ -99,8 +92,7 @@ struct BrailleDataStruct {
 
   struct {
     TimePeriod retryDelay;
-    RowEntry **rowEntries;
-    unsigned int firstChangedRow;
+    BrailleRows rows;
     unsigned int lastRowSent;
     unsigned char resetCells:1;
   } window;
@@ -286,60 +278,13 @@ writeSimpleCommand (BrailleDisplay *brl, unsigned char command) {
   return writePacket(brl, packet, sizeof(packet));
 }
 
-static RowEntry *
-getRowEntry (BrailleDisplay *brl, unsigned int index) {
-  return brl->data->window.rowEntries[index];
-}
-
-static void
-deallocateRowEntries (BrailleDisplay *brl, unsigned int count) {
-  RowEntry ***rowEntries = &brl->data->window.rowEntries;
-
-  if (*rowEntries) {
-    while (count > 0) free(getRowEntry(brl, --count));
-    free(*rowEntries);
-    *rowEntries = NULL;
-  }
-}
-
-static int
-allocateRowEntries (BrailleDisplay *brl) {
-  RowEntry ***rowEntries = &brl->data->window.rowEntries;
-
-  if (!(*rowEntries = malloc(ARRAY_SIZE(*rowEntries, brl->textRows)))) {
-    logMallocError();
-    return 0;
-  }
-
-  for (unsigned int index=0; index<brl->textRows; index+=1) {
-    RowEntry **row = &(*rowEntries)[index];
-    size_t size = sizeof(**row) + brl->textColumns;
-
-    if (!(*row = malloc(size))) {
-      logMallocError();
-      deallocateRowEntries(brl, (index + 1));
-      return 0;
-    }
-
-    memset(*row, 0, size);
-    (*row)->force = 1;
-  }
-
-  return 1;
-}
-
-static void
-setRowHasChanged (BrailleDisplay *brl, unsigned int index) {
-  getRowEntry(brl, index)->hasChanged = 1;
-
-  if (index < brl->data->window.firstChangedRow) {
-    brl->data->window.firstChangedRow = index;
-  }
-}
-
 static void
 resendRow (BrailleDisplay *brl) {
-  setRowHasChanged(brl, brl->data->window.lastRowSent);
+  BrailleRows *rows = &brl->data->window.rows;
+  unsigned int row = brl->data->window.lastRowSent;
+
+  cancelBrailleRowUpdate(rows, row);
+  setBrailleRowChanged(rows, row);
 }
 
 static int
@@ -350,7 +295,9 @@ refreshAllRows (BrailleDisplay *brl) {
 
 static int
 refreshRow (BrailleDisplay *brl, int row) {
-  return refreshAllRows(brl); // for now
+  if ((row < 0) || (row >= brl->textRows)) return refreshAllRows(brl);
+  setBrailleRowChanged(&brl->data->window.rows, row);
+  return 1;
 }
 
 ASYNC_ALARM_CALLBACK(CN_keysPoller) {
@@ -526,7 +473,7 @@ brl_construct (BrailleDisplay *brl, char **parameters, const char *device) {
     brl->data->response.waiting = 0;
 
     startTimePeriod(&brl->data->window.retryDelay, 0);
-    brl->data->window.rowEntries = NULL;
+    memset(&brl->data->window.rows, 0, sizeof(brl->data->window.rows));
     brl->data->window.resetCells = 0;
 
     brl->data->keys.pressed = 0;
@@ -556,7 +503,7 @@ brl_construct (BrailleDisplay *brl, char **parameters, const char *device) {
                                 writeIdentifyRequest,
                                 readPacket, &response, sizeof(response),
                                 isIdentityResponse)) {
-          if (allocateRowEntries(brl)) {
+          if (allocateBrailleRows(&brl->data->window.rows, brl->textRows, brl->textColumns)) {
             brl->refreshBrailleDisplay = refreshAllRows;
             brl->refreshBrailleRow = refreshRow;
             brl->cellSize = 6;
@@ -568,7 +515,7 @@ brl_construct (BrailleDisplay *brl, char **parameters, const char *device) {
               return 1;
             }
 
-            deallocateRowEntries(brl, brl->textRows);
+            deallocateBrailleRows(&brl->data->window.rows);
           }
         }
 
@@ -591,7 +538,8 @@ brl_destruct (BrailleDisplay *brl) {
   stopKeysPoller(brl);
   disconnectBrailleResource(brl, NULL);
 
-  deallocateRowEntries(brl, brl->textRows);
+  logBrailleRowMetrics(&brl->data->window.rows);
+  deallocateBrailleRows(&brl->data->window.rows);
   crcDestroyGenerator(brl->data->crcGenerator);
 
   free(brl->data);
@@ -600,19 +548,7 @@ brl_destruct (BrailleDisplay *brl) {
 
 static int
 brl_writeWindow (BrailleDisplay *brl, const wchar_t *text) {
-  unsigned int length = brl->textColumns;
-  const unsigned char *cells = brl->buffer;
-
-  for (unsigned int index=0; index<brl->textRows; index+=1) {
-    RowEntry *row = getRowEntry(brl, index);
-
-    if (cellsHaveChanged(row->cells, cells, length, NULL, NULL, &row->force)) {
-      setRowHasChanged(brl, index);
-    }
-
-    cells += length;
-  }
-
+  updateBrailleRows(&brl->data->window.rows, brl->buffer);
   return 1;
 }
 
@@ -620,39 +556,36 @@ static int
 startUpdate (BrailleDisplay *brl) {
   if (!afterTimePeriod(&brl->data->window.retryDelay, NULL)) return 0;
 
+  BrailleRows *rows = &brl->data->window.rows;
+
   if (brl->data->window.resetCells) {
     brl->data->window.resetCells = 0;
-    brl->data->window.firstChangedRow = 0;
-
-    for (unsigned int index=0; index<brl->textRows; index+=1) {
-      getRowEntry(brl, index)->hasChanged = 1;
-    }
+    setBrailleRowsChanged(rows);
 
     writeSimpleCommand(brl, CN_CMD_RESET_CELLS);
     return 1;
   }
 
-  while (brl->data->window.firstChangedRow < brl->textRows) {
-    RowEntry *row = getRowEntry(brl, brl->data->window.firstChangedRow);
+  {
+    unsigned int index;
+    const BrailleRowEntry *row = getChangedBrailleRow(rows, &index);
 
-    if (row->hasChanged) {
+    if (row) {
       unsigned int length = brl->textColumns;
       unsigned char packet[2 + length];
       unsigned char *byte = packet;
 
       *byte++ = CN_CMD_SEND_ROW;
-      *byte++ = brl->data->window.firstChangedRow;
+      *byte++ = index;
       byte = translateOutputCells(byte, row->cells, length);
 
       if (writePacket(brl, packet, (byte - packet))) {
-        row->hasChanged = 0;
-        brl->data->window.lastRowSent = brl->data->window.firstChangedRow++;
+        beginBrailleRowUpdate(rows, index);
+        brl->data->window.lastRowSent = index;
       }
 
       return 1;
     }
-
-    brl->data->window.firstChangedRow += 1;
   }
 
   return 0;
@@ -690,6 +623,12 @@ brl_readCommand (BrailleDisplay *brl, KeyTableCommandContext context) {
 
       case CN_CMD_DEVICE_STATUS:
         brl->data->status.flags = result;
+
+        /* the row has only been refreshed once its motors have stopped */
+        if (!(result & CN_STATUS_MOTORS_ACTIVE)) {
+          endBrailleRowUpdate(&brl->data->window.rows, brl->data->window.lastRowSent);
+        }
+
         continue;
 
       case CN_CMD_SEND_ROW:
@@ -202,46 +202,27 @@ writeBytes (BrailleDisplay *brl, const unsigned char *bytes, size_t count) {
   return writeBraillePacket(brl, NULL, bytes, count);
 }
 
-static BraillePacketVerifierResult
-verifyPacket (
-  BrailleDisplay *brl,
-  unsigned char *bytes, size_t size,
-  size_t *length, void *data
-) {
-  unsigned char byte = bytes[size-1];
-
-  switch (size) {
-    case 1: {
-      switch (byte) {
-        case FA_PKT_SLIDER:
-          *length += 3;
-          break;
-
-        case FA_PKT_NAV:
-          *length += 4;
-          break;
-
-        case FA_PKT_ROUTE:
-          *length += ARRAY_COUNT(brl->data->keys.routing);
-          break;
-
-        default:
-          return BRL_PVR_INVALID;
-      }
-
-      break;
-    }
-
-    default:
-      break;
-  }
+static const BraillePacketDefinition packetDefinitions[] = {
+  { .type = FA_PKT_SLIDER,
+    .length = 4
+  },
+
+  { .type = FA_PKT_NAV,
+    .length = 5
+  },
+
+  { .type = FA_PKT_ROUTE,
+    .length = 1 + (TEXT_CELL_COUNT / 8)
+  },
+};
 
-  return BRL_PVR_INCLUDE;
-}
+static const BraillePacketGrammar packetGrammar = {
+  BRAILLE_PACKET_DEFINITIONS(packetDefinitions)
+};
 
 static size_t
 readPacket (BrailleDisplay *brl, void *packet, size_t size) {
-  return readBraillePacket(brl, NULL, packet, size, verifyPacket, NULL);
+  return readFramedBraillePacket(brl, NULL, packet, size, &packetGrammar, NULL);
 }
 
 static int
@@ -229,69 +229,48 @@ struct BrailleDataStruct {
   unsigned char previousCells[MAXIMUM_CELL_COUNT];
 };
 
-static BraillePacketVerifierResult
-verifyPacket (
+static int
+checkPacket (
   BrailleDisplay *brl,
-  unsigned char *bytes, size_t size,
-  size_t *length, void *data
+  const unsigned char *bytes, size_t size,
+  void *data
 ) {
-  unsigned char byte = bytes[size-1];
-
-  switch (size) {
-    case 1: {
-      switch (byte) {
-        case 0X1C:
-          *length = 4;
-          break;
-
-        case 0XFA:
-          *length = 10;
-          break;
-
-        default:
-          return BRL_PVR_INVALID;
-      }
-
-      break;
+  if (bytes[0] == 0XFA) {
+    const InputPacket *packet = (const void *)bytes;
+    int checksum = -packet->data.checksum;
+    for (size_t i=0; i<size; i+=1) checksum += packet->bytes[i];
+
+    if ((checksum & 0XFF) != packet->data.checksum) {
+      logInputProblem("incorrect input checksum", packet->bytes, size);
+      return 0;
     }
-
-    default:
-      break;
   }
 
-  if (size == *length) {
-    switch (bytes[0]) {
-      case 0X1C: {
-        if (byte != 0X1F) return BRL_PVR_INVALID;
-        break;
-      }
-
-      case 0XFA: {
-        if (byte != 0XFB) return BRL_PVR_INVALID;
-
-        const InputPacket *packet = (const void *)bytes;
-        int checksum = -packet->data.checksum;
-        for (size_t i=0; i<size; i+=1) checksum += packet->bytes[i];
-
-        if ((checksum & 0XFF) != packet->data.checksum) {
-          logInputProblem("incorrect input checksum", packet->bytes, size);
-          return BRL_PVR_INVALID;
-        }
-
-        break;
-      }
+  return 1;
+}
 
-      default:
-        break;
-    }
-  }
+static const BraillePacketDefinition packetDefinitions[] = {
+  { .type = 0X1C,
+    .length = 4,
+    .trailer = 0X1F,
+    .hasTrailer = 1
+  },
+
+  { .type = 0XFA,
+    .length = 10,
+    .trailer = 0XFB,
+    .hasTrailer = 1
+  },
+};
 
-  return BRL_PVR_INCLUDE;
-}
+static const BraillePacketGrammar packetGrammar = {
+  BRAILLE_PACKET_DEFINITIONS(packetDefinitions),
+  .checkPacket = checkPacket
+};
 
 static size_t
 readPacket (BrailleDisplay *brl, InputPacket *packet) {
-  return readBraillePacket(brl, NULL, packet, sizeof(*packet), verifyPacket, NULL);
+  return readFramedBraillePacket(brl, NULL, packet, sizeof(*packet), &packetGrammar, NULL);
 }
 
 static size_t
@@ -80,15 +80,22 @@ writeCells  (BrailleDisplay *brl) {
   static const unsigned char beginSequence[] = {ESC, 'Z', '1'};
   static const unsigned char endSequence[] = {CR};
 
-  unsigned char buffer[sizeof(beginSequence) + sizeof(statusCells) + sizeof(textCells) + sizeof(endSequence)];
-  unsigned char *byte = buffer;
-
-  byte = mempcpy(byte, beginSequence, sizeof(beginSequence));
-  byte = translateOutputCells(byte, statusCells, sizeof(statusCells));
-  byte = translateOutputCells(byte, textCells, sizeof(textCells));
-  byte = mempcpy(byte, endSequence, sizeof(endSequence));
-
-  return writeData(brl, buffer, byte-buffer);
+  static const BrailleCellsEncoding encoding = {
+    .header = beginSequence,
+    .headerLength = sizeof(beginSequence),
+    .trailer = endSequence,
+    .trailerLength = sizeof(endSequence),
+    .statusFirst = 1
+  };
+
+  unsigned char buffer[BRAILLE_CELLS_BUFFER_SIZE(&encoding, sizeof(textCells), sizeof(statusCells))];
+  size_t size = encodeBrailleCells(
+    &encoding, buffer, sizeof(buffer),
+    textCells, sizeof(textCells), 0, sizeof(textCells),
+    statusCells, sizeof(statusCells)
+  );
+
+  return writeData(brl, buffer, size);
 }
 
 static void
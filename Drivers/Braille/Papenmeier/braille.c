@@ -204,71 +204,50 @@ interpretIdentity (BrailleDisplay *brl, unsigned char id, int major, int minor)
 
 /*--- Protocol 1 Operations ---*/
 
-static BraillePacketVerifierResult
-verifyPacket1 (
+static int
+checkPacket1 (
   BrailleDisplay *brl,
-  unsigned char *bytes, size_t size,
-  size_t *length, void *data
+  const unsigned char *bytes, size_t size,
+  void *data
 ) {
-  unsigned char byte = bytes[size-1];
-
-  switch (size) {
-    case 1:
-      *length = 2;
-      if (byte != STX) return BRL_PVR_INVALID;
-      break;
-
-    case 2:
-      switch (byte) {
-        case PM_P1_PKT_IDENTITY:
-          *length = 10;
-          break;
-
-        case PM_P1_PKT_RECEIVE:
-          *length = 6;
-          break;
-
-        case 0X03:
-        case 0X04:
-        case 0X05:
-        case 0X06:
-        case 0X07:
-          *length = 3;
-          break;
-
-        default:
-          return BRL_PVR_INVALID;
-      }
-      break;
-
-    case 6:
-      switch (bytes[1]) {
-        case PM_P1_PKT_RECEIVE:
-          *length = (bytes[4] << 8) | byte;
-          if (*length != 10) return BRL_PVR_INVALID;
-          break;
-
-        default:
-          break;
-      }
+  switch (bytes[1]) {
+    case PM_P1_PKT_RECEIVE:
+      if (((bytes[4] << 8) | bytes[5]) != size) return 0;
       break;
 
     default:
       break;
   }
 
-  if (size == *length) {
-    if (byte != ETX) {
-      return BRL_PVR_INVALID;
-    }
+  return 1;
+}
+
+#define PM_P1_PACKET_DEFINITION(code,size) \
+  { .type = (code), \
+    .length = (size), \
+    .trailer = ETX, \
+    .hasTrailer = 1 \
   }
 
-  return BRL_PVR_INCLUDE;
-}
+static const BraillePacketDefinition packetDefinitions1[] = {
+  PM_P1_PACKET_DEFINITION(PM_P1_PKT_IDENTITY, 10),
+  PM_P1_PACKET_DEFINITION(PM_P1_PKT_RECEIVE, 10),
+  PM_P1_PACKET_DEFINITION(0X03, 3),
+  PM_P1_PACKET_DEFINITION(0X04, 3),
+  PM_P1_PACKET_DEFINITION(0X05, 3),
+  PM_P1_PACKET_DEFINITION(0X06, 3),
+  PM_P1_PACKET_DEFINITION(0X07, 3),
+};
+
+static const BraillePacketGrammar packetGrammar1 = {
+  BRAILLE_PACKET_HEADER(STX),
+  BRAILLE_PACKET_DEFINITIONS(packetDefinitions1),
+  .checkPacket = checkPacket1
+};
 
 static size_t
 readPacket1 (BrailleDisplay *brl, void *packet, size_t size) {
-  return readBraillePacket(brl, NULL, packet, size, verifyPacket1, NULL);
+  return readFramedBraillePacket(brl, NULL, packet, size, &packetGrammar1, NULL);
 }
 
 static int
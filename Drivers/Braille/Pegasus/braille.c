@@ -269,15 +269,22 @@ writeBytes (BrailleDisplay *brl, const unsigned char *buffer, int count) {
 
 static int
 writeCells (BrailleDisplay *brl) {
+  static const BrailleCellsEncoding encoding = {
+    .reverseText = 1,
+    .reverseStatus = 1
+  };
+
   unsigned int textCount = brl->textColumns;
   unsigned int statusCount = brl->statusColumns;
-  unsigned char cells[textCount + statusCount];
-  unsigned char *cell = cells;
+  unsigned char cells[BRAILLE_CELLS_BUFFER_SIZE(&encoding, textCount, statusCount)];
 
-  while (textCount) *cell++ = translateOutputCell(textCells[--textCount]);
-  while (statusCount) *cell++ = translateOutputCell(statusCells[--statusCount]);
+  size_t count = encodeBrailleCells(
+    &encoding, cells, sizeof(cells),
+    textCells, textCount, 0, textCount,
+    statusCells, statusCount
+  );
 
-  return io->methods->writeCells(brl, cells, cell-cells);
+  return io->methods->writeCells(brl, cells, count);
 }
 
 static void
@@ -0,0 +1,206 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "a2_cache.h"
+
+typedef struct CachedObjectEntryStruct CachedObjectEntry;
+
+struct CachedObjectEntryStruct {
+  CachedObjectEntry *next;
+  unsigned int hash;
+
+  char *sender;
+  char *path;
+  CachedObject object;
+};
+
+static struct {
+  CachedObjectEntry **buckets;
+  unsigned int bucketCount;
+  unsigned int entryCount;
+} objectCache;
+
+static unsigned int
+hashObjectIdentity (const char *sender, const char *path) {
+  unsigned int hash = 2166136261U;
+
+  for (const char *byte=sender; *byte; byte+=1) hash = (hash ^ (unsigned char)*byte) * 16777619U;
+  hash = (hash ^ '\n') * 16777619U;
+  for (const char *byte=path; *byte; byte+=1) hash = (hash ^ (unsigned char)*byte) * 16777619U;
+
+  return hash;
+}
+
+static CachedObjectEntry **
+findCachedObjectEntry (const char *sender, const char *path, unsigned int hash) {
+  if (objectCache.bucketCount) {
+    CachedObjectEntry **entry = &objectCache.buckets[hash % objectCache.bucketCount];
+
+    while (*entry) {
+      if (((*entry)->hash == hash) &&
+          (strcmp((*entry)->path, path) == 0) &&
+          (strcmp((*entry)->sender, sender) == 0)) {
+        return entry;
+      }
+
+      entry = &(*entry)->next;
+    }
+  }
+
+  return NULL;
+}
+
+static void
+deallocateCachedObjectEntry (CachedObjectEntry *entry) {
+  free(entry->object.role);
+  free(entry->sender);
+  free(entry->path);
+  free(entry);
+}
+
+static int
+resizeObjectCache (unsigned int bucketCount) {
+  CachedObjectEntry **buckets = calloc(bucketCount, sizeof(*buckets));
+
+  if (!buckets) {
+    logMallocError();
+    return 0;
+  }
+
+  for (unsigned int bucket=0; bucket<objectCache.bucketCount; bucket+=1) {
+    CachedObjectEntry *entry = objectCache.buckets[bucket];
+
+    while (entry) {
+      CachedObjectEntry *next = entry->next;
+      CachedObjectEntry **head = &buckets[entry->hash % bucketCount];
+
+      entry->next = *head;
+      *head = entry;
+      entry = next;
+    }
+  }
+
+  free(objectCache.buckets);
+  objectCache.buckets = buckets;
+  objectCache.bucketCount = bucketCount;
+  return 1;
+}
+
+CachedObject *
+getCachedObject (const char *sender, const char *path, int create) {
+  unsigned int hash = hashObjectIdentity(sender, path);
+
+  {
+    CachedObjectEntry **entry = findCachedObjectEntry(sender, path, hash);
+
+    if (entry) return &(*entry)->object;
+  }
+
+  if (!create) return NULL;
+
+  if (objectCache.entryCount >= objectCache.bucketCount) {
+    if (!resizeObjectCache(objectCache.bucketCount? objectCache.bucketCount<<1: 64)) return NULL;
+  }
+
+  {
+    CachedObjectEntry *entry;
+
+    if ((entry = calloc(1, sizeof(*entry)))) {
+      if ((entry->sender = strdup(sender))) {
+        if ((entry->path = strdup(path))) {
+          CachedObjectEntry **head = &objectCache.buckets[hash % objectCache.bucketCount];
+
+          entry->hash = hash;
+          entry->next = *head;
+          *head = entry;
+          objectCache.entryCount += 1;
+          return &entry->object;
+        }
+
+        free(entry->sender);
+      }
+
+      free(entry);
+    }
+  }
+
+  logMallocError();
+  return NULL;
+}
+
+void
+removeCachedObject (const char *sender, const char *path) {
+  CachedObjectEntry **entry = findCachedObjectEntry(sender, path, hashObjectIdentity(sender, path));
+
+  if (entry) {
+    CachedObjectEntry *removed = *entry;
+
+    *entry = removed->next;
+    deallocateCachedObjectEntry(removed);
+    objectCache.entryCount -= 1;
+  }
+}
+
+void
+clearObjectCache (void) {
+  for (unsigned int bucket=0; bucket<objectCache.bucketCount; bucket+=1) {
+    CachedObjectEntry *entry = objectCache.buckets[bucket];
+
+    while (entry) {
+      CachedObjectEntry *next = entry->next;
+
+      deallocateCachedObjectEntry(entry);
+      entry = next;
+    }
+  }
+
+  free(objectCache.buckets);
+  memset(&objectCache, 0, sizeof(objectCache));
+}
+
+unsigned int
+getObjectCacheSize (void) {
+  return objectCache.entryCount;
+}
+
+int
+setCachedRole (CachedObject *object, const char *role) {
+  char *copy = strdup(role);
+
+  if (!copy) {
+    logMallocError();
+    return 0;
+  }
+
+  free(object->role);
+  object->role = copy;
+  object->haveRole = 1;
+  return 1;
+}
+
+void
+forgetCachedRole (CachedObject *object) {
+  free(object->role);
+  object->role = NULL;
+  object->haveRole = 0;
+}
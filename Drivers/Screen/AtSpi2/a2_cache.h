@@ -0,0 +1,57 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_A2_CACHE
+#define BRLTTY_INCLUDED_A2_CACHE
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* What is known about an accessible object, keyed by (sender, path). Each
+ * property is only meaningful when its have flag is set, and is dropped when
+ * an event says that it has changed.
+ */
+
+typedef struct {
+  char *role;
+  uint32_t states[2];
+  unsigned char hasTextInterface;
+
+  unsigned char haveRole:1;
+  unsigned char haveStates:1;
+  unsigned char haveInterfaces:1;
+
+  unsigned int searchGeneration;
+} CachedObject;
+
+extern CachedObject *getCachedObject (const char *sender, const char *path, int create);
+extern void removeCachedObject (const char *sender, const char *path);
+extern void clearObjectCache (void);
+extern unsigned int getObjectCacheSize (void);
+
+extern int setCachedRole (CachedObject *object, const char *role);
+extern void forgetCachedRole (CachedObject *object);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_A2_CACHE */
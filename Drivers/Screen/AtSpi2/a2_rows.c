@@ -0,0 +1,513 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+#include <wchar.h>
+
+#include "log.h"
+#include "a2_rows.h"
+
+#define TEXT_ROW_CHUNK_SIZE 64
+
+typedef struct TextRowChunkStruct TextRowChunk;
+
+/* The chunks are the nodes of a treap which is ordered by chunk position and
+ * heap ordered by priority. Each node has the totals for its subtree so that
+ * rows and text positions can be found, and counts changed, along one path.
+ */
+struct TextRowChunkStruct {
+  TextRowChunk *parent;
+  TextRowChunk *left;
+  TextRowChunk *right;
+  uint32_t priority;
+
+  struct {
+    unsigned int chunkCount;
+    long rowCount;
+    long characterCount;
+  } subtree;
+
+  long characterCount;
+  unsigned int rowCount;
+  TextRow rows[TEXT_ROW_CHUNK_SIZE];
+};
+
+static struct {
+  TextRowChunk *root;
+  uint32_t priority;
+
+  long rowCount;
+  long characterCount;
+} textRows;
+
+static inline unsigned int
+getSubtreeChunkCount (const TextRowChunk *chunk) {
+  return chunk? chunk->subtree.chunkCount: 0;
+}
+
+static inline long
+getSubtreeRowCount (const TextRowChunk *chunk) {
+  return chunk? chunk->subtree.rowCount: 0;
+}
+
+static inline long
+getSubtreeCharacterCount (const TextRowChunk *chunk) {
+  return chunk? chunk->subtree.characterCount: 0;
+}
+
+static uint32_t
+makeChunkPriority (void) {
+  uint32_t *priority = &textRows.priority;
+
+  if (!*priority) *priority = 0X9E3779B9;
+  *priority ^= *priority << 13;
+  *priority ^= *priority >> 17;
+  *priority ^= *priority << 5;
+  return *priority;
+}
+
+static void
+setSubtreeTotals (TextRowChunk *chunk) {
+  chunk->subtree.chunkCount = 1;
+  chunk->subtree.rowCount = chunk->rowCount;
+  chunk->subtree.characterCount = chunk->characterCount;
+
+  TextRowChunk *children[] = {chunk->left, chunk->right};
+
+  for (unsigned int index=0; index<ARRAY_COUNT(children); index+=1) {
+    TextRowChunk *child = children[index];
+
+    if (child) {
+      chunk->subtree.chunkCount += child->subtree.chunkCount;
+      chunk->subtree.rowCount += child->subtree.rowCount;
+      chunk->subtree.characterCount += child->subtree.characterCount;
+      child->parent = chunk;
+    }
+  }
+}
+
+static TextRowChunk *
+joinTextRowChunks (TextRowChunk *left, TextRowChunk *right) {
+  if (!left) return right;
+  if (!right) return left;
+
+  if (left->priority > right->priority) {
+    left->right = joinTextRowChunks(left->right, right);
+    setSubtreeTotals(left);
+    return left;
+  } else {
+    right->left = joinTextRowChunks(left, right->left);
+    setSubtreeTotals(right);
+    return right;
+  }
+}
+
+/* The first count chunks go to the left and the rest go to the right. */
+static void
+splitTextRowChunks (TextRowChunk *chunk, unsigned int count, TextRowChunk **left, TextRowChunk **right) {
+  if (!chunk) {
+    *left = *right = NULL;
+    return;
+  }
+
+  unsigned int leftCount = getSubtreeChunkCount(chunk->left);
+
+  if (count <= leftCount) {
+    splitTextRowChunks(chunk->left, count, left, &chunk->left);
+    setSubtreeTotals(chunk);
+    *right = chunk;
+  } else {
+    splitTextRowChunks(chunk->right, count-leftCount-1, &chunk->right, right);
+    setSubtreeTotals(chunk);
+    *left = chunk;
+  }
+}
+
+static void
+setTextRowChunks (TextRowChunk *root) {
+  if (root) root->parent = NULL;
+  textRows.root = root;
+}
+
+/* Only the chunk and the chunks above it need to be updated. */
+static void
+adjustTextRowChunk (TextRowChunk *chunk, long rows, long characters) {
+  chunk->rowCount += rows;
+  chunk->characterCount += characters;
+
+  textRows.rowCount += rows;
+  textRows.characterCount += characters;
+
+  while (chunk) {
+    chunk->subtree.rowCount += rows;
+    chunk->subtree.characterCount += characters;
+    chunk = chunk->parent;
+  }
+}
+
+static TextRowChunk *
+getTextRowChunk (unsigned int number) {
+  TextRowChunk *chunk = textRows.root;
+
+  while (chunk) {
+    unsigned int leftCount = getSubtreeChunkCount(chunk->left);
+
+    if (number < leftCount) {
+      chunk = chunk->left;
+    } else if (number == leftCount) {
+      break;
+    } else {
+      number -= leftCount + 1;
+      chunk = chunk->right;
+    }
+  }
+
+  return chunk;
+}
+
+static TextRowChunk *
+insertTextRowChunk (unsigned int number) {
+  TextRowChunk *newChunk;
+
+  if (!(newChunk = calloc(1, sizeof(*newChunk)))) {
+    logMallocError();
+    return NULL;
+  }
+
+  newChunk->priority = makeChunkPriority();
+  setSubtreeTotals(newChunk);
+
+  {
+    TextRowChunk *left;
+    TextRowChunk *right;
+
+    splitTextRowChunks(textRows.root, number, &left, &right);
+    setTextRowChunks(joinTextRowChunks(joinTextRowChunks(left, newChunk), right));
+  }
+
+  return newChunk;
+}
+
+/* The chunk must already be empty. */
+static void
+removeTextRowChunk (unsigned int number) {
+  TextRowChunk *left;
+  TextRowChunk *middle;
+  TextRowChunk *right;
+
+  splitTextRowChunks(textRows.root, number, &left, &right);
+  splitTextRowChunks(right, 1, &middle, &right);
+  free(middle);
+  setTextRowChunks(joinTextRowChunks(left, right));
+}
+
+static void
+moveTextRows (TextRowChunk *to, unsigned int index, TextRowChunk *from, unsigned int first, unsigned int count) {
+  long length = 0;
+
+  for (unsigned int row=first; row<first+count; row+=1) {
+    length += from->rows[row].length;
+  }
+
+  memmove(&to->rows[index+count], &to->rows[index],
+          ARRAY_SIZE(to->rows, to->rowCount-index));
+  memcpy(&to->rows[index], &from->rows[first], ARRAY_SIZE(to->rows, count));
+  adjustTextRowChunk(to, count, length);
+
+  memmove(&from->rows[first], &from->rows[first+count],
+          ARRAY_SIZE(from->rows, from->rowCount-first-count));
+  adjustTextRowChunk(from, -(long)count, -length);
+}
+
+static int
+splitTextRowChunk (TextRowChunk *from, unsigned int number) {
+  TextRowChunk *to = insertTextRowChunk(number+1);
+  if (!to) return 0;
+
+  {
+    unsigned int half = from->rowCount / 2;
+
+    moveTextRows(to, 0, from, half, from->rowCount-half);
+  }
+
+  return 1;
+}
+
+static void
+mergeTextRowChunks (TextRowChunk *to, TextRowChunk *from, unsigned int number) {
+  moveTextRows(to, to->rowCount, from, 0, from->rowCount);
+  removeTextRowChunk(number+1);
+}
+
+typedef struct {
+  TextRowChunk *chunk;
+  unsigned int number; // the position of the chunk
+  unsigned int index; // the position of the row within the chunk
+  long offset; // the text position of the start of the chunk
+} TextRowLocation;
+
+/* A row just past the end is located at the end of the last chunk.
+ * Returns 0 if there aren't any chunks.
+ */
+static int
+locateTextRow (long row, TextRowLocation *location) {
+  TextRowChunk *chunk = textRows.root;
+  if (!chunk) return 0;
+
+  location->number = 0;
+  location->offset = 0;
+
+  while (1) {
+    unsigned int number = getSubtreeChunkCount(chunk->left);
+    long rows = getSubtreeRowCount(chunk->left);
+
+    if (row < rows) {
+      chunk = chunk->left;
+      continue;
+    }
+
+    row -= rows;
+    location->number += number;
+    location->offset += getSubtreeCharacterCount(chunk->left);
+
+    if ((row < chunk->rowCount) || !chunk->right) break;
+
+    row -= chunk->rowCount;
+    location->number += 1;
+    location->offset += chunk->characterCount;
+    chunk = chunk->right;
+  }
+
+  location->chunk = chunk;
+  location->index = MIN(row, chunk->rowCount);
+  return 1;
+}
+
+static void
+freeTextRowChunks (TextRowChunk *chunk) {
+  if (chunk) {
+    freeTextRowChunks(chunk->left);
+    freeTextRowChunks(chunk->right);
+
+    for (unsigned int index=0; index<chunk->rowCount; index+=1) {
+      free(chunk->rows[index].characters);
+    }
+
+    free(chunk);
+  }
+}
+
+void
+clearTextRows (void) {
+  freeTextRowChunks(textRows.root);
+  memset(&textRows, 0, sizeof(textRows));
+}
+
+long
+getTextRowCount (void) {
+  return textRows.rowCount;
+}
+
+long
+getTextCharacterCount (void) {
+  return textRows.characterCount;
+}
+
+TextRow *
+getTextRow (long row) {
+  TextRowLocation location;
+
+  if (!locateTextRow(row, &location)) return NULL;
+  return &location.chunk->rows[location.index];
+}
+
+int
+resizeTextRow (long row, long length) {
+  TextRowLocation location;
+
+  if (!locateTextRow(row, &location)) {
+    logMessage(LOG_ERR, "no text row to resize: %ld", row);
+    return 0;
+  }
+
+  TextRow *text = &location.chunk->rows[location.index];
+  long delta = length - text->length;
+
+  if (length) {
+    wchar_t *characters = realloc(text->characters, ARRAY_SIZE(characters, length));
+
+    if (!characters) {
+      logMallocError();
+      return 0;
+    }
+
+    text->characters = characters;
+  } else {
+    free(text->characters);
+    text->characters = NULL;
+  }
+
+  text->length = length;
+  adjustTextRowChunk(location.chunk, 0, delta);
+  return 1;
+}
+
+int
+insertTextRows (long row, long count) {
+  while (count > 0) {
+    TextRowLocation location;
+
+    if (!locateTextRow(row, &location)) {
+      if (!insertTextRowChunk(0)) return 0;
+      continue;
+    }
+
+    {
+      TextRowChunk *rows = location.chunk;
+      unsigned int index = location.index;
+      unsigned int room = TEXT_ROW_CHUNK_SIZE - rows->rowCount;
+
+      if (!room) {
+        if (index == rows->rowCount) {
+          if (!insertTextRowChunk(location.number+1)) return 0;
+        } else if (!splitTextRowChunk(rows, location.number)) {
+          return 0;
+        }
+
+        continue;
+      }
+
+      {
+        unsigned int inserted = MIN(room, count);
+        TextRow *text = &rows->rows[index];
+
+        memmove(&text[inserted], text, ARRAY_SIZE(text, rows->rowCount-index));
+        memset(text, 0, ARRAY_SIZE(text, inserted));
+        adjustTextRowChunk(rows, inserted, 0);
+
+        row += inserted;
+        count -= inserted;
+      }
+    }
+  }
+
+  return 1;
+}
+
+void
+deleteTextRows (long row, long count) {
+  if (row + count > textRows.rowCount) count = textRows.rowCount - row;
+
+  while (count > 0) {
+    TextRowLocation location;
+    if (!locateTextRow(row, &location)) break;
+
+    TextRowChunk *rows = location.chunk;
+    unsigned int index = location.index;
+    unsigned int deleted = MIN(rows->rowCount-index, count);
+    long length = 0;
+
+    for (unsigned int offset=0; offset<deleted; offset+=1) {
+      TextRow *text = &rows->rows[index+offset];
+
+      length += text->length;
+      free(text->characters);
+    }
+
+    memmove(&rows->rows[index], &rows->rows[index+deleted],
+            ARRAY_SIZE(rows->rows, rows->rowCount-index-deleted));
+    adjustTextRowChunk(rows, -(long)deleted, -length);
+    count -= deleted;
+
+    if (!rows->rowCount) {
+      removeTextRowChunk(location.number);
+    } else {
+      TextRowChunk *next = getTextRowChunk(location.number+1);
+
+      if (next && (rows->rowCount + next->rowCount <= TEXT_ROW_CHUNK_SIZE/2)) {
+        mergeTextRowChunks(rows, next, location.number);
+      }
+    }
+  }
+}
+
+long
+getTextRowOffset (long row) {
+  TextRowLocation location;
+  if (!locateTextRow(row, &location)) return 0;
+
+  {
+    long offset = location.offset;
+    const TextRowChunk *rows = location.chunk;
+
+    for (unsigned int current=0; current<location.index; current+=1) {
+      offset += rows->rows[current].length;
+    }
+
+    return offset;
+  }
+}
+
+long
+findTextRow (long position, long *column) {
+  if (position < 0) {
+    *column = position;
+    return 0;
+  }
+
+  if (position >= textRows.characterCount) {
+    *column = position - textRows.characterCount;
+    return textRows.rowCount;
+  }
+
+  {
+    const TextRowChunk *rows = textRows.root;
+    long row = 0;
+
+    while (1) {
+      long characters = getSubtreeCharacterCount(rows->left);
+
+      if (position < characters) {
+        rows = rows->left;
+        continue;
+      }
+
+      position -= characters;
+      row += getSubtreeRowCount(rows->left);
+      if (position < rows->characterCount) break;
+
+      position -= rows->characterCount;
+      row += rows->rowCount;
+      rows = rows->right;
+    }
+
+    {
+      unsigned int index = 0;
+
+      while (position >= rows->rows[index].length) {
+        position -= rows->rows[index].length;
+        index += 1;
+      }
+
+      *column = position;
+      return row + index;
+    }
+  }
+}
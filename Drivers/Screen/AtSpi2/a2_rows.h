@@ -0,0 +1,66 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#ifndef BRLTTY_INCLUDED_A2_ROWS
+#define BRLTTY_INCLUDED_A2_ROWS
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The text of the current terminal, one entry per line. A row's length
+ * includes its trailing newline (if any). Rows are kept in fixed-size chunks
+ * which are the nodes of a balanced tree, each of which has the row and
+ * character counts for its subtree, so that row lookup, text position
+ * mapping, and inserting and removing chunks are all logarithmic.
+ */
+
+typedef struct {
+  wchar_t *characters;
+  long length;
+} TextRow;
+
+extern void clearTextRows (void);
+extern long getTextRowCount (void);
+extern long getTextCharacterCount (void);
+
+/* The returned row stays valid until rows are inserted or deleted.
+ * NULL is returned if there aren't any rows.
+ * Its length must only be changed via resizeTextRow().
+ */
+extern TextRow *getTextRow (long row);
+extern int resizeTextRow (long row, long length);
+
+/* Inserted rows are empty. */
+extern int insertTextRows (long row, long count);
+extern void deleteTextRows (long row, long count);
+
+/* Returns the text position of the start of the row. */
+extern long getTextRowOffset (long row);
+
+/* Returns the row containing the text position and sets the column within it.
+ * If the position is beyond the end of the text then the row count is
+ * returned and the column is relative to the end of the text.
+ */
+extern long findTextRow (long position, long *column);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BRLTTY_INCLUDED_A2_ROWS */
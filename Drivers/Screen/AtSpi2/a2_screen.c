@@ -70,6 +70,8 @@
 #include "async_io.h"
 #include "async_alarm.h"
 #include "async_event.h"
+#include "timing.h"
+#include "queue.h"
 
 typedef enum {
   PARM_RELEASE,
@@ -78,6 +80,8 @@ typedef enum {
 #define SCRPARMS "release", "type"
 
 #include "scr_driver.h"
+#include "a2_rows.h"
+#include "a2_cache.h"
 
 typedef enum {
   TYPE_ALL,
@@ -94,9 +98,7 @@ static char *curPath;
 static char *curRole;
 static ScreenContentQuality curQuality;
 
-static long curNumRows, curNumCols;
-static wchar_t **curRows;
-static long *curRowLengths;
+static long curNumCols;
 static long curCaret,curPosX,curPosY;
 
 static DBusConnection *bus = NULL;
@@ -240,25 +242,6 @@ static size_t my_mbslen(const char *s, size_t n) {
   return ret;
 }
 
-static void addRows(long pos, long num) {
-  curNumRows += num;
-  curRows = realloc(curRows,curNumRows*sizeof(*curRows));
-  curRowLengths = realloc(curRowLengths,curNumRows*sizeof(*curRowLengths));
-  memmove(curRows      +pos+num,curRows      +pos,(curNumRows-(pos+num))*sizeof(*curRows));
-  memmove(curRowLengths+pos+num,curRowLengths+pos,(curNumRows-(pos+num))*sizeof(*curRowLengths));
-}
-
-static void delRows(long pos, long num) {
-  long y;
-  for (y=pos;y<pos+num;y++)
-    free(curRows[y]);
-  memmove(curRows      +pos,curRows      +pos+num,(curNumRows-(pos+num))*sizeof(*curRows));
-  memmove(curRowLengths+pos,curRowLengths+pos+num,(curNumRows-(pos+num))*sizeof(*curRowLengths));
-  curNumRows -= num;
-  curRows = realloc(curRows,curNumRows*sizeof(*curRows));
-  curRowLengths = realloc(curRowLengths,curNumRows*sizeof(*curRowLengths));
-}
-
 static int
 processParameters_AtSpi2Screen (char **parameters) {
   releaseScreen = 1;
@@ -370,43 +353,114 @@ send_with_reply_and_block(DBusConnection *bus, DBusMessage *msg, int timeout_ms,
   return reply;
 }
 
+/* Sends a method call message without waiting for its reply, which is passed
+ * to the handler (or NULL if there is none) once it arrives. This unrefs the
+ * message. If this fails then the handler won't be called.  */
+typedef void A2ReplyHandler(DBusMessage *reply, void *data);
+
+struct a2Request
+{
+  A2ReplyHandler *handler;
+  void *data;
+  const char *doing;
+};
+
+static void a2HandleReply(DBusPendingCall *pending, void *data)
+{
+  struct a2Request *request = data;
+  DBusMessage *reply = dbus_pending_call_steal_reply(pending);
+
+  if (!reply) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "timeout while %s", request->doing);
+  } else if (dbus_message_get_type(reply) == DBUS_MESSAGE_TYPE_ERROR) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "error while %s: %s", request->doing, dbus_message_get_error_name(reply));
+    dbus_message_unref(reply);
+    reply = NULL;
+  }
+
+  request->handler(reply, request->data);
+  if (reply) dbus_message_unref(reply);
+  dbus_pending_call_unref(pending);
+}
+
+static int
+send_with_reply_async(DBusConnection *bus, DBusMessage *msg, int timeout_ms, const char *doing, A2ReplyHandler *handler, void *data)
+{
+  DBusPendingCall *pending = NULL;
+  struct a2Request *request;
+  int ok = 0;
+
+  if (!(request = malloc(sizeof(*request)))) {
+    logMallocError();
+    goto out;
+  }
+  request->handler = handler;
+  request->data = data;
+  request->doing = doing;
+
+  if (!dbus_connection_send_with_reply(bus, msg, &pending, timeout_ms) || !pending) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "can't send message while %s", doing);
+    free(request);
+    goto out;
+  }
+  if (!dbus_pending_call_set_notify(pending, a2HandleReply, request, free)) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "no memory while %s", doing);
+    dbus_pending_call_cancel(pending);
+    dbus_pending_call_unref(pending);
+    free(request);
+    goto out;
+  }
+  ok = 1;
+
+out:
+  dbus_message_unref(msg);
+  return ok;
+}
+
+/* Creates a message getting a property */
+static DBusMessage *
+new_property_get(const char *sender, const char *path, const char *interface, const char *property)
+{
+  DBusMessage *msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
+
+  if (msg)
+    dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
+  return msg;
+}
+
 static void findPosition(long position, long *px, long *py) {
-  long offset=0, newoffset, x, y;
+  long x, y;
   /* XXX: I don't know what they do with necessary combining accents */
-  for (y=0; y<curNumRows; y++) {
-    if ((newoffset = offset + curRowLengths[y]) > position)
-      break;
-    offset = newoffset;
-  }
-  if (y==curNumRows) {
-    if (!curNumRows) {
-      y = 0;
+  y = findTextRow(position,&x);
+  if (y==getTextRowCount()) {
+    if (!y) {
       x = 0;
     } else {
       /* this _can_ happen, when deleting while caret is at the end of the
        * terminal: caret position is only updated afterwards... In the
        * meanwhile, keep caret at the end of last line. */
-      y = curNumRows-1;
-      x = curRowLengths[y];
+      y--;
+      x = getTextRow(y)->length;
     }
-  } else
-    x = position-offset;
+  }
   *px = x;
   *py = y;
 }
 
 static long findCoordinates(long xx, long yy) {
-  long offset=0, y;
+  long length;
   /* XXX: I don't know what they do with necessary combining accents */
-  if (yy >= curNumRows) {
+  if (yy >= getTextRowCount()) {
     return -1;
   }
-  for (y=0; y<yy; y++) {
-    offset += curRowLengths[y];
-  }
-  if (xx >= curRowLengths[y])
-    xx = curRowLengths[y]-1;
-  return offset + xx;
+  length = getTextRow(yy)->length;
+  if (xx >= length)
+    xx = length-1;
+  return getTextRowOffset(yy) + xx;
 }
 
 static void caretPosition(long caret) {
@@ -418,7 +472,6 @@ static void caretPosition(long caret) {
 }
 
 static void finiTerm(void) {
-  unsigned i;
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "end of term %s:%s",curSender,curPath);
   free(curSender);
@@ -428,15 +481,8 @@ static void finiTerm(void) {
   free(curRole);
   curRole = NULL;
   curPosX = curPosY = 0;
-  if (curRows) {
-    for (i=0;i<curNumRows;i++)
-      free(curRows[i]);
-    free(curRows);
-  }
-  curRows = NULL;
-  free(curRowLengths);
-  curRowLengths = NULL;
-  curNumCols = curNumRows = 0;
+  clearTextRows();
+  curNumCols = 0;
 }
 
 #define ROLE_TERMINAL "terminal"
@@ -458,47 +504,25 @@ isText (void) {
   return isRole(ROLE_TEXT);
 }
 
-/* Get the role of an AT-SPI2 object */
-static char *getRole(const char *sender, const char *path) {
+/* Parse the reply of GetRoleName */
+static char *parseRole(DBusMessage *reply) {
   const char *text;
-  char *res = NULL;
-  DBusMessage *msg, *reply;
   DBusMessageIter iter;
 
-  msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetRoleName");
-  if (!msg)
-    return NULL;
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting role");
-  if (!reply)
-    return NULL;
-
   dbus_message_iter_init(reply, &iter);
   if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_STRING) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "GetRoleName didn't return a string but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
+    return NULL;
   }
   dbus_message_iter_get_basic(&iter, &text);
-  res = strdup(text);
-
-out:
-  dbus_message_unref(reply);
-  return res;
+  return strdup(text);
 }
 
-/* Get the get interfaces of an AT-SPI2 object */
-static int getHasTextInterface(const char *sender, const char *path) {
-  DBusMessage *msg, *reply;
+/* Parse the reply of GetInterfaces, telling whether there is a text interface */
+static int parseHasTextInterface(DBusMessage *reply) {
   DBusMessageIter iter;
   DBusMessageIter iter_array;
-  int ret = 0;
-
-  msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetInterfaces");
-  if (!msg)
-    return 0;
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting interfaces");
-  if (!reply)
-    return 0;
 
   dbus_message_iter_init(reply, &iter);
   dbus_message_iter_recurse (&iter, &iter_array);
@@ -508,165 +532,135 @@ static int getHasTextInterface(const char *sender, const char *path) {
     dbus_message_iter_get_basic (&iter_array, &iface);
 
     if (!strcmp (iface, "org.a11y.atspi.Text"))
-    {
-      ret = 1;
-      goto out;
-    }
+      return 1;
     dbus_message_iter_next (&iter_array);
   }
 
-out:
-  dbus_message_unref(reply);
-  return ret;
+  return 0;
 }
 
-static char *getName(const char *sender, const char *path) {
+/* Parse the reply of getting the Name property */
+static char *parseName(DBusMessage *reply) {
   const char *name;
-  char *res = NULL;
-  DBusMessage *msg, *reply = NULL;
-  const char *interface = SPI2_DBUS_INTERFACE_ACCESSIBLE;
-  const char *property = "Name";
   DBusMessageIter iter, iter_variant;
 
-  msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
-  if (!msg)
-    return NULL;
-  dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting name");
-  if (!reply)
-    return NULL;
-
   dbus_message_iter_init(reply, &iter);
   if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_VARIANT) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "getName didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
+    return NULL;
   }
   dbus_message_iter_recurse(&iter, &iter_variant);
   if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_STRING) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "getName didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
-    goto out;
+    return NULL;
   }
   dbus_message_iter_get_basic(&iter_variant, &name);
-  res = strdup(name);
-
-out:
-  dbus_message_unref(reply);
-  return res;
+  return strdup(name);
 }
 
-/* Get the text of an AT-SPI2 object */
-static char *getText(const char *sender, const char *path) {
+/* Parse the reply of GetText */
+static char *parseText(DBusMessage *reply) {
   const char *text;
-  char *res = NULL;
-  DBusMessage *msg, *reply;
-  dbus_int32_t begin = 0;
-  dbus_int32_t end = -1;
   DBusMessageIter iter;
 
-  msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_TEXT, "GetText");
-  if (!msg)
-    return NULL;
-  dbus_message_append_args(msg, DBUS_TYPE_INT32, &begin, DBUS_TYPE_INT32, &end, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting text");
-  if (!reply)
-    return NULL;
-
   dbus_message_iter_init(reply, &iter);
   if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_STRING) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "GetText didn't return a string but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
+    return NULL;
   }
   dbus_message_iter_get_basic(&iter, &text);
-  res = strdup(text);
-
-out:
-  dbus_message_unref(reply);
-  return res;
+  return strdup(text);
 }
 
-/* Get the caret of an AT-SPI2 object */
-static dbus_int32_t getCaret(const char *sender, const char *path) {
+/* Parse the reply of getting the CaretOffset property */
+static dbus_int32_t parseCaret(DBusMessage *reply) {
   dbus_int32_t res = -1;
-  DBusMessage *msg, *reply = NULL;
-  const char *interface = SPI2_DBUS_INTERFACE_TEXT;
-  const char *property = "CaretOffset";
   DBusMessageIter iter, iter_variant;
 
-  msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
-  if (!msg)
-    return -1;
-  dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting caret");
-  if (!reply)
-    return -1;
-
   dbus_message_iter_init(reply, &iter);
   if (dbus_message_iter_get_arg_type(&iter) != DBUS_TYPE_VARIANT) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "getCaret didn't return a variant but '%c'", dbus_message_iter_get_arg_type(&iter));
-    goto out;
+    return -1;
   }
   dbus_message_iter_recurse(&iter, &iter_variant);
   if (dbus_message_iter_get_arg_type(&iter_variant) != DBUS_TYPE_INT32) {
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "getCaret didn't return an int32 but '%c'", dbus_message_iter_get_arg_type(&iter_variant));
-    goto out;
+    return -1;
   }
   dbus_message_iter_get_basic(&iter_variant, &res);
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "Got caret %d", res);
-
-out:
-  dbus_message_unref(reply);
   return res;
 }
 
-/* Switched to a new terminal, restart from scratch */
-static void restartTerm(const char *sender, const char *path) {
-  char *text = getText(sender, path);
-  if (!text) {
-    text = getName(sender, path);
-    if (!text) return;
+/* Parse the reply of GetState */
+static int parseState(DBusMessage *reply, dbus_uint32_t *states) {
+  DBusMessageIter iter, iter_array;
+  dbus_uint32_t *array;
+  int count;
+
+  if (strcmp (dbus_message_get_signature (reply), "au") != 0)
+  {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "unexpected signature %s while getting active state", dbus_message_get_signature(reply));
+    return 0;
+  }
+  dbus_message_iter_init (reply, &iter);
+  dbus_message_iter_recurse (&iter, &iter_array);
+  dbus_message_iter_get_fixed_array (&iter_array, &array, &count);
+  if (count != 2)
+  {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "unexpected signature %s while getting active state", dbus_message_get_signature(reply));
+    return 0;
   }
+  states[0] = array[0];
+  states[1] = array[1];
+  return 1;
+}
+
+/* Switched to a new terminal, restart from scratch. This takes the text. */
+static int restartTerm(const char *sender, const char *path, char *text, dbus_int32_t caret) {
+  if (!text) return 0;
 
   char *c,*d;
   const char *e;
-  long i,len;
+  long i,len,rows;
 
   curSender = strdup(sender);
   curPath = strdup(path);
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "new term %s:%s with text %s", curSender, curPath, text);
 
-  if (curRows) {
-    for (i=0;i<curNumRows;i++)
-      free(curRows[i]);
-    free(curRows);
-  }
-  curNumRows = 0;
-  free(curRowLengths);
+  clearTextRows();
+  rows = 0;
   c = text;
   while (*c) {
-    curNumRows++;
+    rows++;
     if (!(c = strchr(c,'\n')))
       break;
     c++;
   }
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-             "%ld rows",curNumRows);
-  curRows = malloc(curNumRows * sizeof(*curRows));
-  curRowLengths = malloc(curNumRows * sizeof(*curRowLengths));
+             "%ld rows",rows);
+  if (!insertTextRows(0,rows)) {
+    free(text);
+    return 1;
+  }
   i = 0;
   curNumCols = 0;
   for (c = text; *c; c = d+1) {
+    TextRow *row;
     d = strchr(c,'\n');
     if (d)
       *d = 0;
     e = c;
-    curRowLengths[i] = (len = my_mbsrtowcs(NULL,&e,0,NULL)) + (d != NULL);
+    len = my_mbsrtowcs(NULL,&e,0,NULL);
     if (len > curNumCols)
       curNumCols = len;
     else if (len < 0) {
@@ -674,84 +668,61 @@ static void restartTerm(const char *sender, const char *path) {
 	logMessage(LOG_ERR,"unterminated sequence %s",c);
       else if (len==-1)
 	logSystemError("mbrlen");
-      curRowLengths[i] = (len = 0) + (d != NULL);
+      len = 0;
     }
-    curRows[i] = malloc((len + (d!=NULL)) * sizeof(*curRows[i]));
+    if (!resizeTextRow(i,len + (d != NULL)))
+      break;
+    row = getTextRow(i);
     e = c;
-    my_mbsrtowcs(curRows[i],&e,len,NULL);
+    my_mbsrtowcs(row->characters,&e,len,NULL);
     if (d)
-      curRows[i][len]='\n';
+      row->characters[len]='\n';
     else
       break;
     i++;
   }
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "%ld cols",curNumCols);
-  caretPosition(getCaret(sender, path));
+  caretPosition(caret);
   free(text);
+  return 1;
 }
 
-/* Switched to a new object, check whether we want to read it, and if so, restart with it */
-static void tryRestartTerm(const char *sender, const char *path) {
-  if (curPath) finiTerm();
-  restartTerm(sender, path);
+/* Remember the state of an object */
+static void cacheState(const char *sender, const char *path, const dbus_uint32_t *states) {
+  CachedObject *object = getCachedObject(sender, path, 1);
 
-  curRole = getRole(sender, path);
-  logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-             "state changed focus to role %s", curRole);
-
-  curQuality = getHasTextInterface(sender, path)? SCQ_POOR: SCQ_NONE;
-  unsigned char requested = typeFlags[TYPE_ALL];
-
-  if (!requested) {
-    if (isTerminal()) {
-      curQuality = SCQ_GOOD;
-      requested = typeFlags[TYPE_TERMINAL];
-    } else if (isText()) {
-      curQuality = SCQ_FAIR;
-      requested = typeFlags[TYPE_TEXT];
-    }
+  if (object) {
+    object->states[0] = states[0];
+    object->states[1] = states[1];
+    object->haveStates = 1;
   }
-
-  if (requested) curQuality = SCQ_GOOD;     
 }
 
 /* Get the state of an object */
-static dbus_uint32_t *getState(const char *sender, const char *path)
+static int getState(const char *sender, const char *path, dbus_uint32_t *states)
 {
   DBusMessage *msg, *reply;
-  DBusMessageIter iter, iter_array;
-  dbus_uint32_t *states, *ret = NULL;
-  int count;
+  CachedObject *object = getCachedObject(sender, path, 0);
+  int ok;
+
+  if (object && object->haveStates) {
+    states[0] = object->states[0];
+    states[1] = object->states[1];
+    return 1;
+  }
 
   msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetState");
   if (!msg)
-    return NULL;
+    return 0;
   reply = send_with_reply_and_block(bus, msg, 1000, "getting state");
   if (!reply)
-    return NULL;
-
-  if (strcmp (dbus_message_get_signature (reply), "au") != 0)
-  {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "unexpected signature %s while getting active state", dbus_message_get_signature(reply));
-    goto out;
-  }
-  dbus_message_iter_init (reply, &iter);
-  dbus_message_iter_recurse (&iter, &iter_array);
-  dbus_message_iter_get_fixed_array (&iter_array, &states, &count);
-  if (count != 2)
-  {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "unexpected signature %s while getting active state", dbus_message_get_signature(reply));
-    goto out;
-  }
-  ret = malloc(sizeof(*ret) * count);
-  memcpy(ret, states, sizeof(*ret) * count);
+    return 0;
 
-out:
+  if ((ok = parseState(reply, states)))
+    cacheState(sender, path, states);
   dbus_message_unref(reply);
-  return ret;
+  return ok;
 }
 
 /* Check whether an ancestor of this object is active */
@@ -759,14 +730,11 @@ static int checkActiveParent(const char *sender, const char *path) {
   DBusMessage *msg, *reply;
   DBusMessageIter iter, iter_variant, iter_struct;
   int res = 0;
-  const char *interface = SPI2_DBUS_INTERFACE_ACCESSIBLE;
-  const char *property = "Parent";
-  dbus_uint32_t *states;
+  dbus_uint32_t states[2];
 
-  msg = new_method_call(sender, path, DBUS_INTERFACE_PROPERTIES, "Get");
+  msg = new_property_get(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "Parent");
   if (!msg)
     return 0;
-  dbus_message_append_args(msg, DBUS_TYPE_STRING, &interface, DBUS_TYPE_STRING, &property, DBUS_TYPE_INVALID);
   reply = send_with_reply_and_block(bus, msg, 1000, "checking active object");
   if (!reply)
     return 0;
@@ -785,10 +753,8 @@ static int checkActiveParent(const char *sender, const char *path) {
   dbus_message_iter_next (&iter_struct);
   dbus_message_iter_get_basic (&iter_struct, &path);
 
-  states = getState(sender, path);
-  if (states) {
+  if (getState(sender, path, states)) {
     res = (states[0] & (1<<ATSPI_STATE_ACTIVE)) != 0 || checkActiveParent(sender, path);
-    free(states);
   } else {
     res = 0;
   }
@@ -798,26 +764,279 @@ out:
   return res;
 }
 
+static void AtSpi2HandleEvent(const char *interface, DBusMessage *message);
+
+/* Switching to a new object. Everything needed is requested at once, and the
+ * switch is completed when the last reply arrives, so that the core isn't
+ * blocked meanwhile. Text events for the object which arrive after its text
+ * (or caret) has been fetched are replayed once the switch is complete. */
+struct focusSwitch
+{
+  char *sender;
+  char *path;
+  TimeValue started;
+  unsigned int pending;
+  unsigned int requests;
+  unsigned int cached;
+
+  char *role;
+  int hasTextInterface;
+  char *name;
+  char *text;
+  dbus_int32_t caret;
+  unsigned char haveText:1;
+  unsigned char haveCaret:1;
+  Queue *events;
+};
+
+static struct focusSwitch *focusSwitch;
+
+static void deallocateFocusSwitchEvent(void *item, void *data) {
+  dbus_message_unref(item);
+}
+
+static void destroyFocusSwitch(struct focusSwitch *fs) {
+  if (fs->events) deallocateQueue(fs->events);
+  free(fs->text);
+  free(fs->name);
+  free(fs->role);
+  free(fs->path);
+  free(fs->sender);
+  free(fs);
+}
+
+/* The switch is freed when its last reply arrives */
+static void cancelFocusSwitch(void) {
+  focusSwitch = NULL;
+}
+
+static int isFocusSwitchTarget(const char *sender, const char *path) {
+  return focusSwitch && !strcmp(sender, focusSwitch->sender) && !strcmp(path, focusSwitch->path);
+}
+
+static void queueFocusSwitchEvent(DBusMessage *message) {
+  dbus_message_ref(message);
+  if (!enqueueItem(focusSwitch->events, message))
+    dbus_message_unref(message);
+}
+
+static int restartTerm(const char *sender, const char *path, char *text, dbus_int32_t caret);
+
+static void completeFocusSwitch(struct focusSwitch *fs) {
+  char *text;
+  TimeValue now;
+
+  if (fs->text) {
+    text = fs->text;
+    fs->text = NULL;
+  } else {
+    text = fs->name;
+    fs->name = NULL;
+  }
+
+  if (curPath) finiTerm();
+  if (restartTerm(fs->sender, fs->path, text, fs->caret)) {
+    DBusMessage *event;
+
+    curRole = fs->role;
+    fs->role = NULL;
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "state changed focus to role %s", curRole);
+
+    curQuality = fs->hasTextInterface? SCQ_POOR: SCQ_NONE;
+    unsigned char requested = typeFlags[TYPE_ALL];
+
+    if (!requested) {
+      if (isTerminal()) {
+        curQuality = SCQ_GOOD;
+        requested = typeFlags[TYPE_TERMINAL];
+      } else if (isText()) {
+        curQuality = SCQ_FAIR;
+        requested = typeFlags[TYPE_TEXT];
+      }
+    }
+
+    if (requested) curQuality = SCQ_GOOD;
+
+    while ((event = dequeueItem(fs->events))) {
+      AtSpi2HandleEvent(dbus_message_get_interface(event) + strlen(SPI2_DBUS_INTERFACE_EVENT"."), event);
+      dbus_message_unref(event);
+    }
+  }
+
+  getMonotonicTime(&now);
+  logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+             "focus switch to %s %s took %ld ms (%u requests, %u cached)",
+             fs->sender, fs->path, millisecondsBetween(&fs->started, &now),
+             fs->requests, fs->cached);
+  updated = 1;
+}
+
+static void endFocusSwitchReply(struct focusSwitch *fs) {
+  if (--fs->pending) return;
+
+  if (fs == focusSwitch) {
+    focusSwitch = NULL;
+    completeFocusSwitch(fs);
+  }
+
+  destroyFocusSwitch(fs);
+}
+
+static void handleFocusSwitchRole(DBusMessage *reply, void *data) {
+  struct focusSwitch *fs = data;
+
+  if (reply && (fs == focusSwitch)) {
+    if ((fs->role = parseRole(reply))) {
+      CachedObject *object = getCachedObject(fs->sender, fs->path, 1);
+      if (object) setCachedRole(object, fs->role);
+    }
+  }
+  endFocusSwitchReply(fs);
+}
+
+static void handleFocusSwitchInterfaces(DBusMessage *reply, void *data) {
+  struct focusSwitch *fs = data;
+
+  if (reply && (fs == focusSwitch)) {
+    CachedObject *object = getCachedObject(fs->sender, fs->path, 1);
+
+    fs->hasTextInterface = parseHasTextInterface(reply);
+    if (object) {
+      object->hasTextInterface = fs->hasTextInterface;
+      object->haveInterfaces = 1;
+    }
+  }
+  endFocusSwitchReply(fs);
+}
+
+static void handleFocusSwitchName(DBusMessage *reply, void *data) {
+  struct focusSwitch *fs = data;
+
+  if (reply && (fs == focusSwitch))
+    fs->name = parseName(reply);
+  endFocusSwitchReply(fs);
+}
+
+static void handleFocusSwitchText(DBusMessage *reply, void *data) {
+  struct focusSwitch *fs = data;
+
+  if (fs == focusSwitch) {
+    if (reply)
+      fs->text = parseText(reply);
+    fs->haveText = 1;
+  }
+  endFocusSwitchReply(fs);
+}
+
+static void handleFocusSwitchCaret(DBusMessage *reply, void *data) {
+  struct focusSwitch *fs = data;
+
+  if (fs == focusSwitch) {
+    if (reply)
+      fs->caret = parseCaret(reply);
+    fs->haveCaret = 1;
+  }
+  endFocusSwitchReply(fs);
+}
+
+static void requestFocusSwitchProperty(struct focusSwitch *fs, DBusMessage *msg, const char *doing, A2ReplyHandler *handler) {
+  if (!msg)
+    return;
+  if (send_with_reply_async(bus, msg, 1000, doing, handler, fs)) {
+    fs->pending += 1;
+    fs->requests += 1;
+  }
+}
+
+static void stopTreeSearch(void);
+
+/* Switched to a new object, check whether we want to read it, and if so, restart with it */
+static void startFocusSwitch(const char *sender, const char *path) {
+  struct focusSwitch *fs;
+  CachedObject *object;
+  DBusMessage *msg;
+
+  stopTreeSearch();
+  if (isFocusSwitchTarget(sender, path))
+    /* Already on its way (focus events tend to come in pairs) */
+    return;
+  cancelFocusSwitch();
+
+  if (!(fs = calloc(1, sizeof(*fs))))
+    goto noMemory;
+  fs->caret = -1;
+  getMonotonicTime(&fs->started);
+  if (!(fs->sender = strdup(sender)))
+    goto noMemory;
+  if (!(fs->path = strdup(path)))
+    goto noMemory;
+  if (!(fs->events = newQueue(deallocateFocusSwitchEvent, NULL)))
+    goto noMemory;
+
+  focusSwitch = fs;
+  /* Hold the switch open until all of the requests have been sent */
+  fs->pending = 1;
+
+  object = getCachedObject(sender, path, 0);
+  if (object && object->haveRole) {
+    fs->role = strdup(object->role);
+    fs->cached += 1;
+  } else {
+    requestFocusSwitchProperty(fs, new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetRoleName"),
+                               "getting role", handleFocusSwitchRole);
+  }
+
+  if (object && object->haveInterfaces) {
+    fs->hasTextInterface = object->hasTextInterface;
+    fs->cached += 1;
+  } else {
+    requestFocusSwitchProperty(fs, new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetInterfaces"),
+                               "getting interfaces", handleFocusSwitchInterfaces);
+  }
+
+  requestFocusSwitchProperty(fs, new_property_get(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "Name"),
+                             "getting name", handleFocusSwitchName);
+
+  if ((msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_TEXT, "GetText"))) {
+    dbus_int32_t begin = 0;
+    dbus_int32_t end = -1;
+
+    dbus_message_append_args(msg, DBUS_TYPE_INT32, &begin, DBUS_TYPE_INT32, &end, DBUS_TYPE_INVALID);
+    requestFocusSwitchProperty(fs, msg, "getting text", handleFocusSwitchText);
+  }
+
+  /* Requested after the text so that caret moves which it reflects are dropped */
+  requestFocusSwitchProperty(fs, new_property_get(sender, path, SPI2_DBUS_INTERFACE_TEXT, "CaretOffset"),
+                             "getting caret", handleFocusSwitchCaret);
+
+  endFocusSwitchReply(fs);
+  return;
+
+noMemory:
+  logMallocError();
+  if (fs) destroyFocusSwitch(fs);
+}
+
 /* Check whether this object is the focused object (which is way faster than
  * browsing all objects of the desktop) */
 static int reinitTerm(const char *sender, const char *path) {
-  dbus_uint32_t *states = getState(sender, path);
+  dbus_uint32_t states[2];
   int active = 0;
 
-  if (!states)
+  if (!getState(sender, path, states))
     return 0;
 
   /* Whether this widget is active */
   active = (states[0] & (1<<ATSPI_STATE_ACTIVE)) != 0;
 
   if (states[0] & (1<<ATSPI_STATE_FOCUSED)) {
-    free(states);
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "%s %s is focused!", sender, path);
     /* This widget is focused */
     if (active) {
       /* And it is active, we are done.  */
-      tryRestartTerm(sender, path);
+      startFocusSwitch(sender, path);
       return 1;
     } else {
       /* Check that a parent is active.  */
@@ -825,116 +1044,277 @@ static int reinitTerm(const char *sender, const char *path) {
     }
   }
 
-  free(states);
   return 0;
 }
 
-/* Try to find an active object among children of the given object */
+/* Try to find an active object, starting from the registry. The tree is
+ * walked breadth first with up to TREE_SEARCH_PIPELINE_DEPTH requests in
+ * flight, and the states of already known objects are taken from the cache.
+ *
+ * We need to take care of bogus applications which have children loops, so
+ * objects already visited by this search are skipped. */
+#define TREE_SEARCH_PIPELINE_DEPTH 8
+#define OBJECT_CACHE_LIMIT 0X4000
 
-/* We need to take care of bogus applications which have children loops, so we
- * need to compare newly found children with the list of ancestors */
-struct pathList {
-  const char *sender;
-  const char *path;
-  struct pathList *prev;
-  int loop;
+typedef enum {
+  TREE_GET_STATE,
+  TREE_GET_CHILDREN
+} TreeRequestType;
+
+struct treeRequest
+{
+  TreeRequestType type;
+  unsigned int generation;
+  int active;
+  char *sender;
+  char *path;
 };
-static int findTerm(const char *sender, const char *path, int active, int depth, struct pathList *list);
-static int recurseFindTerm(const char *sender, const char *path, int active, int depth, struct pathList *list) {
-  DBusMessage *msg, *reply;
-  DBusMessageIter iter, iter_array, iter_struct;
-  int res = 0;
 
-  msg = new_method_call(sender, path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetChildren");
-  if (!msg)
-    return 0;
-  reply = send_with_reply_and_block(bus, msg, 1000, "getting active object");
-  if (!reply)
-    return 0;
+static struct {
+  unsigned int generation;
+  unsigned char running;
+  unsigned int pending;
+  unsigned int visited;
+  TimeValue started;
+  Queue *requests;
+} treeSearch;
+
+static void freeTreeRequest(struct treeRequest *request) {
+  free(request->sender);
+  free(request->path);
+  free(request);
+}
 
-  if (strcmp (dbus_message_get_signature (reply), "a(so)") != 0)
-  {
-    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "unexpected signature %s while getting active object", dbus_message_get_signature(reply));
-    goto out;
-  }
-  dbus_message_iter_init(reply, &iter);
-  dbus_message_iter_recurse (&iter, &iter_array);
-  while (dbus_message_iter_get_arg_type (&iter_array) != DBUS_TYPE_INVALID)
-  {
-    const char *childsender, *childpath;
-    struct pathList *cur;
-
-    dbus_message_iter_recurse (&iter_array, &iter_struct);
-    dbus_message_iter_get_basic (&iter_struct, &childsender);
-    dbus_message_iter_next (&iter_struct);
-    dbus_message_iter_get_basic (&iter_struct, &childpath);
-
-    /* Make sure that the child is not the same as an ancestor, to avoid
-     * recursing indefinitely.  */
-    for (cur = list; cur; cur = cur->prev)
-      if (!strcmp(childsender, cur->sender) && !strcmp(childpath, cur->path))
-      {
-	/* Loop detected, avoid continuing looking at this part of the tree
-	which is not actually a tree! */
-	cur->loop = 1;
-	break;
-      }
-    if (! cur)
-    {
-      struct pathList me = {
-	.sender = sender,
-	.path = path,
-	.prev = list,
-      };
-      if (findTerm(childsender, childpath, active, depth, &me))
-      {
-	res = 1;
-	goto out;
-      }
-      if (me.loop) {
-        /* There is a loop up to us.  Avoid continuing looking here which may
-         * entail an exponential number of lookups. */
-	break;
+static void deallocateTreeRequest(void *item, void *data) {
+  freeTreeRequest(item);
+}
+
+static void queueTreeRequest(TreeRequestType type, const char *sender, const char *path, int active) {
+  struct treeRequest *request;
+
+  if ((request = calloc(1, sizeof(*request)))) {
+    request->type = type;
+    request->generation = treeSearch.generation;
+    request->active = active;
+
+    if ((request->sender = strdup(sender))) {
+      if ((request->path = strdup(path))) {
+        if (enqueueItem(treeSearch.requests, request))
+          return;
       }
     }
 
-    dbus_message_iter_next (&iter_array);
+    freeTreeRequest(request);
   }
 
-out:
-  dbus_message_unref(reply);
-  return res;
+  logMallocError();
 }
 
-/* Test whether this object is active, and if not recurse in its children */
-static int findTerm(const char *sender, const char *path, int active, int depth, struct pathList *list) {
-  dbus_uint32_t *states = getState(sender, path);
-
-  if (!states)
-    return 0;
+static void stopTreeSearch(void) {
+  if (treeSearch.running) {
+    treeSearch.running = 0;
+    /* Replies still in flight are now ignored */
+    treeSearch.generation += 1;
+    deleteElements(treeSearch.requests);
+  }
+}
 
-  if (states[0] & (1<<ATSPI_STATE_ACTIVE))
+/* Test whether this object is active, and if not recurse in its children */
+static void examineTreeObject(const char *sender, const char *path, int active, dbus_uint32_t state) {
+  if (state & (1<<ATSPI_STATE_ACTIVE))
     /* This application is active */
     active = 1;
 
-  if (states[0] & (1<<ATSPI_STATE_FOCUSED) && active)
+  if (state & (1<<ATSPI_STATE_FOCUSED) && active)
   {
+    TimeValue now;
+
     /* And this widget is focused */
+    getMonotonicTime(&now);
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
-               "%s %s is focused!", sender, path);
-    free(states);
-    tryRestartTerm(sender, path);
-    return 1;
+               "%s %s is focused! (found after %ld ms, %u objects visited)",
+               sender, path, millisecondsBetween(&treeSearch.started, &now), treeSearch.visited);
+    startFocusSwitch(sender, path);
+    return;
+  }
+
+  queueTreeRequest(TREE_GET_CHILDREN, sender, path, active);
+}
+
+static void pumpTreeSearch(void);
+
+static void handleTreeState(DBusMessage *reply, void *data) {
+  struct treeRequest *request = data;
+
+  if (request->generation == treeSearch.generation) {
+    dbus_uint32_t states[2];
+
+    treeSearch.pending -= 1;
+    if (reply && parseState(reply, states)) {
+      cacheState(request->sender, request->path, states);
+      examineTreeObject(request->sender, request->path, request->active, states[0]);
+    }
+    pumpTreeSearch();
   }
+  freeTreeRequest(request);
+}
+
+static void handleTreeChildren(DBusMessage *reply, void *data) {
+  struct treeRequest *request = data;
+
+  if (request->generation == treeSearch.generation) {
+    treeSearch.pending -= 1;
+
+    if (reply) {
+      if (strcmp (dbus_message_get_signature (reply), "a(so)") != 0) {
+        logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+                   "unexpected signature %s while getting active object", dbus_message_get_signature(reply));
+      } else {
+        DBusMessageIter iter, iter_array, iter_struct;
+
+        dbus_message_iter_init(reply, &iter);
+        dbus_message_iter_recurse (&iter, &iter_array);
+        while (dbus_message_iter_get_arg_type (&iter_array) != DBUS_TYPE_INVALID)
+        {
+          const char *childsender, *childpath;
+
+          dbus_message_iter_recurse (&iter_array, &iter_struct);
+          dbus_message_iter_get_basic (&iter_struct, &childsender);
+          dbus_message_iter_next (&iter_struct);
+          dbus_message_iter_get_basic (&iter_struct, &childpath);
+          queueTreeRequest(TREE_GET_STATE, childsender, childpath, request->active);
+          dbus_message_iter_next (&iter_array);
+        }
+      }
+    }
 
-  free(states);
-  return recurseFindTerm(sender, path, active, depth+1, list);
+    pumpTreeSearch();
+  }
+  freeTreeRequest(request);
+}
+
+static void pumpTreeSearch(void) {
+  while (treeSearch.running && (treeSearch.pending < TREE_SEARCH_PIPELINE_DEPTH)) {
+    struct treeRequest *request = dequeueItem(treeSearch.requests);
+    DBusMessage *msg;
+    const char *doing;
+    A2ReplyHandler *handler;
+
+    if (!request)
+      break;
+
+    if (request->type == TREE_GET_STATE) {
+      CachedObject *object = getCachedObject(request->sender, request->path, 1);
+
+      if (object) {
+        if (object->searchGeneration == treeSearch.generation) {
+          /* Loop detected, this part of the tree has already been looked at */
+          freeTreeRequest(request);
+          continue;
+        }
+        object->searchGeneration = treeSearch.generation;
+      }
+      treeSearch.visited += 1;
+
+      if (object && object->haveStates) {
+        examineTreeObject(request->sender, request->path, request->active, object->states[0]);
+        freeTreeRequest(request);
+        continue;
+      }
+
+      msg = new_method_call(request->sender, request->path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetState");
+      doing = "getting state";
+      handler = handleTreeState;
+    } else {
+      msg = new_method_call(request->sender, request->path, SPI2_DBUS_INTERFACE_ACCESSIBLE, "GetChildren");
+      doing = "getting active object";
+      handler = handleTreeChildren;
+    }
+
+    if (msg && send_with_reply_async(bus, msg, 1000, doing, handler, request))
+      treeSearch.pending += 1;
+    else
+      freeTreeRequest(request);
+  }
+
+  if (treeSearch.running && !treeSearch.pending && !getQueueSize(treeSearch.requests)) {
+    TimeValue now;
+
+    getMonotonicTime(&now);
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER),
+               "no focused object found after %ld ms (%u objects visited)",
+               millisecondsBetween(&treeSearch.started, &now), treeSearch.visited);
+    treeSearch.running = 0;
+  }
 }
 
 /* Find out currently focused terminal, starting from registry */
 static void initTerm(void) {
-  recurseFindTerm(SPI2_DBUS_INTERFACE_REG, SPI2_DBUS_PATH_ROOT, 0, 0, NULL);
+  stopTreeSearch();
+
+  if (!treeSearch.requests) {
+    if (!(treeSearch.requests = newQueue(deallocateTreeRequest, NULL)))
+      return;
+  }
+
+  if (getObjectCacheSize() > OBJECT_CACHE_LIMIT)
+    clearObjectCache();
+
+  treeSearch.generation += 1;
+  treeSearch.running = 1;
+  treeSearch.pending = 0;
+  treeSearch.visited = 0;
+  getMonotonicTime(&treeSearch.started);
+
+  queueTreeRequest(TREE_GET_CHILDREN, SPI2_DBUS_INTERFACE_REG, SPI2_DBUS_PATH_ROOT, 0);
+  pumpTreeSearch();
+}
+
+/* Keep the object cache in step with what events say has changed */
+static void updateObjectCache(const char *member, const char *sender, const char *path,
+                              const char *detail, dbus_int32_t detail1, DBusMessageIter *iter_variant)
+{
+  CachedObject *object;
+
+  if (!strcmp(member, "StateChanged")) {
+    int state;
+
+    if (!strcmp(detail, "defunct")) {
+      if (detail1) removeCachedObject(sender, path);
+      return;
+    }
+
+    if (!strcmp(detail, "active"))
+      state = ATSPI_STATE_ACTIVE;
+    else if (!strcmp(detail, "focused"))
+      state = ATSPI_STATE_FOCUSED;
+    else
+      /* Only the states above are cached */
+      return;
+
+    if ((object = getCachedObject(sender, path, 0)) && object->haveStates) {
+      if (detail1)
+        object->states[0] |= 1<<state;
+      else
+        object->states[0] &= ~(1<<state);
+    }
+  } else if (!strcmp(member, "PropertyChange")) {
+    if (!strcmp(detail, "accessible-role")) {
+      if ((object = getCachedObject(sender, path, 0)))
+        forgetCachedRole(object);
+    }
+  } else if (!strcmp(member, "ChildrenChanged")) {
+    if (!strcmp(detail, "remove") && (dbus_message_iter_get_arg_type(iter_variant) == DBUS_TYPE_STRUCT)) {
+      DBusMessageIter iter_struct;
+      const char *childsender, *childpath;
+
+      dbus_message_iter_recurse(iter_variant, &iter_struct);
+      dbus_message_iter_get_basic(&iter_struct, &childsender);
+      dbus_message_iter_next(&iter_struct);
+      dbus_message_iter_get_basic(&iter_struct, &childpath);
+      removeCachedObject(childsender, childpath);
+    }
+  }
 }
 
 /* Handle incoming events */
@@ -986,16 +1366,37 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
   }
   dbus_message_iter_recurse(&iter, &iter_variant);
 
+  if (!strcmp(interface, "Object")) {
+    updateObjectCache(member, sender, path, detail, detail1, &iter_variant);
+
+    if (isFocusSwitchTarget(sender, path)) {
+      /* Events which precede the text (or caret) which is being fetched are
+       * already reflected in it, later ones are replayed afterward. */
+      if (!strcmp(member, "TextChanged")) {
+        if (focusSwitch->haveText) queueFocusSwitchEvent(message);
+        return;
+      }
+
+      if (!strcmp(member, "TextCaretMoved")) {
+        if (focusSwitch->haveCaret) queueFocusSwitchEvent(message);
+        return;
+      }
+    }
+  }
+
   StateChanged_focused =
        !strcmp(interface, "Object")
     && !strcmp(member, "StateChanged")
     && !strcmp(detail, "focused");
 
   if (StateChanged_focused && !detail1) {
+    if (isFocusSwitchTarget(sender, path))
+      cancelFocusSwitch();
     if (curSender && !strcmp(sender, curSender) && !strcmp(path, curPath))
       finiTerm();
   } else if (!strcmp(interface,"Focus") || (StateChanged_focused && detail1)) {
-    tryRestartTerm(sender, path);
+    startFocusSwitch(sender, path);
+    return;
   } else if (!strcmp(interface, "Object") && !strcmp(member, "TextCaretMoved")) {
     if (!curSender || strcmp(sender, curSender) || strcmp(path, curPath)) return;
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
@@ -1027,12 +1428,12 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "'%s'",deleted);
     downTo = y;
-    if (downTo < curNumRows)
-      length = curRowLengths[downTo];
+    if (downTo < getTextRowCount())
+      length = getTextRow(downTo)->length;
     while (x+toDelete >= length) {
       downTo++;
-      if (downTo <= curNumRows - 1)
-	length += curRowLengths[downTo];
+      if (downTo <= getTextRowCount() - 1)
+	length += getTextRow(downTo)->length;
       else {
 	/* imaginary extra line doesn't provide more length, and shouldn't need to ! */
 	if (x+toDelete > length) {
@@ -1049,25 +1450,28 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
       return;
     if (length-toDelete>0) {
       /* still something on line y */
+      TextRow *row = getTextRow(y);
       if (y!=downTo) {
-	curRowLengths[y] = length-toDelete;
-	curRows[y]=realloc(curRows[y],curRowLengths[y]*sizeof(*curRows[y]));
+	if (!resizeTextRow(y,length-toDelete))
+	  return;
+      }
+      if ((toCopy = length-toDelete-x)) {
+	const TextRow *from = getTextRow(downTo);
+	memmove(row->characters+x,from->characters+from->length-toCopy,toCopy*sizeof(*from->characters));
       }
-      if ((toCopy = length-toDelete-x))
-	memmove(curRows[y]+x,curRows[downTo]+curRowLengths[downTo]-toCopy,toCopy*sizeof(*curRows[downTo]));
       if (y==downTo) {
-	curRowLengths[y] = length-toDelete;
-	curRows[y]=realloc(curRows[y],curRowLengths[y]*sizeof(*curRows[y]));
+	if (!resizeTextRow(y,length-toDelete))
+	  return;
       }
     } else {
       /* kills this line as well ! */
       y--;
     }
-    if (downTo>=curNumRows)
+    if (downTo>=getTextRowCount())
       /* imaginary extra lines don't need to be deleted */
-      downTo=curNumRows-1;
+      downTo=getTextRowCount()-1;
     if (downTo>y) {
-      delRows(y+1,downTo-y);
+      deleteTextRows(y+1,downTo-y);
     }
     caretPosition(curCaret);
   } else if (!strcmp(interface, "Object") && !strcmp(member, "TextChanged") && !strcmp(detail, "insert")) {
@@ -1091,58 +1495,66 @@ static void AtSpi2HandleEvent(const char *interface, DBusMessage *message)
     logMessage(LOG_CATEGORY(SCREEN_DRIVER),
                "'%s'",added);
     adding = c = added;
-    if (y < curNumRows && x > curRowLengths[y]) {
-      logMessage(LOG_ERR,"adding %ld %ld past end of text!", len, x - curRowLengths[y]);
-      x = curRowLengths[y];
+    if (y < getTextRowCount() && x > getTextRow(y)->length) {
+      logMessage(LOG_ERR,"adding %ld %ld past end of text!", len, x - getTextRow(y)->length);
+      x = getTextRow(y)->length;
     }
     if (x && (c = strchr(adding,'\n'))) {
       /* splitting line */
-      addRows(y,1);
+      TextRow *row, *next;
+      if (!insertTextRows(y,1))
+	return;
       semilen=my_mbslen(adding,c+1-adding);
-      curRowLengths[y]=x+semilen;
+      if (!resizeTextRow(y,x+semilen))
+	return;
       if (x+semilen-1>curNumCols)
 	curNumCols=x+semilen-1;
 
       /* copy beginning */
-      curRows[y]=malloc(curRowLengths[y]*sizeof(*curRows[y]));
-      memcpy(curRows[y],curRows[y+1],x*sizeof(*curRows[y]));
+      row=getTextRow(y);
+      next=getTextRow(y+1);
+      memcpy(row->characters,next->characters,x*sizeof(*row->characters));
       /* add */
-      my_mbsrtowcs(curRows[y]+x,&adding,semilen,NULL);
+      my_mbsrtowcs(row->characters+x,&adding,semilen,NULL);
       len-=semilen;
       adding=c+1;
       /* shift end */
-      curRowLengths[y+1]-=x;
-      memmove(curRows[y+1],curRows[y+1]+x,curRowLengths[y+1]*sizeof(*curRows[y+1]));
+      memmove(next->characters,next->characters+x,(next->length-x)*sizeof(*next->characters));
+      resizeTextRow(y+1,next->length-x);
       x=0;
       y++;
     }
     while ((c = strchr(adding,'\n'))) {
       /* adding lines */
-      addRows(y,1);
+      if (!insertTextRows(y,1))
+	return;
       semilen=my_mbslen(adding,c+1-adding);
-      curRowLengths[y]=semilen;
+      if (!resizeTextRow(y,semilen))
+	return;
       if (semilen-1>curNumCols)
 	curNumCols=semilen-1;
-      curRows[y]=malloc(semilen*sizeof(*curRows[y]));
-      my_mbsrtowcs(curRows[y],&adding,semilen,NULL);
+      my_mbsrtowcs(getTextRow(y)->characters,&adding,semilen,NULL);
       len-=semilen;
       adding=c+1;
       y++;
     }
     if (len) {
       /* still length to add on the line following it */
-      if (y==curNumRows) {
+      TextRow *row;
+      long width;
+      if (y==getTextRowCount()) {
 	/* It won't insert ending \n yet */
-	addRows(y,1);
-	curRows[y]=NULL;
-	curRowLengths[y]=0;
+	if (!insertTextRows(y,1))
+	  return;
       }
-      curRowLengths[y] += len;
-      curRows[y]=realloc(curRows[y],curRowLengths[y]*sizeof(*curRows[y]));
-      memmove(curRows[y]+x+len,curRows[y]+x,(curRowLengths[y]-(x+len))*sizeof(*curRows[y]));
-      my_mbsrtowcs(curRows[y]+x,&adding,len,NULL);
-      if (curRowLengths[y]-(curRows[y][curRowLengths[y]-1]=='\n')>curNumCols)
-	curNumCols=curRowLengths[y]-(curRows[y][curRowLengths[y]-1]=='\n');
+      row=getTextRow(y);
+      if (!resizeTextRow(y,row->length+len))
+	return;
+      memmove(row->characters+x+len,row->characters+x,(row->length-(x+len))*sizeof(*row->characters));
+      my_mbsrtowcs(row->characters+x,&adding,len,NULL);
+      width=row->length-(row->characters[row->length-1]=='\n');
+      if (width>curNumCols)
+	curNumCols=width;
     }
     caretPosition(curCaret);
   } else {
@@ -1492,6 +1904,9 @@ construct_AtSpi2Screen (void) {
   }
   if (!addWatches()) goto noWatches;
 
+  dbus_connection_set_watch_functions(bus, a2AddWatch, a2RemoveWatch, a2WatchToggled, NULL, NULL);
+  dbus_connection_set_timeout_functions(bus, a2AddTimeout, a2RemoveTimeout, a2TimeoutToggled, NULL, NULL);
+
   if (!curPath) {
     initTerm();
   } else if (!reinitTerm(curSender, curPath)) {
@@ -1500,9 +1915,6 @@ construct_AtSpi2Screen (void) {
     initTerm();
   }
 
-  dbus_connection_set_watch_functions(bus, a2AddWatch, a2RemoveWatch, a2WatchToggled, NULL, NULL);
-  dbus_connection_set_timeout_functions(bus, a2AddTimeout, a2RemoveTimeout, a2TimeoutToggled, NULL, NULL);
-
 #ifdef HAVE_PKG_X11
   dpy = XOpenDisplay(NULL);
   if (dpy) {
@@ -1541,9 +1953,17 @@ destruct_AtSpi2Screen (void) {
     clipboardContent = NULL;
   }
 #endif /* HAVE_PKG_X11 */
+  stopTreeSearch();
+  cancelFocusSwitch();
   dbus_connection_remove_filter(bus, AtSpi2Filter, NULL);
   dbus_connection_close(bus);
   dbus_connection_unref(bus);
+  if (treeSearch.requests) {
+    deallocateQueue(treeSearch.requests);
+    treeSearch.requests = NULL;
+  }
+  /* Events won't be seen anymore */
+  clearObjectCache();
   logMessage(LOG_CATEGORY(SCREEN_DRIVER),
              "SPI2 stopped");
   finiTerm();
@@ -1576,7 +1996,7 @@ static void
 describe_AtSpi2Screen (ScreenDescription *description) {
   if (curPath) {
     description->cols = curPosX>=curNumCols?curPosX+1:curNumCols;
-    description->rows = curNumRows?curNumRows:1;
+    description->rows = getTextRowCount()?getTextRowCount():1;
     description->posx = curPosX;
     description->posy = curPosY;
     description->quality = curQuality;
@@ -1603,15 +2023,20 @@ readCharacters_AtSpi2Screen (const ScreenBox *box, ScreenCharacter *buffer) {
     return 1;
   }
 
-  if (!curNumCols || !curNumRows) return 0;
+  long rows = getTextRowCount();
+  if (!curNumCols || !rows) return 0;
   short cols = (curPosX >= curNumCols)? (curPosX + 1): curNumCols;
-  if (!validateScreenBox(box, cols, curNumRows)) return 0;
+  if (!validateScreenBox(box, cols, rows)) return 0;
 
   for (unsigned int y=0; y<box->height; y+=1) {
-    if (curRowLengths[box->top+y]) {
+    const TextRow *row = getTextRow(box->top+y);
+
+    if (row->length) {
+      long width = row->length - (row->characters[row->length-1]==WC_C('\n'));
+
       for (unsigned int x=0; x<box->width; x+=1) {
-        if (box->left+x < curRowLengths[box->top+y] - (curRows[box->top+y][curRowLengths[box->top+y]-1]==WC_C('\n'))) {
-          buffer[y*box->width+x].text = curRows[box->top+y][box->left+x];
+        if (box->left+x < width) {
+          buffer[y*box->width+x].text = row->characters[box->left+x];
         }
       }
     }
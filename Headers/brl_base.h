@@ -69,6 +69,30 @@ extern void makeInputTable (void);
 extern void *translateInputCells (unsigned char *target, const unsigned char *source, size_t count);
 extern unsigned char translateInputCell (unsigned char cell);
 
+typedef struct {
+  const unsigned char *header; // bytes which precede the cells
+  const unsigned char *trailer; // bytes which follow the cells
+  unsigned char headerLength;
+  unsigned char trailerLength;
+
+  unsigned char statusFirst:1; // status cells precede text cells
+  unsigned char reverseText:1; // text cells are sent right to left
+  unsigned char reverseStatus:1; // status cells are sent right to left
+  unsigned char rangeOffset:1; // the offset of the first sent text cell follows the header
+  unsigned char rangeLength:1; // the number of sent text cells follows the header (and offset)
+} BrailleCellsEncoding;
+
+extern size_t encodeBrailleCells (
+  const BrailleCellsEncoding *encoding,
+  unsigned char *buffer, size_t size,
+  const unsigned char *text, unsigned int textCount,
+  unsigned int from, unsigned int to,
+  const unsigned char *status, unsigned int statusCount
+);
+
+#define BRAILLE_CELLS_BUFFER_SIZE(encoding, textCount, statusCount) \
+  ((encoding)->headerLength + 2 + (textCount) + (statusCount) + (encoding)->trailerLength)
+
 #define MAKE_OUTPUT_TABLE(dot1, dot2, dot3, dot4, dot5, dot6, dot7, dot8) { \
   static const DotsTable dots = { \
     (dot1), (dot2), (dot3), (dot4), (dot5), (dot6), (dot7), (dot8) \
@@ -114,6 +138,45 @@ extern size_t readBraillePacket (
   BraillePacketVerifier *verifyPacket, void *data
 );
 
+typedef struct {
+  unsigned char type;
+  unsigned char length;
+  unsigned char lengthOffset;
+  unsigned char trailer;
+  unsigned hasTrailer:1;
+} BraillePacketDefinition;
+
+typedef int BraillePacketChecker (
+  BrailleDisplay *brl,
+  const unsigned char *packet, size_t length,
+  void *data
+);
+
+typedef struct {
+  const unsigned char *header;
+  unsigned char headerLength;
+
+  const BraillePacketDefinition *definitions;
+  unsigned char definitionCount;
+
+  BraillePacketChecker *checkPacket;
+} BraillePacketGrammar;
+
+#define BRAILLE_PACKET_HEADER(...) \
+  .header = (const unsigned char []){__VA_ARGS__}, \
+  .headerLength = sizeof((const unsigned char []){__VA_ARGS__})
+
+#define BRAILLE_PACKET_DEFINITIONS(table) \
+  .definitions = table, \
+  .definitionCount = ARRAY_COUNT(table)
+
+extern size_t readFramedBraillePacket (
+  BrailleDisplay *brl,
+  GioEndpoint *endpoint,
+  void *packet, size_t size,
+  const BraillePacketGrammar *grammar, void *data
+);
+
 extern int writeBraillePacket (
   BrailleDisplay *brl, GioEndpoint *endpoint,
   const void *packet, size_t size
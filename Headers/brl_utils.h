@@ -20,6 +20,7 @@
 #define BRLTTY_INCLUDED_BRL_UTILS
 
 #include "brl_types.h"
+#include "timing_types.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +46,47 @@ extern int textHasChanged (
 
 extern int cursorHasChanged (int *cursor, int new, unsigned char *force);
 
+/* Changed rows are tracked by the driver. The core (and BrlAPI) still hand
+ * it the whole window via writeWindow, and updateBrailleRows finds the rows
+ * within it which have changed since they were last written.
+ */
+typedef struct {
+  unsigned char *cells;
+
+  unsigned char hasChanged:1;
+  unsigned char isUpdating:1;
+  unsigned char force;
+
+  struct {
+    TimeValue started;
+    unsigned long int total;
+    unsigned int count;
+    unsigned int last;
+    unsigned int maximum;
+  } refresh;
+} BrailleRowEntry;
+
+typedef struct {
+  BrailleRowEntry *entries;
+  unsigned char *cells;
+  unsigned int count;
+  unsigned int columns;
+  unsigned int firstChanged;
+} BrailleRows;
+
+extern int allocateBrailleRows (BrailleRows *rows, unsigned int count, unsigned int columns);
+extern void deallocateBrailleRows (BrailleRows *rows);
+
+extern unsigned int updateBrailleRows (BrailleRows *rows, const unsigned char *cells);
+extern void setBrailleRowChanged (BrailleRows *rows, unsigned int row);
+extern void setBrailleRowsChanged (BrailleRows *rows);
+extern BrailleRowEntry *getChangedBrailleRow (BrailleRows *rows, unsigned int *row);
+
+extern void beginBrailleRowUpdate (BrailleRows *rows, unsigned int row);
+extern void endBrailleRowUpdate (BrailleRows *rows, unsigned int row);
+extern void cancelBrailleRowUpdate (BrailleRows *rows, unsigned int row);
+extern void logBrailleRowMetrics (const BrailleRows *rows);
+
 extern unsigned char toLowerDigit (unsigned char upper);
 
 typedef const unsigned char DigitsTable[11];
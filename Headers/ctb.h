@@ -50,6 +50,28 @@ extern void contractText (
   int cursorOffset /* Position of coursor in source */
 );
 
+typedef struct ContractionContextStruct ContractionContext;
+
+extern ContractionContext *newContractionContext (ContractionTable *table);
+extern void destroyContractionContext (ContractionContext *context);
+
+extern void contractTextInContext (
+  ContractionContext *context,
+  const wchar_t *inputBuffer, int *inputLength,
+  unsigned char *outputBuffer, int *outputLength,
+  int *offsetsMap, int cursorOffset
+);
+
+typedef void ContractionResultsHandler (void *data);
+extern int setContractionResultsHandler (ContractionTable *table, ContractionResultsHandler *handler, void *data);
+
+extern int canAnticipateContraction (ContractionTable *table);
+extern void anticipateContraction (
+  ContractionTable *table,
+  const wchar_t *inputBuffer, int inputLength,
+  int outputLength, int cursorOffset
+);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -33,6 +33,8 @@ extern int allocateDataItem (DataArea *area, DataOffset *offset, size_t size, si
 extern void *getDataItem (DataArea *area, DataOffset offset);
 extern size_t getDataSize (DataArea *area);
 extern int saveDataItem (DataArea *area, DataOffset *offset, const void *item, size_t size, size_t alignment);
+extern void releaseDataItems (DataArea *area, DataOffset offset);
+extern int compactDataArea (DataArea *area);
 
 #ifdef __cplusplus
 }
@@ -50,6 +50,58 @@ extern int hidReportSize (
   HidReportSize *size
 );
 
+typedef enum {
+  HID_RPT_INPUT,
+  HID_RPT_OUTPUT,
+  HID_RPT_FEATURE,
+  HID_RPT_TYPE_COUNT
+} HidReportType;
+
+typedef struct {
+  HidUnsignedValue usage; // (page << 16) | identifier
+  uint32_t bitOffset; // from the start of the report (including its identifier)
+  uint8_t bitWidth;
+  uint8_t isArray;
+
+  // array fields only - a value selects one of these usages
+  HidSignedValue logicalMinimum;
+  uint32_t usageCount;
+  const HidUnsignedValue *usageList; // NULL when the usages are a range
+} HidReportField;
+
+extern HidLayout *hidCompileLayout (const HidItemsDescriptor *items);
+extern void hidDestroyLayout (HidLayout *layout);
+
+extern int hidLayoutReportSize (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  HidReportSize *size
+);
+
+extern const HidReportField *hidGetReportFields (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  HidReportType type,
+  unsigned int *count
+);
+
+extern HidUnsignedValue hidGetReportBits (
+  const unsigned char *report, size_t size,
+  uint32_t bitOffset, unsigned char bitWidth
+);
+
+extern HidUnsignedValue hidGetFieldValue (
+  const HidReportField *field,
+  const unsigned char *report, size_t size
+);
+
+extern unsigned int hidGetActiveUsages (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  const unsigned char *report, size_t size,
+  HidUnsignedValue *usages, unsigned int limit
+);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -40,6 +40,8 @@ typedef struct {
   size_t feature;
 } HidReportSize;
 
+typedef struct HidLayoutStruct HidLayout;
+
 typedef struct {
   HidDeviceIdentifier vendorIdentifier;
   HidDeviceIdentifier productIdentifier;
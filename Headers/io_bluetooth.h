@@ -32,7 +32,8 @@ extern void bthForgetDevices (void);
 
 extern char *bthGetNameOfDevice (BluetoothConnection *connection, int timeout);
 extern char *bthGetNameAtAddress (const char *address, int timeout);
-extern const char *const *bthGetDriverCodes (const char *address, int timeout);
+extern const char **bthGetDriverCodes (const char *address, int timeout);
+extern void bthRememberDeviceDriver (const char *identifier, const char *driver);
 
 typedef struct {
   const char *driver;
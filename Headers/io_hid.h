@@ -51,6 +51,7 @@ extern int hidOpenDeviceWithParameters (
 extern void hidCloseDevice (HidDevice *device);
 
 extern const HidItemsDescriptor *hidGetItems (HidDevice *device);
+extern const HidLayout *hidGetLayout (HidDevice *device);
 
 extern int hidGetReportSize (
   HidDevice *device,
@@ -25,6 +25,7 @@ extern "C" {
 
 #undef HAVE_BUILTIN_POPCOUNT
 #undef HAVE_SYNC_SYNCHRONIZE
+#undef HAVE_SYNC_FETCH_AND_ADD
 
 #ifdef __has_builtin
 #if __has_builtin(__builtin_popcount)
@@ -34,6 +35,10 @@ extern "C" {
 #if __has_builtin(__sync_synchronize)
 #define HAVE_SYNC_SYNCHRONIZE
 #endif /* __has_builtin(__sync_synchronize) */
+
+#if __has_builtin(__sync_fetch_and_add)
+#define HAVE_SYNC_FETCH_AND_ADD
+#endif /* __has_builtin(__sync_fetch_and_add) */
 #endif /* __has_builtin */
 
 #ifndef HAVE_SYNC_SYNCHRONIZE
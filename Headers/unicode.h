@@ -79,6 +79,47 @@ extern int getCharacterByName (wchar_t *character, const char *name);
 extern int getCharacterAlias (wchar_t character, char *buffer, size_t size);
 extern int getCharacterByAlias (wchar_t *character, const char *alias);
 
+typedef enum {
+  UNICODE_CATEGORY_UNASSIGNED,
+
+  UNICODE_CATEGORY_UPPERCASE_LETTER,
+  UNICODE_CATEGORY_LOWERCASE_LETTER,
+  UNICODE_CATEGORY_TITLECASE_LETTER,
+  UNICODE_CATEGORY_MODIFIER_LETTER,
+  UNICODE_CATEGORY_OTHER_LETTER,
+
+  UNICODE_CATEGORY_NONSPACING_MARK,
+  UNICODE_CATEGORY_SPACING_MARK,
+  UNICODE_CATEGORY_ENCLOSING_MARK,
+
+  UNICODE_CATEGORY_DECIMAL_NUMBER,
+  UNICODE_CATEGORY_LETTER_NUMBER,
+  UNICODE_CATEGORY_OTHER_NUMBER,
+
+  UNICODE_CATEGORY_CONNECTOR_PUNCTUATION,
+  UNICODE_CATEGORY_DASH_PUNCTUATION,
+  UNICODE_CATEGORY_OPEN_PUNCTUATION,
+  UNICODE_CATEGORY_CLOSE_PUNCTUATION,
+  UNICODE_CATEGORY_INITIAL_PUNCTUATION,
+  UNICODE_CATEGORY_FINAL_PUNCTUATION,
+  UNICODE_CATEGORY_OTHER_PUNCTUATION,
+
+  UNICODE_CATEGORY_MATH_SYMBOL,
+  UNICODE_CATEGORY_CURRENCY_SYMBOL,
+  UNICODE_CATEGORY_MODIFIER_SYMBOL,
+  UNICODE_CATEGORY_OTHER_SYMBOL,
+
+  UNICODE_CATEGORY_SPACE_SEPARATOR,
+  UNICODE_CATEGORY_LINE_SEPARATOR,
+  UNICODE_CATEGORY_PARAGRAPH_SEPARATOR,
+
+  UNICODE_CATEGORY_CONTROL,
+  UNICODE_CATEGORY_FORMAT,
+  UNICODE_CATEGORY_SURROGATE,
+  UNICODE_CATEGORY_PRIVATE_USE
+} UnicodeCategory;
+
+extern UnicodeCategory getCharacterCategory (wchar_t character);
 extern int getCharacterWidth (wchar_t character);
 
 extern int isBrailleCharacter (wchar_t character);
@@ -177,7 +177,7 @@ compileAttributesTable (const char *name) {
         };
 
         if (processDataFile(name, &parameters)) {
-          if (makeAttributesToDots(&atd)) {
+          if (makeAttributesToDots(&atd) && compactDataArea(atd.area)) {
             if ((table = malloc(sizeof(*table)))) {
               table->header.fields = getAttributesTableHeader(&atd);
               table->size = getDataSize(atd.area);
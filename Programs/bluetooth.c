@@ -20,6 +20,8 @@
 
 #include <string.h>
 #include <errno.h>
+#include <ctype.h>
+#include <time.h>
 
 #include "log.h"
 #include "strfmt.h"
@@ -29,6 +31,11 @@
 #include "parse.h"
 #include "device.h"
 #include "queue.h"
+#include "file.h"
+#include "datafile.h"
+#include "thread.h"
+#include "async_event.h"
+#include "async_task.h"
 #include "io_bluetooth.h"
 #include "bluetooth_internal.h"
 
@@ -64,12 +71,22 @@ typedef struct {
   char *name;
   int error;
   unsigned paired:1;
+  unsigned refreshing:1;
+
+  // remembered (in the device cache file) from the last successful connection
+  char *driver;
+  time_t connected;
+  uint8_t channel;
+
+  // when the name was last obtained (it's refreshed when this gets old)
+  time_t named;
 } BluetoothDeviceEntry;
 
 static void
 bthDeallocateDeviceEntry (void *item, void *data) {
   BluetoothDeviceEntry *device = item;
 
+  if (device->driver) free(device->driver);
   if (device->name) free(device->name);
   free(device);
 }
@@ -95,8 +112,13 @@ bthTestDeviceAddress (const void *item, void *data) {
   return device->address == *address;
 }
 
+static const char bluetoothDeviceCacheFile[] = "bluetooth-devices";
+static int bluetoothDeviceCacheLoaded = 0;
+static void bthLoadDeviceCache (void);
+
 static BluetoothDeviceEntry *
 bthGetDeviceEntry (uint64_t address, int add) {
+  bthLoadDeviceCache();
   Queue *devices = bthGetDeviceQueue(add);
 
   if (devices) {
@@ -105,6 +127,7 @@ bthGetDeviceEntry (uint64_t address, int add) {
 
     if (add) {
       if ((device = malloc(sizeof(*device)))) {
+        memset(device, 0, sizeof(*device));
         device->address = address;
         device->name = NULL;
         device->error = 0;
@@ -178,6 +201,7 @@ bthForgetDevices (void) {
 
   if (devices) deleteElements(devices);
   bluetoothDevicesDiscovered = 0;
+  bluetoothDeviceCacheLoaded = 0;
 }
 
 static int
@@ -199,6 +223,146 @@ bthRecallConnectError (uint64_t address, int *value) {
   return 1;
 }
 
+static int
+bthSetDeviceDriver (BluetoothDeviceEntry *device, const char *driver) {
+  if (!driver) return 1;
+  if (device->driver && (strcmp(device->driver, driver) == 0)) return 1;
+
+  char *copy = strdup(driver);
+
+  if (!copy) {
+    logMallocError();
+    return 0;
+  }
+
+  if (device->driver) free(device->driver);
+  device->driver = copy;
+  return 1;
+}
+
+static int
+bthLoadCachedDevice (const LineHandlerParameters *parameters) {
+  const char *line = parameters->line.text;
+  while (isspace(*line)) line += 1;
+  if (!*line || (*line == '#')) return 1;
+
+  uint64_t address;
+  unsigned int channel;
+  long int connected;
+  char driver[0X20];
+  int length;
+
+  int count = sscanf(
+    line, "%" SCNx64 " %u %ld %31s %n",
+    &address, &channel, &connected, driver, &length
+  );
+
+  if ((count < 4) || (channel > UINT8_MAX)) {
+    logMessage(LOG_WARNING,
+      "invalid bluetooth device cache entry: %s[%u]",
+      bluetoothDeviceCacheFile, parameters->line.number
+    );
+
+    return 1;
+  }
+
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 1);
+
+  if (device) {
+    device->channel = channel;
+    device->connected = connected;
+    device->named = connected;
+    if (strcmp(driver, "-") != 0) bthSetDeviceDriver(device, driver);
+    bthSetDeviceName(device, &line[length]);
+  }
+
+  return 1;
+}
+
+static void
+bthLoadDeviceCache (void) {
+  if (!bluetoothDeviceCacheLoaded) {
+    bluetoothDeviceCacheLoaded = 1;
+    char *path = makeUpdatablePath(bluetoothDeviceCacheFile);
+
+    if (path) {
+      FILE *file = openDataFile(path, "r", 1);
+
+      if (file) {
+        logMessage(LOG_CATEGORY(BLUETOOTH_IO), "loading device cache: %s", path);
+        processLines(file, bthLoadCachedDevice, NULL);
+        fclose(file);
+      }
+
+      free(path);
+    }
+  }
+}
+
+static int
+bthSaveCachedDevice (const void *item, void *data) {
+  const BluetoothDeviceEntry *device = item;
+  FILE *file = data;
+
+  if (device->connected) {
+    fprintf(file,
+      "%012" PRIX64 " %u %ld %s%s%s\n",
+      device->address, device->channel, (long int)device->connected,
+      (device->driver? device->driver: "-"),
+      (device->name? " ": ""), (device->name? device->name: "")
+    );
+  }
+
+  return ferror(file);
+}
+
+static void
+bthSaveDeviceCache (void) {
+  Queue *devices = bthGetDeviceQueue(0);
+  if (!devices) return;
+
+  char *path = makeUpdatablePath(bluetoothDeviceCacheFile);
+
+  if (path) {
+    FILE *file = openDataFile(path, "w", 0);
+
+    if (file) {
+      fprintf(file, "# address channel connected driver name\n");
+      findItem(devices, bthSaveCachedDevice, file);
+
+      if (ferror(file)) {
+        logMessage(LOG_WARNING, "cannot write bluetooth device cache: %s", path);
+      }
+
+      fclose(file);
+    }
+
+    free(path);
+  }
+}
+
+static void
+bthRememberConnection (uint64_t address, uint8_t channel) {
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 1);
+
+  if (device) {
+    device->error = 0;
+    device->channel = channel;
+    device->connected = time(NULL);
+    bthSaveDeviceCache();
+  }
+}
+
+static int
+bthRecallChannel (uint64_t address, uint8_t *channel) {
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+  if (!device) return 0;
+  if (!device->channel) return 0;
+
+  *channel = device->channel;
+  return 1;
+}
+
 void
 bthInitializeConnectionRequest (BluetoothConnectionRequest *request) {
   memset(request, 0, sizeof(*request));
@@ -497,6 +661,19 @@ bthApplyParameters (BluetoothConnectionRequest *request, const char *identifier)
   return ok;
 }
 
+static int
+bthConnectChannel (BluetoothConnection *connection, int timeout) {
+  TimePeriod period;
+  startTimePeriod(&period, BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT);
+
+  while (1) {
+    if (bthOpenChannel(connection->extension, connection->channel, timeout)) return 1;
+    if (afterTimePeriod(&period, NULL)) return 0;
+    if (errno != EBUSY) return 0;
+    asyncWait(BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL);
+  }
+}
+
 BluetoothConnection *
 bthOpenConnection (const BluetoothConnectionRequest *request) {
   BluetoothConnection *connection;
@@ -519,21 +696,29 @@ bthOpenConnection (const BluetoothConnectionRequest *request) {
       }
 
       if (!alreadyTried) {
-        if (request->discover) bthDiscoverSerialPortChannel(&connection->channel, connection->extension, request->timeout);
-        bthLogChannel(connection->channel);
+        uint8_t cachedChannel = 0;
 
-        {
-          TimePeriod period;
-          startTimePeriod(&period, BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT);
+        if (request->discover) {
+          if (bthRecallChannel(connection->address, &cachedChannel)) {
+            logMessage(LOG_CATEGORY(BLUETOOTH_IO), "trying cached channel");
+            connection->channel = cachedChannel;
+            bthLogChannel(connection->channel);
 
-          while (1) {
-            if (bthOpenChannel(connection->extension, connection->channel, request->timeout)) {
+            if (bthConnectChannel(connection, request->timeout)) {
+              bthRememberConnection(connection->address, connection->channel);
               return connection;
             }
+          }
+
+          bthDiscoverSerialPortChannel(&connection->channel, connection->extension, request->timeout);
+        }
 
-            if (afterTimePeriod(&period, NULL)) break;
-            if (errno != EBUSY) break;
-            asyncWait(BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL);
+        if (!cachedChannel || (connection->channel != cachedChannel)) {
+          bthLogChannel(connection->channel);
+
+          if (bthConnectChannel(connection, request->timeout)) {
+            bthRememberConnection(connection->address, connection->channel);
+            return connection;
           }
         }
 
@@ -627,8 +812,102 @@ bthWriteData (BluetoothConnection *connection, const void *buffer, size_t size)
   return bthPutData(connection->extension, buffer, size);
 }
 
+#ifdef GOT_PTHREADS
+typedef struct {
+  AsyncEvent *event;
+  uint64_t address;
+  int timeout;
+  char *name;
+} DeviceNameRefresh;
+
+ASYNC_TASK_CALLBACK(bthFinishDeviceNameRefresh) {
+  DeviceNameRefresh *dnr = data;
+  BluetoothDeviceEntry *device = bthGetDeviceEntry(dnr->address, 0);
+
+  if (device) {
+    device->refreshing = 0;
+    device->named = time(NULL);
+
+    if (dnr->name) {
+      if (!device->name || (strcmp(device->name, dnr->name) != 0)) {
+        logMessage(LOG_CATEGORY(BLUETOOTH_IO), "device name refreshed: %s", dnr->name);
+        bthSetDeviceName(device, dnr->name);
+        bthSaveDeviceCache();
+      }
+    }
+  }
+
+  asyncDiscardEvent(dnr->event);
+  if (dnr->name) free(dnr->name);
+  free(dnr);
+}
+
+THREAD_FUNCTION(bthRunDeviceNameRefresh) {
+  DeviceNameRefresh *dnr = argument;
+
+  dnr->name = bthObtainDeviceName(dnr->address, dnr->timeout);
+  if (!asyncAddTask(dnr->event, bthFinishDeviceNameRefresh, dnr)) {
+    if (dnr->name) free(dnr->name);
+    free(dnr);
+  }
+
+  return NULL;
+}
+#endif /* GOT_PTHREADS */
+
+static void
+bthRefreshDeviceName (BluetoothDeviceEntry *device, int timeout) {
+#ifdef GOT_PTHREADS
+  if (device->refreshing) return;
+  if ((time(NULL) - device->named) < BLUETOOTH_DEVICE_NAME_REFRESH_AGE) return;
+
+  DeviceNameRefresh *dnr;
+
+  if ((dnr = malloc(sizeof(*dnr)))) {
+    memset(dnr, 0, sizeof(*dnr));
+    dnr->address = device->address;
+    dnr->timeout = timeout;
+
+    if ((dnr->event = asyncNewAddTaskEvent())) {
+      pthread_t thread;
+      pthread_attr_t attributes;
+
+      pthread_attr_init(&attributes);
+      pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_DETACHED);
+
+      int error = createThread(
+        "bluetooth-name", &thread, &attributes,
+        bthRunDeviceNameRefresh, dnr
+      );
+
+      if (!error) {
+        device->refreshing = 1;
+        return;
+      }
+
+      logActionError(error, "pthread_create");
+      asyncDiscardEvent(dnr->event);
+    }
+
+    free(dnr);
+  } else {
+    logMallocError();
+  }
+#endif /* GOT_PTHREADS */
+}
+
 static char *
 bthGetDeviceName (uint64_t address, int timeout) {
+  {
+    BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+
+    if (device && device->name && device->connected) {
+      logMessage(LOG_CATEGORY(BLUETOOTH_IO), "cached device name: %s", device->name);
+      bthRefreshDeviceName(device, timeout);
+      return device->name;
+    }
+  }
+
   bthDiscoverDevices();
   BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 1);
 
@@ -637,6 +916,7 @@ bthGetDeviceName (uint64_t address, int timeout) {
       logMessage(LOG_CATEGORY(BLUETOOTH_IO), "obtaining device name");
 
       if ((device->name = bthObtainDeviceName(address, timeout))) {
+        device->named = time(NULL);
         logMessage(LOG_CATEGORY(BLUETOOTH_IO), "device name: %s", device->name);
       } else {
         logMessage(LOG_CATEGORY(BLUETOOTH_IO), "device name not obtained");
@@ -760,9 +1040,53 @@ failure:
   return noDriverCodes;
 }
 
-const char *const *
+static const char **
+bthMakeDriverCodes (const char *driver, const char *const *codes) {
+  unsigned int count = 1;
+  size_t size = 0;
+
+  if (driver) {
+    count += 1;
+    size = strlen(driver) + 1;
+  }
+
+  if (codes) {
+    const char *const *code = codes;
+    while (*code++) count += 1;
+  }
+
+  // the driver code is copied after the pointers so that one free() suffices
+  const char **array = malloc(ARRAY_SIZE(array, count) + size);
+
+  if (!array) {
+    logMallocError();
+    return NULL;
+  }
+
+  const char **next = array;
+
+  if (driver) {
+    // the driver that last connected is tried first
+    char *copy = (char *)&array[count];
+    memcpy(copy, driver, size);
+    *next++ = copy;
+  }
+
+  if (codes) {
+    while (*codes) {
+      if (!driver || (strcmp(*codes, driver) != 0)) *next++ = *codes;
+      codes += 1;
+    }
+  }
+
+  *next = NULL;
+  return array;
+}
+
+const char **
 bthGetDriverCodes (const char *identifier, int timeout) {
   const char *const *codes = NULL;
+  const char *driver = NULL;
   char **parameters = bthGetDeviceParameters(identifier);
 
   if (parameters) {
@@ -772,13 +1096,39 @@ bthGetDriverCodes (const char *identifier, int timeout) {
       const char *name = bthGetDeviceName(address, timeout);
       const BluetoothNameEntry *entry = bthGetNameEntry(name);
       if (entry) codes = entry->driverCodes;
+
+      {
+        BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+        if (device) driver = device->driver;
+      }
     }
 
     deallocateStrings(parameters);
   }
 
   if (!codes) codes = bthGetAllDriverCodes();
-  return codes;
+  return bthMakeDriverCodes(driver, codes);
+}
+
+void
+bthRememberDeviceDriver (const char *identifier, const char *driver) {
+  char **parameters = bthGetDeviceParameters(identifier);
+
+  if (parameters) {
+    uint64_t address;
+
+    if (bthGetDeviceAddress(&address, parameters, NULL)) {
+      BluetoothDeviceEntry *device = bthGetDeviceEntry(address, 0);
+
+      if (device && device->connected) {
+        if (!device->driver || (strcmp(device->driver, driver) != 0)) {
+          if (bthSetDeviceDriver(device, driver)) bthSaveDeviceCache();
+        }
+      }
+    }
+
+    deallocateStrings(parameters);
+  }
 }
 
 int
@@ -21,6 +21,20 @@
 #include <string.h>
 #include <errno.h>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* the default build doesn't target SSSE3 so it's checked for at run time */
+#include <tmmintrin.h>
+#define VECTOR_OUTPUT_TRANSLATION
+#define VECTOR_OUTPUT_SSSE3
+#define VECTOR_OUTPUT_FUNCTION __attribute__((target("ssse3")))
+#define canTranslateOutputVectors() __builtin_cpu_supports("ssse3")
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VECTOR_OUTPUT_TRANSLATION
+#define VECTOR_OUTPUT_FUNCTION
+#define canTranslateOutputVectors() 1
+#endif /* vector output translation */
+
 #include "log.h"
 #include "report.h"
 #include "api_control.h"
@@ -92,23 +106,98 @@ translateCell (const TranslationTable table, unsigned char cell) {
 static TranslationTable internalOutputTable;
 static const unsigned char *outputTable;
 
+#ifdef VECTOR_OUTPUT_TRANSLATION
+/* A table made from a dots table maps each dot independently, so a cell's
+ * translation is the OR of the translations of its two nibbles - two
+ * sixteen-entry lookups which a single vector shuffle can do for 16 cells.
+ * Tables given to setOutputTable may be arbitrary (and may even be modified
+ * later by the driver), so they always take the scalar path.
+ */
+static unsigned char outputNibbles[2][0X10];
+static unsigned char outputNibblesActive = 0;
+
+static void
+makeOutputNibbles (void) {
+  for (unsigned int nibble=0; nibble<0X10; nibble+=1) {
+    outputNibbles[0][nibble] = outputTable[nibble];
+    outputNibbles[1][nibble] = outputTable[nibble << 4];
+  }
+
+  outputNibblesActive = canTranslateOutputVectors();
+}
+
+VECTOR_OUTPUT_FUNCTION
+static size_t
+translateOutputVectors (unsigned char *target, const unsigned char *source, size_t count) {
+  size_t done = 0;
+
+#if defined(VECTOR_OUTPUT_SSSE3)
+  const __m128i low = _mm_loadu_si128((const __m128i *)outputNibbles[0]);
+  const __m128i high = _mm_loadu_si128((const __m128i *)outputNibbles[1]);
+  const __m128i mask = _mm_set1_epi8(0X0F);
+
+  while ((count - done) >= 0X10) {
+    __m128i cells = _mm_loadu_si128((const __m128i *)&source[done]);
+    __m128i lowDots = _mm_shuffle_epi8(low, _mm_and_si128(cells, mask));
+    __m128i highDots = _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(cells, 4), mask));
+
+    _mm_storeu_si128((__m128i *)&target[done], _mm_or_si128(lowDots, highDots));
+    done += 0X10;
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint8x16_t low = vld1q_u8(outputNibbles[0]);
+  const uint8x16_t high = vld1q_u8(outputNibbles[1]);
+  const uint8x16_t mask = vdupq_n_u8(0X0F);
+
+  while ((count - done) >= 0X10) {
+    uint8x16_t cells = vld1q_u8(&source[done]);
+    uint8x16_t lowDots = vqtbl1q_u8(low, vandq_u8(cells, mask));
+    uint8x16_t highDots = vqtbl1q_u8(high, vshrq_n_u8(cells, 4));
+
+    vst1q_u8(&target[done], vorrq_u8(lowDots, highDots));
+    done += 0X10;
+  }
+#endif /* vector output translation */
+
+  return done;
+}
+#endif /* VECTOR_OUTPUT_TRANSLATION */
+
 void
 setOutputTable (const TranslationTable table) {
   outputTable = table;
+
+#ifdef VECTOR_OUTPUT_TRANSLATION
+  outputNibblesActive = 0;
+#endif /* VECTOR_OUTPUT_TRANSLATION */
 }
 
 void
 makeOutputTable (const DotsTable dots) {
   if (memcmp(dots, dotsTable_ISO11548_1, DOTS_TABLE_SIZE) == 0) {
-    outputTable = NULL;
+    setOutputTable(NULL);
   } else {
     makeTranslationTable(dots, internalOutputTable);
-    outputTable = internalOutputTable;
+    setOutputTable(internalOutputTable);
+
+#ifdef VECTOR_OUTPUT_TRANSLATION
+    makeOutputNibbles();
+#endif /* VECTOR_OUTPUT_TRANSLATION */
   }
 }
 
 void *
 translateOutputCells (unsigned char *target, const unsigned char *source, size_t count) {
+#ifdef VECTOR_OUTPUT_TRANSLATION
+  if (outputNibblesActive) {
+    size_t done = translateOutputVectors(target, source, count);
+
+    target += done;
+    source += done;
+    count -= done;
+  }
+#endif /* VECTOR_OUTPUT_TRANSLATION */
+
   return translateCells(outputTable, target, source, count);
 }
 
@@ -117,6 +206,73 @@ translateOutputCell (unsigned char cell) {
   return translateCell(outputTable, cell);
 }
 
+static unsigned char *
+encodeCells (unsigned char *target, const unsigned char *source, size_t count, int reverse) {
+  unsigned char *end = translateOutputCells(target, source, count);
+
+  if (reverse) {
+    unsigned char *left = target;
+    unsigned char *right = end;
+
+    while (left < --right) {
+      unsigned char cell = *left;
+      *left++ = *right;
+      *right = cell;
+    }
+  }
+
+  return end;
+}
+
+size_t
+encodeBrailleCells (
+  const BrailleCellsEncoding *encoding,
+  unsigned char *buffer, size_t size,
+  const unsigned char *text, unsigned int textCount,
+  unsigned int from, unsigned int to,
+  const unsigned char *status, unsigned int statusCount
+) {
+  unsigned int count = to - from;
+
+  if (encoding->rangeOffset || encoding->rangeLength) {
+    /* the offset and the length are each sent as a single byte */
+    if (textCount > UINT8_MAX) {
+      logMessage(LOG_WARNING, "too many braille cells for a range: %u > %u", textCount, UINT8_MAX);
+      return 0;
+    }
+  }
+
+  {
+    size_t needed = encoding->headerLength + count + statusCount + encoding->trailerLength;
+    if (encoding->rangeOffset) needed += 1;
+    if (encoding->rangeLength) needed += 1;
+
+    if (needed > size) {
+      logMessage(LOG_WARNING, "braille cells buffer too small: %"PRIsize " < %"PRIsize, size, needed);
+      return 0;
+    }
+  }
+
+  unsigned char *byte = buffer;
+  if (encoding->header) byte = mempcpy(byte, encoding->header, encoding->headerLength);
+
+  if (encoding->rangeOffset) *byte++ = encoding->reverseText? (textCount - to): from;
+  if (encoding->rangeLength) *byte++ = count;
+
+  if (status && encoding->statusFirst) {
+    byte = encodeCells(byte, status, statusCount, encoding->reverseStatus);
+  }
+
+  byte = encodeCells(byte, &text[from], count, encoding->reverseText);
+
+  if (status && !encoding->statusFirst) {
+    byte = encodeCells(byte, status, statusCount, encoding->reverseStatus);
+  }
+
+  if (encoding->trailer) byte = mempcpy(byte, encoding->trailer, encoding->trailerLength);
+  return byte - buffer;
+}
+
 static TranslationTable internalInputTable;
 static const unsigned char *inputTable;
 
@@ -246,6 +402,143 @@ readBraillePacket (
   }
 }
 
+typedef enum {
+  BRL_PFS_INVALID,
+  BRL_PFS_INCOMPLETE,
+  BRL_PFS_COMPLETE
+} BraillePacketFrameStatus;
+
+static const BraillePacketDefinition *
+getBraillePacketDefinition (const BraillePacketGrammar *grammar, unsigned char type) {
+  const BraillePacketDefinition *definition = grammar->definitions;
+  const BraillePacketDefinition *end = definition + grammar->definitionCount;
+
+  while (definition < end) {
+    if (definition->type == type) return definition;
+    definition += 1;
+  }
+
+  return NULL;
+}
+
+static int
+canStartBraillePacket (const BraillePacketGrammar *grammar, unsigned char byte) {
+  if (grammar->headerLength) return byte == grammar->header[0];
+  return !!getBraillePacketDefinition(grammar, byte);
+}
+
+static BraillePacketFrameStatus
+examineBraillePacketFrame (
+  BrailleDisplay *brl, const BraillePacketGrammar *grammar,
+  const unsigned char *bytes, size_t count,
+  size_t *length, void *data
+) {
+  size_t typeOffset = grammar->headerLength;
+
+  if (typeOffset) {
+    if (memcmp(bytes, grammar->header, MIN(count, typeOffset)) != 0) return BRL_PFS_INVALID;
+  }
+
+  if (count <= typeOffset) {
+    *length = typeOffset + 1;
+    return BRL_PFS_INCOMPLETE;
+  }
+
+  const BraillePacketDefinition *definition = getBraillePacketDefinition(grammar, bytes[typeOffset]);
+  if (!definition) return BRL_PFS_INVALID;
+  *length = definition->length;
+
+  if (definition->lengthOffset) {
+    if (count <= definition->lengthOffset) {
+      *length = definition->lengthOffset + 1;
+      return BRL_PFS_INCOMPLETE;
+    }
+
+    *length += bytes[definition->lengthOffset];
+  }
+
+  if (count < *length) return BRL_PFS_INCOMPLETE;
+  if (definition->hasTrailer && (bytes[*length - 1] != definition->trailer)) return BRL_PFS_INVALID;
+  if (grammar->checkPacket && !grammar->checkPacket(brl, bytes, *length, data)) return BRL_PFS_INVALID;
+  return BRL_PFS_COMPLETE;
+}
+
+static int
+discardBraillePacketBytes (GioEndpoint *endpoint, size_t count) {
+  while (count) {
+    unsigned char buffer[0X40];
+    ssize_t result = gioReadData(endpoint, buffer, MIN(count, sizeof(buffer)), 1);
+
+    if (result <= 0) return 0;
+    logDiscardedBytes(buffer, result);
+    count -= result;
+  }
+
+  return 1;
+}
+
+size_t
+readFramedBraillePacket (
+  BrailleDisplay *brl,
+  GioEndpoint *endpoint,
+  void *packet, size_t size,
+  const BraillePacketGrammar *grammar, void *data
+) {
+  if (!endpoint) endpoint = brl->gioEndpoint;
+
+  unsigned char *bytes = packet;
+  size_t count = 0;
+
+  while (1) {
+    size_t length;
+
+    switch (examineBraillePacketFrame(brl, grammar, bytes, count, &length, data)) {
+      case BRL_PFS_COMPLETE:
+        logInputPacket(bytes, length);
+        return length;
+
+      case BRL_PFS_INCOMPLETE: {
+        if (length > size) {
+          logTruncatedPacket(bytes, count);
+          if (!discardBraillePacketBytes(endpoint, (length - count))) return 0;
+          count = 0;
+          continue;
+        }
+
+        ssize_t result = gioReadData(endpoint, &bytes[count], (length - count), (count > 0));
+        if (result < 0) break;
+        count += result;
+
+        if (count < length) {
+          errno = EAGAIN;
+          break;
+        }
+
+        continue;
+      }
+
+      default:
+      case BRL_PFS_INVALID: {
+        size_t skip = 1;
+
+        while ((skip < count) && !canStartBraillePacket(grammar, bytes[skip])) skip += 1;
+
+        if (skip == 1) {
+          logIgnoredByte(bytes[0]);
+        } else {
+          logShortPacket(bytes, skip);
+        }
+
+        memmove(bytes, &bytes[skip], (count -= skip));
+        continue;
+      }
+    }
+
+    if (count > 0) logPartialPacket(bytes, count);
+    return 0;
+  }
+}
+
 int
 writeBraillePacket (
   BrailleDisplay *brl, GioEndpoint *endpoint,
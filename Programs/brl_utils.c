@@ -26,6 +26,7 @@
 #include "brl_utils.h"
 #include "brl_dots.h"
 #include "async_wait.h"
+#include "timing.h"
 #include "ktb.h"
 
 void
@@ -157,6 +158,147 @@ cursorHasChanged (int *cursor, int new, unsigned char *force) {
   return 1;
 }
 
+int
+allocateBrailleRows (BrailleRows *rows, unsigned int count, unsigned int columns) {
+  memset(rows, 0, sizeof(*rows));
+
+  if ((rows->entries = malloc(ARRAY_SIZE(rows->entries, count)))) {
+    if ((rows->cells = malloc(count * columns))) {
+      memset(rows->entries, 0, ARRAY_SIZE(rows->entries, count));
+      memset(rows->cells, 0, count * columns);
+
+      rows->count = count;
+      rows->columns = columns;
+      rows->firstChanged = count;
+
+      for (unsigned int row=0; row<count; row+=1) {
+        BrailleRowEntry *entry = &rows->entries[row];
+
+        entry->cells = &rows->cells[row * columns];
+        entry->force = 1;
+      }
+
+      return 1;
+    }
+
+    free(rows->entries);
+    rows->entries = NULL;
+  }
+
+  logMallocError();
+  return 0;
+}
+
+void
+deallocateBrailleRows (BrailleRows *rows) {
+  if (rows->cells) {
+    free(rows->cells);
+    rows->cells = NULL;
+  }
+
+  if (rows->entries) {
+    free(rows->entries);
+    rows->entries = NULL;
+  }
+
+  rows->count = 0;
+}
+
+unsigned int
+updateBrailleRows (BrailleRows *rows, const unsigned char *cells) {
+  unsigned int changed = 0;
+
+  for (unsigned int row=0; row<rows->count; row+=1) {
+    BrailleRowEntry *entry = &rows->entries[row];
+
+    if (cellsHaveChanged(entry->cells, cells, rows->columns, NULL, NULL, &entry->force)) {
+      setBrailleRowChanged(rows, row);
+      changed += 1;
+    }
+
+    cells += rows->columns;
+  }
+
+  return changed;
+}
+
+void
+setBrailleRowChanged (BrailleRows *rows, unsigned int row) {
+  rows->entries[row].hasChanged = 1;
+  if (row < rows->firstChanged) rows->firstChanged = row;
+}
+
+void
+setBrailleRowsChanged (BrailleRows *rows) {
+  for (unsigned int row=0; row<rows->count; row+=1) {
+    setBrailleRowChanged(rows, row);
+  }
+}
+
+BrailleRowEntry *
+getChangedBrailleRow (BrailleRows *rows, unsigned int *row) {
+  while (rows->firstChanged < rows->count) {
+    BrailleRowEntry *entry = &rows->entries[rows->firstChanged];
+
+    if (entry->hasChanged) {
+      *row = rows->firstChanged;
+      return entry;
+    }
+
+    rows->firstChanged += 1;
+  }
+
+  return NULL;
+}
+
+void
+beginBrailleRowUpdate (BrailleRows *rows, unsigned int row) {
+  BrailleRowEntry *entry = &rows->entries[row];
+
+  entry->hasChanged = 0;
+  entry->isUpdating = 1;
+  getMonotonicTime(&entry->refresh.started);
+}
+
+void
+endBrailleRowUpdate (BrailleRows *rows, unsigned int row) {
+  BrailleRowEntry *entry = &rows->entries[row];
+
+  if (entry->isUpdating) {
+    unsigned int time = getMonotonicElapsed(&entry->refresh.started);
+
+    entry->isUpdating = 0;
+    entry->refresh.last = time;
+    entry->refresh.total += time;
+    entry->refresh.count += 1;
+    if (time > entry->refresh.maximum) entry->refresh.maximum = time;
+
+    logMessage(LOG_CATEGORY(BRAILLE_DRIVER),
+      "row refreshed: Row:%u Time:%u", row, time
+    );
+  }
+}
+
+void
+cancelBrailleRowUpdate (BrailleRows *rows, unsigned int row) {
+  rows->entries[row].isUpdating = 0;
+}
+
+void
+logBrailleRowMetrics (const BrailleRows *rows) {
+  for (unsigned int row=0; row<rows->count; row+=1) {
+    const BrailleRowEntry *entry = &rows->entries[row];
+    unsigned int count = entry->refresh.count;
+
+    if (count) {
+      logMessage(LOG_CATEGORY(BRAILLE_DRIVER),
+        "row refresh times: Row:%u Count:%u Average:%lu Maximum:%u",
+        row, count, (entry->refresh.total / count), entry->refresh.maximum
+      );
+    }
+  }
+}
+
 unsigned char
 toLowerDigit (unsigned char upper) {
   unsigned char lower = 0;
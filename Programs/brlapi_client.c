@@ -54,6 +54,7 @@
 #else /* __MINGW32__ */
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <sys/mman.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -267,6 +268,19 @@ struct brlapi_handle_t { /* Connection-specific information */
   size_t altSize;
   ssize_t *altRes;
   sem_t *altSem;
+#ifndef __MINGW32__
+  /* file descriptor which came with the last awaited packet, or -1 */
+  int receivedDescriptor;
+  /* whether the reader should read ahead into packetBuffer */
+  int readAhead;
+  unsigned char packetBuffer[BRLAPI_HEADERSIZE + BRLAPI_MAXPACKETSIZE];
+#endif /* __MINGW32__ */
+#ifdef HAVE_MEMFD_CREATE
+  /* memory window shared with the server for display writes, or NULL */
+  brlapi_sharedWindowHeader_t *sharedWindow;
+  size_t sharedWindowSize;
+  int sharedWindowCursor;
+#endif /* HAVE_MEMFD_CREATE */
   int state;
   pthread_mutex_t state_mutex;
 
@@ -337,6 +351,14 @@ static void brlapi_initializeHandle(brlapi_handle_t *handle)
   handle->altSize = 0;
   handle->altRes = NULL;
   handle->altSem = NULL;
+#ifndef __MINGW32__
+  handle->receivedDescriptor = -1;
+  handle->readAhead = 0;
+#endif /* __MINGW32__ */
+#ifdef HAVE_MEMFD_CREATE
+  handle->sharedWindow = NULL;
+  handle->sharedWindowSize = 0;
+#endif /* HAVE_MEMFD_CREATE */
   handle->state = 0;
   pthread_mutex_init(&handle->state_mutex, NULL);
 
@@ -365,6 +387,49 @@ static void brlapi_initializeHandle(brlapi_handle_t *handle)
   handle->clientData = NULL;
 }
 
+#ifndef __MINGW32__
+/* brlapi_hasBufferedPacketData */
+/* Tells whether data has already been received but not parsed yet, */
+/* in which case the descriptor won't show that it can be read */
+static int brlapi_hasBufferedPacketData(const Packet *packet)
+{
+  return packet->bufferStart < packet->bufferEnd;
+}
+
+/* brlapi_setPacketBuffer */
+/* Lets readPacket read all the available data at once into the given buffer */
+/* and then parse packets out of it, or go back to reading piecewise (NULL) */
+static void brlapi_setPacketBuffer(Packet *packet, unsigned char *buffer, size_t size)
+{
+  packet->buffer = buffer;
+  packet->bufferSize = size;
+  packet->bufferStart = packet->bufferEnd = 0;
+}
+
+/* brlapi__keepReceivedDescriptor */
+/* Keeps the file descriptor which came with the awaited packet so that the */
+/* requester can claim it: must be called with read_mutex locked */
+static void brlapi__keepReceivedDescriptor(brlapi_handle_t *handle)
+{
+  if (handle->receivedDescriptor != -1) close(handle->receivedDescriptor);
+  handle->receivedDescriptor = brlapi_takePacketDescriptor(&handle->packet);
+}
+
+/* brlapi__takeReceivedDescriptor */
+/* Claims the file descriptor which came with the awaited packet, or -1 */
+static int brlapi__takeReceivedDescriptor(brlapi_handle_t *handle)
+{
+  int descriptor;
+
+  pthread_mutex_lock(&handle->read_mutex);
+  descriptor = handle->receivedDescriptor;
+  handle->receivedDescriptor = -1;
+  pthread_mutex_unlock(&handle->read_mutex);
+
+  return descriptor;
+}
+#endif /* __MINGW32__ */
+
 /* brlapi_doWaitForPacket */
 /* Waits for the specified type of packet: must be called with brlapi_req_mutex locked */
 /* deadline can be used to stop waiting after a given date, or wait forever (NULL) */
@@ -415,7 +480,10 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
     pollfd.events = POLLIN;
     pollfd.revents = 0;
 
-    if (poll(&pollfd, 1, deadline ? delay : -1) < 0) {
+    if (brlapi_hasBufferedPacketData(&handle->packet)) {
+      /* it has already been received */
+      pollfd.revents = POLLIN;
+    } else if (poll(&pollfd, 1, deadline ? delay : -1) < 0) {
       LibcError("waiting for packet");
       return -2;
     }
@@ -432,7 +500,9 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
 
     FD_ZERO(&sockset);
     FD_SET(handle->fileDescriptor, &sockset);
-    if (select(handle->fileDescriptor+1, &sockset, NULL, NULL, ptimeout) < 0) {
+    if (brlapi_hasBufferedPacketData(&handle->packet)) {
+      /* it has already been received, leave it set */
+    } else if (select(handle->fileDescriptor+1, &sockset, NULL, NULL, ptimeout) < 0) {
       LibcError("waiting for packet");
       return -2;
     }
@@ -461,6 +531,13 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
   {
     /* For us, just copy */
     memcpy(packet, handle->packet.content, MIN(packetSize, size));
+#ifndef __MINGW32__
+    if (type == BRLAPI_PACKET_PARAM_VALUE) {
+      pthread_mutex_lock(&handle->read_mutex);
+      brlapi__keepReceivedDescriptor(handle);
+      pthread_mutex_unlock(&handle->read_mutex);
+    }
+#endif /* __MINGW32__ */
     return size;
   }
 
@@ -469,6 +546,9 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
   if (handle->altSem && type==handle->altExpectedPacketType) {
     /* Yes, put packet content there */
     memcpy(handle->altPacket, handle->packet.content, MIN(handle->altSize, size));
+#ifndef __MINGW32__
+    if (type == BRLAPI_PACKET_PARAM_VALUE) brlapi__keepReceivedDescriptor(handle);
+#endif /* __MINGW32__ */
     *handle->altRes = size;
 #ifndef WINDOWS
     if (sem_post)
@@ -490,6 +570,25 @@ static ssize_t brlapi__doWaitForPacket(brlapi_handle_t *handle, brlapi_packetTyp
     pthread_mutex_unlock(&handle->read_mutex);
     return -3;
   }
+  if ((type==BRLAPI_PACKET_KEYS) && (handle->state & STCONTROLLINGTTY) && !(size % sizeof(brlapi_keyCode_t))) {
+    /* several keypresses, buffer them all */
+    uint32_t *keyPacket = uint32Packet;
+    const uint32_t *end = uint32Packet + (size / sizeof(*uint32Packet));
+
+    while (keyPacket < end) {
+      if (handle->keybuf_nb>=BRL_KEYBUF_SIZE) {
+        syslog(LOG_WARNING,"lost key: 0X%8lx%8lx\n",(unsigned long)ntohl(keyPacket[0]),(unsigned long)ntohl(keyPacket[1]));
+      } else {
+        handle->keybuf[(handle->keybuf_next+handle->keybuf_nb++)%BRL_KEYBUF_SIZE]
+            = brlapi_packetToKeyCode(keyPacket);
+      }
+
+      keyPacket += 2;
+    }
+
+    pthread_mutex_unlock(&handle->read_mutex);
+    return -3;
+  }
   if (type==BRLAPI_PACKET_PARAM_UPDATE) {
     /* Parameter update, find handler */
     brlapi_paramValuePacket_t *value = (void*) handle->packet.content;
@@ -589,6 +688,11 @@ again:
   pthread_mutex_lock(&handle->read_mutex);
   if (!handle->reading) {
     doread = handle->reading = 1;
+#ifndef __MINGW32__
+    /* only the reader may touch the packet */
+    if (handle->readAhead && !handle->packet.buffer)
+      brlapi_setPacketBuffer(&handle->packet, handle->packetBuffer, sizeof(handle->packetBuffer));
+#endif /* __MINGW32__ */
   } else {
     if (
 #ifndef WINDOWS
@@ -685,6 +789,19 @@ static int brlapi__writePacketWaitForAck(brlapi_handle_t *handle, brlapi_packetT
   return res;
 }
 
+#ifdef HAVE_MEMFD_CREATE
+/* brlapi__dropSharedWindow */
+/* Stop writing through the shared window */
+static void brlapi__dropSharedWindow(brlapi_handle_t *handle)
+{
+  if (handle->sharedWindow) {
+    munmap(handle->sharedWindow, handle->sharedWindowSize);
+    handle->sharedWindow = NULL;
+    handle->sharedWindowSize = 0;
+  }
+}
+#endif /* HAVE_MEMFD_CREATE */
+
 /* brlapi__pause */
 /* Wait for an event to be received */
 int BRLAPI_STDCALL brlapi__pause(brlapi_handle_t *handle, int timeout_ms) {
@@ -1154,6 +1271,20 @@ void BRLAPI_STDCALL brlapi__closeConnection(brlapi_handle_t *handle)
   handle->fileDescriptor = BRLAPI_INVALID_FILE_DESCRIPTOR;
   pthread_mutex_unlock(&handle->fileDescriptor_mutex);
 
+#ifndef __MINGW32__
+  {
+    int descriptor = brlapi__takeReceivedDescriptor(handle);
+    if (descriptor != -1) close(descriptor);
+  }
+  brlapi_discardPacket(&handle->packet);
+  brlapi_setPacketBuffer(&handle->packet, NULL, 0);
+  handle->readAhead = 0;
+#endif /* __MINGW32__ */
+
+#ifdef HAVE_MEMFD_CREATE
+  brlapi__dropSharedWindow(handle);
+#endif /* HAVE_MEMFD_CREATE */
+
 #ifdef LC_GLOBAL_LOCALE
   if (handle->default_locale != LC_GLOBAL_LOCALE) {
     freelocale(handle->default_locale);
@@ -1395,7 +1526,9 @@ int BRLAPI_STDCALL brlapi_getDisplaySize(unsigned int *x, unsigned int *y)
 /* Function: brlapi_getParameter */
 
 /* Internal version, returns the reply value packet and the length of the value */
-static ssize_t _brlapi__getParameter(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, brlapi_paramValuePacket_t *reply)
+/* If descriptor isn't NULL then it's set to the file descriptor which came */
+/* with the reply (or -1), which the caller must close */
+static ssize_t _brlapi__getParameter(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, brlapi_paramValuePacket_t *reply, int *descriptor)
 {
   brlapi_paramRequestPacket_t request;
   int res;
@@ -1405,6 +1538,7 @@ static ssize_t _brlapi__getParameter(brlapi_handle_t *handle, brlapi_param_t par
   request.param = htonl(parameter);
   request.subparam_hi = htonl(subparam >> 32);
   request.subparam_lo = htonl(subparam & 0xfffffffful);
+  if (descriptor) *descriptor = -1;
 
   pthread_mutex_lock(&handle->req_mutex);
   res = brlapi_writePacket(handle->fileDescriptor, BRLAPI_PACKET_PARAM_REQUEST, &request, sizeof(request));
@@ -1416,9 +1550,19 @@ static ssize_t _brlapi__getParameter(brlapi_handle_t *handle, brlapi_param_t par
     rlen = brlapi__waitForPacket(handle, BRLAPI_PACKET_PARAM_VALUE, reply, sizeof(*reply), 1, -1);
   else
     rlen = brlapi__waitForAck(handle);
+#ifndef __MINGW32__
+  /* claim it before another request's reply can replace it */
+  if (descriptor) *descriptor = brlapi__takeReceivedDescriptor(handle);
+#endif /* __MINGW32__ */
   pthread_mutex_unlock(&handle->req_mutex);
 
   if (rlen < 0) {
+#ifndef __MINGW32__
+    if (descriptor && (*descriptor != -1)) {
+      close(*descriptor);
+      *descriptor = -1;
+    }
+#endif /* __MINGW32__ */
     return -1;
   }
 
@@ -1443,7 +1587,7 @@ ssize_t BRLAPI_STDCALL brlapi__getParameter(brlapi_handle_t *handle, brlapi_para
     return -1;
   }
 
-  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET, &reply);
+  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET, &reply, NULL);
   if (rlen < 0)
     return -1;
 
@@ -1472,7 +1616,7 @@ void* BRLAPI_STDCALL brlapi__getParameterAlloc(brlapi_handle_t *handle, brlapi_p
     return NULL;
   }
 
-  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET, &reply);
+  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET, &reply, NULL);
   if (rlen < 0)
     return NULL;
 
@@ -1493,6 +1637,85 @@ void* BRLAPI_STDCALL brlapi_getParameterAlloc(brlapi_param_t parameter, brlapi_p
   return brlapi__getParameterAlloc(&defaultHandle, parameter, subparam, flags, len);
 }
 
+/* Function: brlapi_getParameterSegment */
+const void * BRLAPI_STDCALL brlapi__getParameterSegment(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, size_t *size)
+{
+#ifdef __MINGW32__
+  brlapi_errno = BRLAPI_ERROR_OPNOTSUPP;
+  return NULL;
+#else /* __MINGW32__ */
+  brlapi_paramValuePacket_t reply;
+  ssize_t rlen;
+  int descriptor;
+  uint64_t segmentSize;
+  void *segment;
+
+  if (flags & ~BRLAPI_PARAMF_GLOBAL) {
+    brlapi_errno = BRLAPI_ERROR_INVALID_PARAMETER;
+    return NULL;
+  }
+
+  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET, &reply, &descriptor);
+  if (rlen < 0) return NULL;
+
+  if (descriptor == -1) {
+    /* not a segment parameter, or not a local connection */
+    brlapi_errno = BRLAPI_ERROR_OPNOTSUPP;
+    return NULL;
+  }
+
+  if (rlen != sizeof(segmentSize)) {
+    close(descriptor);
+    brlapi_errno = BRLAPI_ERROR_INVALID_PACKET;
+    return NULL;
+  }
+
+  _brlapi_ntohParameter(parameter, &reply, rlen);
+  memcpy(&segmentSize, &reply.data, sizeof(segmentSize));
+
+  {
+    /* mapping beyond the end of the file would fault when it's accessed */
+    struct stat status;
+
+    if (fstat(descriptor, &status) == -1) {
+      LibcError("fstat in getParameterSegment");
+      close(descriptor);
+      return NULL;
+    }
+
+    if ((status.st_size < 0) || ((uint64_t)status.st_size < segmentSize)) {
+      close(descriptor);
+      brlapi_errno = BRLAPI_ERROR_INVALID_PACKET;
+      return NULL;
+    }
+  }
+
+  segment = mmap(NULL, segmentSize, PROT_READ, MAP_SHARED, descriptor, 0);
+  close(descriptor);
+
+  if (segment == MAP_FAILED) {
+    LibcError("mmap in getParameterSegment");
+    return NULL;
+  }
+
+  *size = segmentSize;
+  return segment;
+#endif /* __MINGW32__ */
+}
+
+const void * BRLAPI_STDCALL brlapi_getParameterSegment(brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, size_t *size)
+{
+  return brlapi__getParameterSegment(&defaultHandle, parameter, subparam, flags, size);
+}
+
+/* Function: brlapi_releaseParameterSegment */
+void BRLAPI_STDCALL brlapi_releaseParameterSegment(const void *segment, size_t size)
+{
+#ifndef __MINGW32__
+  munmap((void *)segment, size);
+#endif /* __MINGW32__ */
+}
+
 /* Function: brlapi_setParameter */
 int BRLAPI_STDCALL brlapi__setParameter(brlapi_handle_t *handle, brlapi_param_t parameter, brlapi_param_subparam_t subparam, brlapi_param_flags_t flags, const void* data, size_t len)
 {
@@ -1538,7 +1761,7 @@ brlapi_paramCallbackDescriptor_t BRLAPI_STDCALL brlapi__watchParameter(brlapi_ha
   }
 
   pthread_mutex_lock(&handle->callbacks_mutex);
-  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET | BRLAPI_PARAMF_SUBSCRIBE, &reply);
+  rlen = _brlapi__getParameter(handle, parameter, subparam, flags | BRLAPI_PARAMF_GET | BRLAPI_PARAMF_SUBSCRIBE, &reply, NULL);
   if (rlen < 0) {
     pthread_mutex_unlock(&handle->callbacks_mutex);
     return NULL;
@@ -1588,7 +1811,7 @@ int BRLAPI_STDCALL brlapi__unwatchParameter(brlapi_handle_t *handle, brlapi_para
   struct brlapi_parameterCallback_t *callback = descriptor;
 
   pthread_mutex_lock(&handle->callbacks_mutex);
-  rlen = _brlapi__getParameter(handle, callback->parameter, callback->subparam, callback->flags | BRLAPI_PARAMF_UNSUBSCRIBE, &reply);
+  rlen = _brlapi__getParameter(handle, callback->parameter, callback->subparam, callback->flags | BRLAPI_PARAMF_UNSUBSCRIBE, &reply, NULL);
   if (rlen < 0) {
     pthread_mutex_unlock(&handle->callbacks_mutex);
     return -1;
@@ -1860,6 +2083,11 @@ int BRLAPI_STDCALL brlapi__leaveTtyMode(brlapi_handle_t *handle)
     goto out;
   }
   handle->brlx = 0; handle->brly = 0;
+#ifdef HAVE_MEMFD_CREATE
+  pthread_mutex_lock(&handle->fileDescriptor_mutex);
+  brlapi__dropSharedWindow(handle);
+  pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+#endif /* HAVE_MEMFD_CREATE */
   res = brlapi__writePacketWaitForAck(handle,BRLAPI_PACKET_LEAVETTYMODE,NULL,0);
   handle->state &= ~STCONTROLLINGTTY;
 out:
@@ -1930,6 +2158,136 @@ static size_t getCharset(brlapi_handle_t *handle, void *buffer, int wide) {
   return p-start;
 }
 
+#ifdef HAVE_MEMFD_CREATE
+/* Function : brlapi_writeSharedFrame */
+/* Publishes a whole display frame through the shared window */
+/* Either text (padded with spaces) or dots must be given */
+static int brlapi__writeSharedFrame(brlapi_handle_t *handle, int cursor, const wchar_t *text, const unsigned char *dots)
+{
+  brlapi_sharedWindowHeader_t *header = handle->sharedWindow;
+  unsigned int cells = header->cells;
+  uint32_t published = header->published;
+  unsigned char *frame = (unsigned char *)(header + 1) + ((published % header->frames) * header->frameSize);
+  uint32_t *frameText = (uint32_t *)(frame + BRLAPI_SHARED_WINDOW_TEXT_OFFSET);
+  uint8_t *andMask = frame + BRLAPI_SHARED_WINDOW_AND_OFFSET(cells);
+  uint8_t *orMask = frame + BRLAPI_SHARED_WINDOW_OR_OFFSET(cells);
+  uint32_t flags = htonl(BRLAPI_WF_SHARED_WINDOW);
+  unsigned int i;
+
+  if (cursor != BRLAPI_CURSOR_LEAVE) handle->sharedWindowCursor = cursor;
+  *(int32_t *)frame = handle->sharedWindowCursor;
+
+  if (text) {
+    for (i=0; i<cells; i+=1) frameText[i] = *text? *text++: L' ';
+    memset(andMask, 0XFF, cells);
+    memset(orMask, 0X00, cells);
+  } else {
+    /* the Unicode braille row is U+2800, with one bit per dot */
+    for (i=0; i<cells; i+=1) frameText[i] = 0X2800 | dots[i];
+    memset(andMask, 0X00, cells);
+    memcpy(orMask, dots, cells);
+  }
+
+  /* the server mustn't see the new count before the frame itself */
+  __sync_synchronize();
+  header->published = published + 1;
+
+  return brlapi_writePacket(handle->fileDescriptor, BRLAPI_PACKET_WRITE, &flags, sizeof(flags));
+}
+
+/* Function : brlapi_enableSharedWindow */
+/* Shares a memory window with the server for display writes */
+int BRLAPI_STDCALL brlapi__enableSharedWindow(brlapi_handle_t *handle)
+{
+  unsigned int cells = handle->brlx * handle->brly;
+  uint32_t frames = 4;
+  size_t size = BRLAPI_SHARED_WINDOW_SIZE(cells, frames);
+  brlapi_sharedWindowHeader_t *header;
+  brlapi_paramValuePacket_t packet;
+  brlapi_param_sharedWindow_t value = size;
+  int descriptor;
+  ssize_t res;
+
+  if (!(handle->state & STCONTROLLINGTTY) || !cells) {
+    brlapi_errno = BRLAPI_ERROR_ILLEGAL_INSTRUCTION;
+    return -1;
+  }
+
+#if defined(PF_LOCAL)
+  if (handle->addrfamily != PF_LOCAL)
+#endif /* PF_LOCAL */
+  {
+    brlapi_errno = BRLAPI_ERROR_OPNOTSUPP;
+    return -1;
+  }
+
+  if ((descriptor = memfd_create("brlapi-window", MFD_CLOEXEC | MFD_ALLOW_SEALING)) == -1) {
+    LibcError("memfd_create in enableSharedWindow");
+    return -1;
+  }
+
+  if ((ftruncate(descriptor, size) == -1) ||
+      (fcntl(descriptor, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) == -1)) {
+    LibcError("sizing in enableSharedWindow");
+    close(descriptor);
+    return -1;
+  }
+
+  if ((header = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0)) == MAP_FAILED) {
+    LibcError("mmap in enableSharedWindow");
+    close(descriptor);
+    return -1;
+  }
+
+  header->magic = BRLAPI_SHARED_WINDOW_MAGIC;
+  header->cells = cells;
+  header->frames = frames;
+  header->frameSize = BRLAPI_SHARED_WINDOW_FRAME_SIZE(cells);
+  header->published = 0;
+
+  packet.flags = htonl(0);
+  packet.param = htonl(BRLAPI_PARAM_SHARED_WINDOW);
+  packet.subparam_hi = htonl(0);
+  packet.subparam_lo = htonl(0);
+  memcpy(packet.data, &value, sizeof(value));
+  _brlapi_htonParameter(BRLAPI_PARAM_SHARED_WINDOW, &packet, sizeof(value));
+
+  pthread_mutex_lock(&handle->req_mutex);
+  pthread_mutex_lock(&handle->fileDescriptor_mutex);
+  res = brlapi_writeDescriptorPacket(handle->fileDescriptor, BRLAPI_PACKET_PARAM_VALUE, &packet,
+                                     sizeof(packet.flags) + sizeof(packet.param) + sizeof(brlapi_param_subparam_t) + sizeof(value),
+                                     descriptor);
+  pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+  if (res >= 0) res = brlapi__waitForAck(handle);
+  pthread_mutex_unlock(&handle->req_mutex);
+  close(descriptor);
+
+  if (res < 0) {
+    munmap(header, size);
+    return -1;
+  }
+
+  pthread_mutex_lock(&handle->fileDescriptor_mutex);
+  brlapi__dropSharedWindow(handle);
+  handle->sharedWindow = header;
+  handle->sharedWindowSize = size;
+  handle->sharedWindowCursor = BRLAPI_CURSOR_OFF;
+  pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+  return 0;
+}
+#else /* HAVE_MEMFD_CREATE */
+int BRLAPI_STDCALL brlapi__enableSharedWindow(brlapi_handle_t *handle)
+{
+  brlapi_errno = BRLAPI_ERROR_OPNOTSUPP;
+  return -1;
+}
+#endif /* HAVE_MEMFD_CREATE */
+
+int BRLAPI_STDCALL brlapi_enableSharedWindow(void)
+{
+  return brlapi__enableSharedWindow(&defaultHandle);
+}
+
 /* Function : brlapi_writeText */
 /* Writes a string to the braille display */
 static int brlapi___writeText(brlapi_handle_t *handle, int cursor, const void *str, int wide)
@@ -1941,6 +2299,18 @@ static int brlapi___writeText(brlapi_handle_t *handle, int cursor, const void *s
   int res;
   size_t len;
 
+#ifdef HAVE_MEMFD_CREATE
+  if (wide && str) {
+    pthread_mutex_lock(&handle->fileDescriptor_mutex);
+    if (handle->sharedWindow && (handle->sharedWindow->cells == dispSize)) {
+      res = brlapi__writeSharedFrame(handle, cursor, str, NULL);
+      pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+      return res;
+    }
+    pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+  }
+#endif /* HAVE_MEMFD_CREATE */
+
 #ifdef LC_GLOBAL_LOCALE
   locale_t old_locale = 0;
 
@@ -2042,6 +2412,20 @@ int BRLAPI_STDCALL brlapi__writeDots(brlapi_handle_t *handle, const unsigned cha
     return -1;
   }
 
+#ifdef HAVE_MEMFD_CREATE
+  {
+    int res;
+
+    pthread_mutex_lock(&handle->fileDescriptor_mutex);
+    if (handle->sharedWindow && (handle->sharedWindow->cells == size)) {
+      res = brlapi__writeSharedFrame(handle, BRLAPI_CURSOR_OFF, NULL, dots);
+      pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+      return res;
+    }
+    pthread_mutex_unlock(&handle->fileDescriptor_mutex);
+  }
+#endif /* HAVE_MEMFD_CREATE */
+
   unsigned char andMask[size];
   memset(andMask, 0, size);
   wa.andMask = andMask;
@@ -2237,6 +2621,24 @@ int brlapi_write(const brlapi_writeArguments_t *s)
 }
 #endif /* WINDOWS */
 
+/* Function : brlapi__takeBufferedKey */
+/* Takes the oldest key from the key buffer, returns 0 if it is empty */
+static int brlapi__takeBufferedKey(brlapi_handle_t *handle, brlapi_keyCode_t *code)
+{
+  int taken = 0;
+
+  pthread_mutex_lock(&handle->read_mutex);
+  if (handle->keybuf_nb>0) {
+    *code=handle->keybuf[handle->keybuf_next];
+    handle->keybuf_next=(handle->keybuf_next+1)%BRL_KEYBUF_SIZE;
+    handle->keybuf_nb--;
+    taken = 1;
+  }
+  pthread_mutex_unlock(&handle->read_mutex);
+
+  return taken;
+}
+
 /* Function : brlapi_readKey */
 /* Reads a key from the braille keyboard */
 int BRLAPI_STDCALL brlapi__readKeyWithTimeout(brlapi_handle_t *handle, int timeout_ms, brlapi_keyCode_t *code)
@@ -2252,20 +2654,14 @@ int BRLAPI_STDCALL brlapi__readKeyWithTimeout(brlapi_handle_t *handle, int timeo
   }
   pthread_mutex_unlock(&handle->state_mutex);
 
-  pthread_mutex_lock(&handle->read_mutex);
-  if (handle->keybuf_nb>0) {
-    *code=handle->keybuf[handle->keybuf_next];
-    handle->keybuf_next=(handle->keybuf_next+1)%BRL_KEYBUF_SIZE;
-    handle->keybuf_nb--;
-    pthread_mutex_unlock(&handle->read_mutex);
-    return 1;
-  }
-  pthread_mutex_unlock(&handle->read_mutex);
+  if (brlapi__takeBufferedKey(handle, code)) return 1;
 
   pthread_mutex_lock(&handle->key_mutex);
   res = brlapi__waitForPacket(handle,BRLAPI_PACKET_KEY, buf, sizeof(buf), TRY_WAIT_FOR_EXPECTED_PACKET, timeout_ms);
   pthread_mutex_unlock(&handle->key_mutex);
   if (res == -3) {
+    /* a batch of keys has been buffered */
+    if (brlapi__takeBufferedKey(handle, code)) return 1;
     if (timeout_ms == 0) return 0;
     brlapi_libcerrno = EINTR;
     brlapi_errno = BRLAPI_ERROR_LIBCERR;
@@ -2296,6 +2692,30 @@ int BRLAPI_STDCALL brlapi_readKey(int block, brlapi_keyCode_t *code)
   return brlapi__readKeyWithTimeout(&defaultHandle, block ? -1 : 0, code);
 }
 
+/* Function : brlapi_enableKeyBatching */
+/* Lets the server deliver several keys at once */
+int BRLAPI_STDCALL brlapi__enableKeyBatching(brlapi_handle_t *handle)
+{
+  brlapi_param_keyBatching_t value = 1;
+
+  if (brlapi__setParameter(handle, BRLAPI_PARAM_KEY_BATCHING, 0, 0, &value, sizeof(value)) == -1)
+    return -1;
+
+#ifndef __MINGW32__
+  /* the reader switches to reading ahead the next time it starts */
+  pthread_mutex_lock(&handle->read_mutex);
+  handle->readAhead = 1;
+  pthread_mutex_unlock(&handle->read_mutex);
+#endif /* __MINGW32__ */
+
+  return 0;
+}
+
+int BRLAPI_STDCALL brlapi_enableKeyBatching(void)
+{
+  return brlapi__enableKeyBatching(&defaultHandle);
+}
+
 typedef struct {
   brlapi_keyCode_t code;
   const char *name;
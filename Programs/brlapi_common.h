@@ -163,6 +163,13 @@ typedef struct {
   int n; /* Value to give so read() */
 #ifdef __MINGW32__
   OVERLAPPED overl;
+#else /* __MINGW32__ */
+  int descriptor; /* File descriptor passed along with the packet, or -1 */
+  int pendingDescriptor; /* File descriptor whose packet isn't complete yet, or -1 */
+  unsigned char *buffer; /* Read-ahead buffer, or NULL to read piecewise */
+  size_t bufferSize;
+  size_t bufferStart; /* First byte which hasn't been parsed yet */
+  size_t bufferEnd; /* End of the data which has been received */
 #endif /* __MINGW32__ */
 } Packet;
 
@@ -195,11 +202,103 @@ static int brlapi_initializePacket(Packet *packet)
     LibcError("CreateEvent for readPacket");
     return -1;
   }
+#endif /* __MINGW32__ */
+#ifndef __MINGW32__
+  packet->descriptor = -1;
+  packet->pendingDescriptor = -1;
+  packet->buffer = NULL;
+  packet->bufferSize = 0;
+  packet->bufferStart = packet->bufferEnd = 0;
 #endif /* __MINGW32__ */
   brlapi_resetPacket(packet);
   return 0;
 }
 
+#ifndef __MINGW32__
+/* Function: brlapi_takePacketDescriptor */
+/* Returns the file descriptor which came with the last packet, or -1 */
+/* The caller becomes responsible for closing it */
+static int brlapi_takePacketDescriptor(Packet *packet)
+{
+  int descriptor = packet->descriptor;
+  packet->descriptor = -1;
+  return descriptor;
+}
+
+/* Function: brlapi_closePacketDescriptor */
+/* Closes the file descriptor which came with the last packet, if any */
+static void brlapi_closePacketDescriptor(Packet *packet)
+{
+  int descriptor = brlapi_takePacketDescriptor(packet);
+  if (descriptor != -1) close(descriptor);
+}
+
+/* Function: brlapi_discardPacket */
+/* Drops whatever has been received for a connection which is being closed */
+static void brlapi_discardPacket(Packet *packet)
+{
+  brlapi_closePacketDescriptor(packet);
+
+  if (packet->pendingDescriptor != -1) {
+    close(packet->pendingDescriptor);
+    packet->pendingDescriptor = -1;
+  }
+
+  packet->bufferStart = packet->bufferEnd = 0;
+  brlapi_resetPacket(packet);
+}
+
+/* Function: brlapi_receivePacketData */
+/* Like read(), but also collects a file descriptor passed as ancillary data */
+static ssize_t brlapi_receivePacketData(Packet *packet, int descriptor, void *buffer, size_t size)
+{
+#ifdef SCM_RIGHTS
+  struct iovec iov = {
+    .iov_base = buffer,
+    .iov_len = size
+  };
+
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+
+  struct msghdr msg = {
+    .msg_iov = &iov,
+    .msg_iovlen = 1,
+    .msg_control = &control,
+    .msg_controllen = sizeof(control)
+  };
+
+  int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+  flags |= MSG_CMSG_CLOEXEC;
+#endif /* MSG_CMSG_CLOEXEC */
+
+  ssize_t res = recvmsg(descriptor, &msg, flags);
+
+  if (res > 0) {
+    struct cmsghdr *cmsg;
+
+    for (cmsg=CMSG_FIRSTHDR(&msg); cmsg; cmsg=CMSG_NXTHDR(&msg, cmsg)) {
+      if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_RIGHTS) &&
+          (cmsg->cmsg_len == CMSG_LEN(sizeof(int)))) {
+        /* only the latest descriptor is kept */
+        if (packet->pendingDescriptor != -1) close(packet->pendingDescriptor);
+        memcpy(&packet->pendingDescriptor, CMSG_DATA(cmsg), sizeof(int));
+      }
+    }
+  } else if ((res == -1) && (errno == ENOTSOCK)) {
+    res = read(descriptor, buffer, size);
+  }
+
+  return res;
+#else /* SCM_RIGHTS */
+  return read(descriptor, buffer, size);
+#endif /* SCM_RIGHTS */
+}
+#endif /* __MINGW32__ */
+
 /* Function : readPacket */
 /* Reads a packet for the given connection */
 /* Returns -2 on EOF, -1 on error, 0 if the reading is not complete, */
@@ -222,7 +321,28 @@ read:
 #else /* __MINGW32__ */
   int res;
 read:
-  res = read(descriptor, packet->p, packet->n);
+  if ((packet->state == READING_HEADER) && !packet->readBytes) {
+    /* a new packet: drop a descriptor nobody claimed */
+    brlapi_closePacketDescriptor(packet);
+  }
+
+  if (!packet->buffer) {
+    res = brlapi_receivePacketData(packet, descriptor, packet->p, packet->n);
+  } else if (packet->bufferStart < packet->bufferEnd) {
+    res = MIN(packet->n, packet->bufferEnd - packet->bufferStart);
+    memcpy(packet->p, packet->buffer + packet->bufferStart, res);
+    packet->bufferStart += res;
+  } else {
+    /* take everything which is available, the next packets come from there */
+    res = brlapi_receivePacketData(packet, descriptor, packet->buffer, packet->bufferSize);
+
+    if (res > 0) {
+      packet->bufferStart = 0;
+      packet->bufferEnd = res;
+      goto read;
+    }
+  }
+
   if (res==-1) {
     switch (errno) {
       case EINTR: goto read;
@@ -273,6 +393,15 @@ read:
   goto read;
 
 out:
+#ifndef __MINGW32__
+  if (packet->header.type == BRLAPI_PACKET_PARAM_VALUE) {
+    /* A descriptor is only ever passed along with a parameter value, and at
+     * most one of them is in flight, but the data received together with
+     * the descriptor may also hold the packets which precede it. */
+    packet->descriptor = packet->pendingDescriptor;
+    packet->pendingDescriptor = -1;
+  }
+#endif /* __MINGW32__ */
   brlapi_resetPacket(packet);
   return 1;
 }
@@ -300,6 +429,68 @@ ssize_t BRLAPI(writePacket)(brlapi_fileDescriptor fd, brlapi_packetType_t type,
   return 0;
 }
 
+#ifndef __MINGW32__
+/* brlapi_writeDescriptorPacket */
+/* Write a packet on a local socket along with a file descriptor */
+static ssize_t brlapi_writeDescriptorPacket(brlapi_fileDescriptor fd, brlapi_packetType_t type, const void *buf, size_t size, int descriptor)
+{
+#ifdef SCM_RIGHTS
+  uint32_t header[2] = { htonl(size), htonl(type) };
+  unsigned char bytes[sizeof(header) + size];
+
+  memcpy(bytes, header, sizeof(header));
+  if (size) memcpy(&bytes[sizeof(header)], buf, size);
+
+  struct iovec iov = {
+    .iov_base = bytes,
+    .iov_len = sizeof(bytes)
+  };
+
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+
+  struct msghdr msg = {
+    .msg_iov = &iov,
+    .msg_iovlen = 1,
+    .msg_control = &control,
+    .msg_controllen = sizeof(control)
+  };
+
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(cmsg), &descriptor, sizeof(int));
+
+  ssize_t res;
+
+  do {
+    res = sendmsg(fd, &msg, 0);
+  } while ((res == -1) && (errno == EINTR));
+
+  if (res == -1) {
+    LibcError("sendmsg in writeDescriptorPacket");
+    return -1;
+  }
+
+  if (res < sizeof(bytes)) {
+    /* the descriptor went with the first byte - write the rest normally */
+    if (brlapi_writeFile(fd, &bytes[res], sizeof(bytes) - res) < 0) {
+      LibcError("write in writeDescriptorPacket");
+      return -1;
+    }
+  }
+
+  return 0;
+#else /* SCM_RIGHTS */
+  brlapi_errno = BRLAPI_ERROR_OPNOTSUPP;
+  return -1;
+#endif /* SCM_RIGHTS */
+}
+#endif /* __MINGW32__ */
+
 /* brlapi_readPacketHeader */
 /* Read a packet's header and return packet's size */
 ssize_t BRLAPI(readPacketHeader)(brlapi_fileDescriptor fd, brlapi_packetType_t *packetType)
@@ -492,6 +683,7 @@ static const brlapi_packetTypeEntry_t brlapi_packetTypeTable[] = {
   { BRLAPI_PACKET_SETFOCUS, "SetFocus" },
   { BRLAPI_PACKET_LEAVETTYMODE, "LeaveTtyMode" },
   { BRLAPI_PACKET_KEY, "Key" },
+  { BRLAPI_PACKET_KEYS, "Keys" },
   { BRLAPI_PACKET_IGNOREKEYRANGES, "IgnoreKeyRanges" },
   { BRLAPI_PACKET_ACCEPTKEYRANGES, "AcceptKeyRanges" },
   { BRLAPI_PACKET_WRITE, "Write" },
@@ -828,6 +1020,43 @@ static const brlapi_param_properties_t brlapi_param_properties[BRLAPI_PARAM_COUN
     .canWatch = 1,
     .canWrite = 1,
   },
+
+  [BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE_SEGMENT] = {
+    .type = BRLAPI_PARAM_TYPE_UINT64,
+    .canRead = 1,
+  },
+
+  [BRLAPI_PARAM_SHARED_WINDOW] = {
+    .type = BRLAPI_PARAM_TYPE_UINT32,
+    .canRead = 1,
+    .canWrite = 1,
+  },
+
+  [BRLAPI_PARAM_KEY_BATCHING] = {
+    .type = BRLAPI_PARAM_TYPE_BOOLEAN,
+    .canRead = 1,
+    .canWrite = 1,
+  },
+
+  [BRLAPI_PARAM_SERVER_STATISTICS] = {
+    .type = BRLAPI_PARAM_TYPE_UINT64,
+    .canRead = 1,
+    .isArray = 1,
+  },
+
+  [BRLAPI_PARAM_CONNECTION_STATISTICS] = {
+    .type = BRLAPI_PARAM_TYPE_UINT64,
+    .canRead = 1,
+    .isArray = 1,
+    .hasSubparam = 1,
+  },
+
+  [BRLAPI_PARAM_PACKET_STATISTICS] = {
+    .type = BRLAPI_PARAM_TYPE_UINT64,
+    .canRead = 1,
+    .isArray = 1,
+    .hasSubparam = 1,
+  },
 };
 
 const brlapi_param_properties_t *brlapi_getParameterProperties(brlapi_param_t parameter) {
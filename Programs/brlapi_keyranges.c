@@ -233,3 +233,224 @@ int removeKeyrange(KeyrangeElem x0, KeyrangeElem y0, KeyrangeList **l)
 
   return 0;
 }
+
+typedef struct {
+  uint32_t minFlags, maxFlags;
+  void *owner;
+} KeyrangeCandidate;
+
+struct KeyrangeIndex {
+  /* interval i goes from boundaries[i] through boundaries[i+1]-1 */
+  uint64_t *boundaries;
+  unsigned int intervalCount;
+
+  /* the candidates of interval i go from firstCandidates[i] */
+  /* through firstCandidates[i+1]-1, in precedence order */
+  unsigned int *firstCandidates;
+  KeyrangeCandidate *candidates;
+};
+
+static int compareBoundaries(const void *element1, const void *element2)
+{
+  const uint64_t *boundary1 = element1;
+  const uint64_t *boundary2 = element2;
+
+  if (*boundary1 < *boundary2) return -1;
+  if (*boundary1 > *boundary2) return 1;
+  return 0;
+}
+
+typedef struct {
+  uint64_t from, to; /* to is the first value after the range */
+  unsigned int precedence;
+  KeyrangeCandidate candidate;
+} KeyrangeSpan;
+
+static int compareSpans(const void *element1, const void *element2)
+{
+  const KeyrangeSpan *span1 = element1;
+  const KeyrangeSpan *span2 = element2;
+
+  if (span1->from < span2->from) return -1;
+  if (span1->from > span2->from) return 1;
+  return 0;
+}
+
+/* Function : sweepKeyrangeSpans */
+/* Walks the intervals in order, keeping the spans which cover the current */
+/* one in precedence order, and counts (and stores if candidates isn't */
+/* NULL) the candidates of each of them */
+static unsigned int sweepKeyrangeSpans(KeyrangeIndex *index, const KeyrangeSpan *spans, unsigned int spanCount, const KeyrangeSpan **active, KeyrangeCandidate *candidates)
+{
+  unsigned int activeCount = 0;
+  unsigned int candidateCount = 0;
+  unsigned int next = 0;
+  unsigned int i;
+
+  for (i=0; i<index->intervalCount; i++) {
+    uint64_t start = index->boundaries[i];
+    unsigned int from, to;
+
+    /* since every range boundary starts an interval, */
+    /* a range either covers a whole interval or none of it */
+    for (from=0, to=0; from<activeCount; from++) {
+      if (active[from]->to > start) active[to++] = active[from];
+    }
+    activeCount = to;
+
+    while ((next < spanCount) && (spans[next].from <= start)) {
+      const KeyrangeSpan *span = &spans[next++];
+
+      for (to=activeCount++; to && (active[to-1]->precedence > span->precedence); to--) {
+        active[to] = active[to-1];
+      }
+      active[to] = span;
+    }
+
+    if (candidates) {
+      index->firstCandidates[i] = candidateCount;
+
+      for (to=0; to<activeCount; to++) {
+        candidates[candidateCount+to] = active[to]->candidate;
+      }
+    }
+
+    candidateCount += activeCount;
+  }
+
+  if (candidates) index->firstCandidates[i] = candidateCount;
+  return candidateCount;
+}
+
+/* Function : newKeyrangeIndex */
+KeyrangeIndex *newKeyrangeIndex(KeyrangeList *const *lists, void *const *owners, unsigned int count)
+{
+  KeyrangeIndex *index;
+  KeyrangeSpan *spans;
+  const KeyrangeSpan **active;
+  unsigned int spanCount = 0;
+  unsigned int boundaryCount = 0;
+  unsigned int candidateCount;
+  unsigned int i;
+
+  if (!(index = malloc(sizeof(*index)))) goto noIndex;
+
+  for (i=0; i<count; i++) {
+    KeyrangeList *c;
+    for (c=lists[i]; c; c=c->next) spanCount += 1;
+  }
+
+  if (!(spans = malloc((spanCount + 1) * sizeof(*spans)))) goto noSpans;
+  if (!(active = malloc((spanCount + 1) * sizeof(*active)))) goto noActive;
+  if (!(index->boundaries = malloc(((spanCount * 2) + 1) * sizeof(*index->boundaries)))) goto noBoundaries;
+  spanCount = 0;
+
+  for (i=0; i<count; i++) {
+    KeyrangeList *c;
+
+    for (c=lists[i]; c; c=c->next) {
+      KeyrangeSpan *span = &spans[spanCount];
+
+      span->from = c->minVal;
+      span->to = (uint64_t)c->maxVal + 1;
+      span->precedence = spanCount++;
+
+      span->candidate.minFlags = c->minFlags;
+      span->candidate.maxFlags = c->maxFlags;
+      span->candidate.owner = owners[i];
+
+      index->boundaries[boundaryCount++] = span->from;
+      index->boundaries[boundaryCount++] = span->to;
+    }
+  }
+
+  if (boundaryCount) {
+    unsigned int from;
+
+    qsort(index->boundaries, boundaryCount, sizeof(*index->boundaries), compareBoundaries);
+
+    for (from=1, i=1; from<boundaryCount; from++) {
+      if (index->boundaries[from] != index->boundaries[i-1]) {
+        index->boundaries[i++] = index->boundaries[from];
+      }
+    }
+
+    boundaryCount = i;
+  }
+
+  qsort(spans, spanCount, sizeof(*spans), compareSpans);
+
+  index->intervalCount = boundaryCount? boundaryCount - 1: 0;
+  if (!(index->firstCandidates = malloc((index->intervalCount + 1) * sizeof(*index->firstCandidates)))) goto noFirstCandidates;
+
+  candidateCount = sweepKeyrangeSpans(index, spans, spanCount, active, NULL);
+  if (!(index->candidates = malloc((candidateCount + 1) * sizeof(*index->candidates)))) goto noCandidates;
+  sweepKeyrangeSpans(index, spans, spanCount, active, index->candidates);
+
+  logMessage(LOG_CATEGORY(SERVER_EVENTS) | LOG_DEBUG,
+    "key range index: %u intervals, %u candidates",
+    index->intervalCount, candidateCount
+  );
+
+  free(active);
+  free(spans);
+  return index;
+
+noCandidates:
+  free(index->firstCandidates);
+noFirstCandidates:
+  free(index->boundaries);
+noBoundaries:
+  free(active);
+noActive:
+  free(spans);
+noSpans:
+  free(index);
+noIndex:
+  return NULL;
+}
+
+/* Function : freeKeyrangeIndex */
+void freeKeyrangeIndex(KeyrangeIndex *index)
+{
+  if (index==NULL) return;
+  free(index->candidates);
+  free(index->firstCandidates);
+  free(index->boundaries);
+  free(index);
+}
+
+/* Function : searchKeyrangeIndex */
+void *searchKeyrangeIndex(const KeyrangeIndex *index, KeyrangeElem n, KeyrangeOwnerTester *test, void *data)
+{
+  uint32_t flags = KeyrangeFlags(n);
+  uint32_t val = KeyrangeVal(n);
+  unsigned int first = 0;
+  unsigned int last = index->intervalCount;
+  unsigned int i;
+
+  /* find the interval which starts at the highest boundary not above val */
+  while (first < last) {
+    unsigned int middle = first + ((last - first) / 2);
+
+    if (index->boundaries[middle] <= val) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+
+  if (!first) return NULL;
+  first -= 1;
+  if (val >= index->boundaries[first+1]) return NULL;
+
+  for (i=index->firstCandidates[first]; i<index->firstCandidates[first+1]; i++) {
+    const KeyrangeCandidate *candidate = &index->candidates[i];
+
+    if (((flags | candidate->minFlags) == flags) && ((flags & ~candidate->maxFlags) == 0)) {
+      if (!test || test(candidate->owner, data)) return candidate->owner;
+    }
+  }
+
+  return NULL;
+}
@@ -69,6 +69,28 @@ extern int addKeyrange(KeyrangeElem x0, KeyrangeElem y0, KeyrangeList **l);
 /* Returns 0 if success, -1 if failure */
 extern int removeKeyrange(KeyrangeElem x0, KeyrangeElem y0, KeyrangeList **l);
 
+/* Type : KeyrangeIndex */
+/* Compiled form of several range lists, each of them belonging to an owner */
+/* The values are split into intervals which no range boundary falls within, */
+/* so that looking an element up is a binary search */
+typedef struct KeyrangeIndex KeyrangeIndex;
+
+/* Function : newKeyrangeIndex */
+/* Compiles count range lists, earlier lists taking precedence over later ones */
+/* Returns NULL if there isn't enough memory */
+extern KeyrangeIndex *newKeyrangeIndex(KeyrangeList *const *lists, void *const *owners, unsigned int count);
+
+/* Function : freeKeyrangeIndex */
+/* Frees an index */
+extern void freeKeyrangeIndex(KeyrangeIndex *index);
+
+typedef int KeyrangeOwnerTester(void *owner, void *data);
+
+/* Function : searchKeyrangeIndex */
+/* Returns the first owner whose list contains n and which test (if not NULL) */
+/* accepts, or NULL if there is none */
+extern void *searchKeyrangeIndex(const KeyrangeIndex *index, KeyrangeElem n, KeyrangeOwnerTester *test, void *data);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
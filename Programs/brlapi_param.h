@@ -96,11 +96,31 @@ typedef enum {
   BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE = 28,	/**< Name of the computer braille table: string */
   BRLAPI_PARAM_LITERARY_BRAILLE_TABLE = 29,	/**< Name of the literary braille table: string */
   BRLAPI_PARAM_MESSAGE_LOCALE = 30,		/**< Locale to use for messages: string */
+  BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE_SEGMENT = 32,	/**< Whole computer braille table as a read-only shared memory segment
+						  * (see brlapi_getParameterSegment):
+						  * uint64_t (size of the segment) */
+  BRLAPI_PARAM_SHARED_WINDOW = 33,		/**< Shared memory window for display writes
+						  * (see brlapi_enableSharedWindow):
+						  * uint32_t (size of the segment, 0 when not shared) */
+  BRLAPI_PARAM_KEY_BATCHING = 34,		/**< Whether several keys may be delivered at once
+						  * (see brlapi_enableKeyBatching): boolean */
+
+//Statistics Parameters
+  BRLAPI_PARAM_SERVER_STATISTICS = 35,		/**< Activity of the server as a whole:
+						  * uint64_t[] (see brlapi_param_serverStatistics_t) */
+  BRLAPI_PARAM_CONNECTION_STATISTICS = 36,	/**< Activity of a connection
+						  * (specified via the subparam argument,
+						  * counting from 0, see brlapi_param_serverStatistics_t.connections):
+						  * uint64_t[] (see brlapi_param_connectionStatistics_t) */
+  BRLAPI_PARAM_PACKET_STATISTICS = 37,		/**< Traffic for a packet type
+						  * (specified via the subparam argument,
+						  * counting from 0, see brlapi_param_serverStatistics_t.packetTypes):
+						  * uint64_t[] (see brlapi_param_packetStatistics_t) */
 /* TODO: dot-to-unicode as well */
 
  /* TODO: help strings */
 
-  BRLAPI_PARAM_COUNT = 32 /** Number of parameters */
+  BRLAPI_PARAM_COUNT = 38 /** Number of parameters */
 } brlapi_param_t;
 
 /* brlapi_param_subparam_t */
@@ -254,6 +274,87 @@ typedef char *brlapi_param_literaryBrailleTable_t;
 /** Type to be used for BRLAPI_PARAM_MESSAGE_LOCALE      */
 typedef char *brlapi_param_messageLocale_t;
 
+/* brlapi_param_computerBrailleTableSegment_t */
+/** Type to be used for BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE_SEGMENT
+ *
+ * The segment itself holds a brlapi_param_computerBrailleRowsMask_t followed,
+ * in ascending row order, by a brlapi_param_computerBrailleRowCells_t for each
+ * row which the mask says is defined. */
+typedef uint64_t brlapi_param_computerBrailleTableSegment_t;
+
+/* brlapi_param_sharedWindow_t */
+/** Type to be used for BRLAPI_PARAM_SHARED_WINDOW */
+typedef uint32_t brlapi_param_sharedWindow_t;
+
+/* brlapi_param_keyBatching_t */
+/** Type to be used for BRLAPI_PARAM_KEY_BATCHING */
+typedef brlapi_param_bool_t brlapi_param_keyBatching_t;
+
+/** Number of buckets in a brlapi_param_latencyHistogram_t */
+#define BRLAPI_PARAM_LATENCY_BUCKETS 24
+
+/** Distribution of the durations of some operation, in microseconds
+ *
+ * Bucket 0 counts the durations below 1 microsecond, and bucket n counts
+ * those from 2^(n-1) up to (but not including) 2^n microseconds. The last
+ * bucket also counts all of the longer ones. */
+typedef struct {
+  uint64_t count;
+  uint64_t total;
+  uint64_t maximum;
+  uint64_t buckets[BRLAPI_PARAM_LATENCY_BUCKETS];
+} brlapi_param_latencyHistogram_t;
+
+/* brlapi_param_serverStatistics_t */
+/** Type to be used for BRLAPI_PARAM_SERVER_STATISTICS
+ *
+ * Counters are always maintained. Durations are only measured while at
+ * least one connection is watching, i.e. has read some statistics
+ * parameter since it was opened, so that they cost nothing otherwise. */
+typedef struct {
+  uint64_t watchers; /**< connections which have read statistics */
+  uint64_t connections; /**< connections currently open */
+  uint64_t connectionsAccepted; /**< connections opened since the server started */
+  uint64_t packetTypes; /**< entries available via BRLAPI_PARAM_PACKET_STATISTICS */
+  uint64_t packetsReceived;
+  uint64_t bytesReceived;
+  uint64_t packetsSent;
+  uint64_t bytesSent;
+  uint64_t keysDelivered; /**< keys and commands sent to clients */
+  uint64_t keysUnclaimed; /**< keys and commands which no client accepted */
+  brlapi_param_latencyHistogram_t flushLatency; /**< writing client output to the device */
+  brlapi_param_latencyHistogram_t lockWait; /**< core waiting for the server to release the connections */
+  brlapi_param_latencyHistogram_t keyDispatch; /**< finding the client for a key and sending it */
+} brlapi_param_serverStatistics_t;
+
+/* brlapi_param_connectionStatistics_t */
+/** Type to be used for BRLAPI_PARAM_CONNECTION_STATISTICS */
+typedef struct {
+  uint64_t identifier; /**< file descriptor of the connection within the server */
+  uint64_t tty; /**< tty number, or UINT64_MAX when not in tty mode */
+  uint64_t priority; /**< see BRLAPI_PARAM_CLIENT_PRIORITY */
+  uint64_t upTime; /**< seconds since the connection was opened */
+  uint64_t packetsReceived;
+  uint64_t bytesReceived;
+  uint64_t writes; /**< display writes, whether by packet or via a shared window */
+  uint64_t keysDelivered;
+  uint64_t bytesQueued; /**< sent but not yet read by the client, if known */
+  brlapi_param_latencyHistogram_t requestLatency; /**< handling the client's requests */
+} brlapi_param_connectionStatistics_t;
+
+/* brlapi_param_packetStatistics_t */
+/** Type to be used for BRLAPI_PARAM_PACKET_STATISTICS
+ *
+ * Types which the server doesn't know are all counted by one entry whose
+ * type is 0. */
+typedef struct {
+  uint64_t type; /**< see brlapi_getPacketTypeName */
+  uint64_t packetsReceived;
+  uint64_t bytesReceived;
+  uint64_t packetsSent;
+  uint64_t bytesSent;
+} brlapi_param_packetStatistics_t;
+
 /** Deprecated in BRLTTY-6.2 - use BRLAPI_PARAM_BOUND_COMMAND_KEYCODES */
 #define BRLAPI_PARAM_BOUND_COMMAND_CODES BRLAPI_PARAM_BOUND_COMMAND_KEYCODES
 /** Deprecated in BRLTTY-6.2 - use brlapi_param_commandKeycode_t */
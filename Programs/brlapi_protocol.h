@@ -64,6 +64,7 @@ extern "C" {
 #define BRLAPI_PACKET_SETFOCUS        'F'   /**< Set current tty focus       */
 #define BRLAPI_PACKET_LEAVETTYMODE    'L'   /**< Release the tty             */
 #define BRLAPI_PACKET_KEY             'k'   /**< Braille key                 */
+#define BRLAPI_PACKET_KEYS            'K'   /**< Several braille keys        */
 #define BRLAPI_PACKET_IGNOREKEYRANGES 'm'   /**< Mask key ranges             */
 #define BRLAPI_PACKET_ACCEPTKEYRANGES 'u'   /**< Unmask key ranges           */
 #define BRLAPI_PACKET_WRITE           'w'   /**< Write                       */
@@ -133,6 +134,7 @@ typedef struct {
 #define BRLAPI_WF_ATTR_OR       0X10    /**< Or attributes                  */
 #define BRLAPI_WF_CURSOR        0X20    /**< Cursor position                */
 #define BRLAPI_WF_CHARSET       0X40    /**< Charset                        */
+#define BRLAPI_WF_SHARED_WINDOW 0X80    /**< Latest shared window frame (no fields) */
 
 /** Structure of extended write packets */
 typedef struct {
@@ -140,6 +142,34 @@ typedef struct {
   unsigned char data; /** Fields in the same order as flag weight */
 } brlapi_writeArgumentsPacket_t;
 
+/** Header of the shared window segment (see BRLAPI_PARAM_SHARED_WINDOW).
+ * Both ends are on the same host, so fields are in host byte order. */
+typedef struct {
+  uint32_t magic; /** BRLAPI_SHARED_WINDOW_MAGIC */
+  uint32_t cells; /** Number of cells in each frame */
+  uint32_t frames; /** Number of frames in the ring */
+  uint32_t frameSize; /** Size of each frame in bytes */
+  uint32_t published; /** Number of frames published so far */
+} brlapi_sharedWindowHeader_t;
+
+#define BRLAPI_SHARED_WINDOW_MAGIC 0X42574E44
+
+/** Each frame holds an int32_t cursor (as for brlapi_writeArguments_t),
+ * the text as uint32_t Unicode characters, the and mask, and the or mask.
+ * Frame n (counting from 0) goes into slot n % frames, and published
+ * is only incremented once the frame is complete. */
+#define BRLAPI_SHARED_WINDOW_TEXT_OFFSET sizeof(int32_t)
+#define BRLAPI_SHARED_WINDOW_AND_OFFSET(cells) (BRLAPI_SHARED_WINDOW_TEXT_OFFSET + ((cells) * sizeof(uint32_t)))
+#define BRLAPI_SHARED_WINDOW_OR_OFFSET(cells) (BRLAPI_SHARED_WINDOW_AND_OFFSET((cells)) + (cells))
+#define BRLAPI_SHARED_WINDOW_FRAME_SIZE(cells) ((BRLAPI_SHARED_WINDOW_OR_OFFSET((cells)) + (cells) + 3) & ~3)
+#define BRLAPI_SHARED_WINDOW_SIZE(cells, frames) (sizeof(brlapi_sharedWindowHeader_t) + ((frames) * BRLAPI_SHARED_WINDOW_FRAME_SIZE((cells))))
+
+/** A BRLAPI_PACKET_KEYS packet holds several key codes, in the order in which
+ * they were produced, each encoded as in a BRLAPI_PACKET_KEY packet (the high
+ * 32 bits, then the low 32 bits). It is only sent to clients which enabled
+ * BRLAPI_PARAM_KEY_BATCHING. */
+#define BRLAPI_MAXBATCHEDKEYS 64
+
 /** Flags for parameter values */
 #define BRLAPI_PVF_GLOBAL            0X01    /** Value is the global value */
 
@@ -60,6 +60,10 @@ Samuel Thibault <samuel.thibault@ens-lyon.org>"
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <netinet/in.h>
+
+#ifdef HAVE_MEMFD_CREATE
+#include <sys/mman.h>
+#endif /* HAVE_MEMFD_CREATE */
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <netdb.h>
@@ -71,6 +75,7 @@ Samuel Thibault <samuel.thibault@ens-lyon.org>"
 #endif /* __ANDROID__ */
 
 #include <pthread.h>
+#include <sys/ioctl.h>
 
 #ifdef HAVE_SYS_SELECT_H
 #include <sys/select.h>
@@ -104,6 +109,7 @@ Samuel Thibault <samuel.thibault@ens-lyon.org>"
 #include "io_misc.h"
 #include "scr.h"
 #include "charset.h"
+#include "unicode.h"
 #include "async_signal.h"
 #include "thread.h"
 #include "blink.h"
@@ -208,12 +214,36 @@ typedef struct Connection {
   time_t upTime;
   Packet packet;
   struct Subscription subscriptions;
+  struct {
+    int enabled; /* whether the client accepts BRLAPI_PACKET_KEYS */
+    int listed; /* whether it is in the keyBatchConnections list */
+    unsigned int count;
+    uint32_t codes[BRLAPI_MAXBATCHEDKEYS][2];
+    struct Connection *next;
+  } keyBatch;
+  struct {
+    brlapi_param_connectionStatistics_t values;
+    int watching; /* whether it counts in serverStatistics.watchers */
+  } statistics;
+#ifdef HAVE_MEMFD_CREATE
+  struct {
+    const unsigned char *address; /* read-only mapping of the client's segment */
+    size_t size;
+    /* validated copies, since the client can still write the header */
+    uint32_t cells;
+    uint32_t frames;
+    uint32_t frameSize;
+    uint32_t shown; /* count of published frames when last read */
+  } sharedWindow;
+#endif /* HAVE_MEMFD_CREATE */
 } Connection;
 
 typedef struct Tty {
   int focus;
   int number;
   struct Connection *connections;
+  KeyrangeIndex *keyIndex; /* accepted keys of the connections, NULL to scan them */
+  unsigned keyIndexStale:1; /* keyIndex must be rebuilt before it's used */
   struct Tty *father; /* father */
   struct Tty **prevnext,*next; /* siblings */
   struct Tty *subttys; /* children */
@@ -317,6 +347,59 @@ static BrailleDisplay *disp; /* Parameter to pass to braille drivers */
 
 static int coreActive; /* Whether core is active */
 static int offline; /* Whether device is offline */
+
+/* Keys produced while keyBatchLevel isn't 0 are sent together by endKeyBatch
+ * to the connections in this list */
+static unsigned int keyBatchLevel = 0;
+static Connection *keyBatchConnections = NULL;
+
+/* Activity counters, see BRLAPI_PARAM_*_STATISTICS. Those which both threads
+ * update go through addStatistic, and durations are only measured while
+ * serverStatistics.watchers isn't 0 */
+static brlapi_param_serverStatistics_t serverStatistics;
+
+#define PACKET_STATISTICS_TYPES \
+  PACKET_STATISTICS_TYPE(VERSION) \
+  PACKET_STATISTICS_TYPE(AUTH) \
+  PACKET_STATISTICS_TYPE(GETDRIVERNAME) \
+  PACKET_STATISTICS_TYPE(GETMODELID) \
+  PACKET_STATISTICS_TYPE(GETDISPLAYSIZE) \
+  PACKET_STATISTICS_TYPE(ENTERTTYMODE) \
+  PACKET_STATISTICS_TYPE(SETFOCUS) \
+  PACKET_STATISTICS_TYPE(LEAVETTYMODE) \
+  PACKET_STATISTICS_TYPE(KEY) \
+  PACKET_STATISTICS_TYPE(KEYS) \
+  PACKET_STATISTICS_TYPE(IGNOREKEYRANGES) \
+  PACKET_STATISTICS_TYPE(ACCEPTKEYRANGES) \
+  PACKET_STATISTICS_TYPE(WRITE) \
+  PACKET_STATISTICS_TYPE(ENTERRAWMODE) \
+  PACKET_STATISTICS_TYPE(LEAVERAWMODE) \
+  PACKET_STATISTICS_TYPE(PACKET) \
+  PACKET_STATISTICS_TYPE(ACK) \
+  PACKET_STATISTICS_TYPE(ERROR) \
+  PACKET_STATISTICS_TYPE(EXCEPTION) \
+  PACKET_STATISTICS_TYPE(SUSPENDDRIVER) \
+  PACKET_STATISTICS_TYPE(RESUMEDRIVER) \
+  PACKET_STATISTICS_TYPE(SYNCHRONIZE) \
+  PACKET_STATISTICS_TYPE(PARAM_VALUE) \
+  PACKET_STATISTICS_TYPE(PARAM_REQUEST) \
+  PACKET_STATISTICS_TYPE(PARAM_UPDATE)
+
+/* Each packet type's index within packetStatistics, so that it needn't be
+ * searched for when a packet is counted */
+typedef enum {
+#define PACKET_STATISTICS_TYPE(name) PACKET_STATISTICS_##name,
+  PACKET_STATISTICS_TYPES
+#undef PACKET_STATISTICS_TYPE
+  PACKET_STATISTICS_OTHER /* any other type - must be last */
+} PacketStatisticsIndex;
+
+static brlapi_param_packetStatistics_t packetStatistics[] = {
+#define PACKET_STATISTICS_TYPE(name) [PACKET_STATISTICS_##name] = { .type = BRLAPI_PACKET_##name },
+  PACKET_STATISTICS_TYPES
+#undef PACKET_STATISTICS_TYPE
+  [PACKET_STATISTICS_OTHER] = { .type = 0 }
+};
 static int driverConstructed; /* Whether device is really opened, protected by apiDriverMutex */
 static int driverConstructing; /* Whether device being constructed, protected by apiDriverMutex */
 static wchar_t *coreWindowText; /* Last text written by the core */
@@ -492,6 +575,132 @@ static int flushOutput(void) {
   return fbo.flushed;
 }
 
+/****************************************************************************/
+/** STATISTICS                                                             **/
+/****************************************************************************/
+
+static inline void addStatistic(uint64_t *counter, uint64_t amount)
+{
+#ifdef HAVE_SYNC_FETCH_AND_ADD
+  __sync_fetch_and_add(counter, amount);
+#else /* HAVE_SYNC_FETCH_AND_ADD */
+  *counter += amount;
+#endif /* HAVE_SYNC_FETCH_AND_ADD */
+}
+
+static brlapi_param_packetStatistics_t *getPacketStatistics(brlapi_packetType_t type)
+{
+  switch (type) {
+#define PACKET_STATISTICS_TYPE(name) case BRLAPI_PACKET_##name: return &packetStatistics[PACKET_STATISTICS_##name];
+    PACKET_STATISTICS_TYPES
+#undef PACKET_STATISTICS_TYPE
+
+    default:
+      return &packetStatistics[PACKET_STATISTICS_OTHER];
+  }
+}
+
+static void addLatency(brlapi_param_latencyHistogram_t *histogram, uint64_t microseconds)
+{
+  unsigned int bucket = 0;
+
+  while ((bucket < (BRLAPI_PARAM_LATENCY_BUCKETS - 1)) && (microseconds >> bucket)) bucket += 1;
+  histogram->buckets[bucket] += 1;
+
+  histogram->count += 1;
+  histogram->total += microseconds;
+  if (microseconds > histogram->maximum) histogram->maximum = microseconds;
+}
+
+typedef struct {
+  TimeValue start;
+  int active;
+} StatisticsTimer;
+
+static inline void startStatisticsTimer(StatisticsTimer *timer)
+{
+  if ((timer->active = !!serverStatistics.watchers)) getMonotonicTime(&timer->start);
+}
+
+static void stopStatisticsTimer(const StatisticsTimer *timer, brlapi_param_latencyHistogram_t *histogram)
+{
+  if (timer->active) {
+    TimeValue now;
+    int64_t microseconds;
+
+    getMonotonicTime(&now);
+    microseconds = ((int64_t)(now.seconds - timer->start.seconds) * 1000000)
+                 + ((now.nanoseconds - timer->start.nanoseconds) / 1000);
+    addLatency(histogram, MAX(microseconds, 0));
+  }
+}
+
+/* Function : lockConnections */
+/* Locks apiConnectionsMutex on behalf of the core, noting how long it took */
+static void lockConnections(void)
+{
+  StatisticsTimer timer;
+
+  startStatisticsTimer(&timer);
+  lockMutex(&apiConnectionsMutex);
+  stopStatisticsTimer(&timer, &serverStatistics.lockWait);
+}
+
+static void countSentPacket(brlapi_packetType_t type, size_t size)
+{
+  brlapi_param_packetStatistics_t *statistics = getPacketStatistics(type);
+
+  size += BRLAPI_HEADERSIZE;
+  addStatistic(&statistics->packetsSent, 1);
+  addStatistic(&statistics->bytesSent, size);
+  addStatistic(&serverStatistics.packetsSent, 1);
+  addStatistic(&serverStatistics.bytesSent, size);
+}
+
+static ssize_t writePacket(FileDescriptor fd, brlapi_packetType_t type, const void *buf, size_t size)
+{
+  ssize_t res = brlapiserver_writePacket(fd, type, buf, size);
+  if (res >= 0) countSentPacket(type, size);
+  return res;
+}
+
+#ifndef __MINGW32__
+static ssize_t writeDescriptorPacket(FileDescriptor fd, brlapi_packetType_t type, const void *buf, size_t size, int descriptor)
+{
+  ssize_t res = brlapi_writeDescriptorPacket(fd, type, buf, size, descriptor);
+  if (res >= 0) countSentPacket(type, size);
+  return res;
+}
+#endif /* __MINGW32__ */
+
+static void countReceivedPacket(Connection *c, brlapi_packetType_t type, size_t size)
+{
+  brlapi_param_packetStatistics_t *statistics = getPacketStatistics(type);
+
+  size += BRLAPI_HEADERSIZE;
+  statistics->packetsReceived += 1;
+  statistics->bytesReceived += size;
+  serverStatistics.packetsReceived += 1;
+  serverStatistics.bytesReceived += size;
+  c->statistics.values.packetsReceived += 1;
+  c->statistics.values.bytesReceived += size;
+}
+
+/* Function : getQueuedBytes */
+/* Returns how much has been sent to a client but not yet read by it */
+static uint64_t getQueuedBytes(FileDescriptor fd)
+{
+#if defined(__linux__) && defined(TIOCOUTQ)
+  int count;
+  if (ioctl(fd, TIOCOUTQ, &count) != -1) return count;
+#elif defined(FIONWRITE)
+  int count;
+  if (ioctl(fd, FIONWRITE, &count) != -1) return count;
+#endif /* queued bytes */
+
+  return 0;
+}
+
 /****************************************************************************/
 /** PACKET HANDLING                                                        **/
 /****************************************************************************/
@@ -500,7 +709,7 @@ static int flushOutput(void) {
 /* Sends an acknowledgement on the given socket */
 static inline void writeAck(FileDescriptor fd)
 {
-  brlapiserver_writePacket(fd,BRLAPI_PACKET_ACK,NULL,0);
+  writePacket(fd,BRLAPI_PACKET_ACK,NULL,0);
 }
 
 /* Function : writeError */
@@ -509,7 +718,7 @@ static void writeError(FileDescriptor fd, unsigned int err)
 {
   uint32_t code = htonl(err);
   logMessage(LOG_CATEGORY(SERVER_EVENTS), "error %u on fd %"PRIfd, err, fd);
-  brlapiserver_writePacket(fd,BRLAPI_PACKET_ERROR,&code,sizeof(code));
+  writePacket(fd,BRLAPI_PACKET_ERROR,&code,sizeof(code));
 }
 
 /* Function : writeException */
@@ -525,15 +734,73 @@ static void writeException(FileDescriptor fd, unsigned int err, brlapi_packetTyp
   errorPacket->type = htonl(type);
   esize = MIN(size, BRLAPI_MAXPACKETSIZE-hdrsize);
   if ((packet!=NULL) && (size!=0)) memcpy(&errorPacket->packet, &packet->data, esize);
-  brlapiserver_writePacket(fd,BRLAPI_PACKET_EXCEPTION,&epacket.data, hdrsize+esize);
+  writePacket(fd,BRLAPI_PACKET_EXCEPTION,&epacket.data, hdrsize+esize);
+}
+
+static void writeKeyBatch(Connection *c) {
+  unsigned int count = c->keyBatch.count;
+
+  if (count) {
+    logMessage(LOG_CATEGORY(SERVER_EVENTS), "writing %u batched keys to fd %"PRIfd,count,c->fd);
+
+    if (count == 1) {
+      writePacket(c->fd,BRLAPI_PACKET_KEY,c->keyBatch.codes[0],sizeof(c->keyBatch.codes[0]));
+    } else {
+      writePacket(c->fd,BRLAPI_PACKET_KEYS,c->keyBatch.codes,count*sizeof(c->keyBatch.codes[0]));
+    }
+
+    c->keyBatch.count = 0;
+  }
 }
 
-static void writeKey(FileDescriptor fd, brlapi_keyCode_t key) {
+/* Function : writeKey */
+/* Sends a key to the given connection, or batches it if it wants that */
+/* must be called with apiConnectionsMutex locked */
+static void writeKey(Connection *c, brlapi_keyCode_t key) {
   uint32_t buf[2];
   buf[0] = htonl(key >> 32);
   buf[1] = htonl(key & 0xffffffff);
-  logMessage(LOG_CATEGORY(SERVER_EVENTS), "writing key %08"PRIx32" %08"PRIx32" to fd %"PRIfd,buf[0],buf[1],fd);
-  brlapiserver_writePacket(fd,BRLAPI_PACKET_KEY,&buf,sizeof(buf));
+
+  serverStatistics.keysDelivered++;
+  c->statistics.values.keysDelivered++;
+
+  if (keyBatchLevel && c->keyBatch.enabled) {
+    logMessage(LOG_CATEGORY(SERVER_EVENTS), "batching key %08"PRIx32" %08"PRIx32" for fd %"PRIfd,buf[0],buf[1],c->fd);
+
+    if (!c->keyBatch.listed) {
+      c->keyBatch.next = keyBatchConnections;
+      keyBatchConnections = c;
+      c->keyBatch.listed = 1;
+    }
+
+    memcpy(c->keyBatch.codes[c->keyBatch.count++], buf, sizeof(buf));
+    if (c->keyBatch.count == ARRAY_COUNT(c->keyBatch.codes)) writeKeyBatch(c);
+    return;
+  }
+
+  logMessage(LOG_CATEGORY(SERVER_EVENTS), "writing key %08"PRIx32" %08"PRIx32" to fd %"PRIfd,buf[0],buf[1],c->fd);
+  writePacket(c->fd,BRLAPI_PACKET_KEY,&buf,sizeof(buf));
+}
+
+/* Function : beginKeyBatch */
+/* Starts gathering the keys which the driver produces */
+/* must be called with apiConnectionsMutex locked */
+static void beginKeyBatch(void) {
+  keyBatchLevel += 1;
+}
+
+/* Function : endKeyBatch */
+/* Sends the gathered keys, several at once to each connection */
+/* must be called with apiConnectionsMutex locked */
+static void endKeyBatch(void) {
+  if (!(keyBatchLevel -= 1)) {
+    while (keyBatchConnections) {
+      Connection *c = keyBatchConnections;
+      keyBatchConnections = c->keyBatch.next;
+      c->keyBatch.listed = 0;
+      writeKeyBatch(c);
+    }
+  }
 }
 
 typedef int(*PacketHandler)(Connection *, brlapi_packetType_t, brlapi_packet_t *, size_t);
@@ -663,6 +930,15 @@ static Connection *createConnection(FileDescriptor fd, time_t currentTime)
   c->how = 0;
   c->retainDots = 1;
   c->acceptedKeys = NULL;
+  c->keyBatch.enabled = 0;
+  c->keyBatch.listed = 0;
+  c->keyBatch.count = 0;
+  memset(&c->statistics.values, 0, sizeof(c->statistics.values));
+  c->statistics.watching = 0;
+#ifdef HAVE_MEMFD_CREATE
+  c->sharedWindow.address = NULL;
+  c->sharedWindow.size = 0;
+#endif /* HAVE_MEMFD_CREATE */
   c->upTime = currentTime;
   c->brailleWindow.text = NULL;
   c->brailleWindow.andAttr = NULL;
@@ -683,6 +959,62 @@ out:
   return NULL;
 }
 
+#ifdef HAVE_MEMFD_CREATE
+/* Function : detachSharedWindow */
+/* Stops reading display writes from the client's shared window */
+static void detachSharedWindow(Connection *c)
+{
+  if (c->sharedWindow.address) {
+    munmap((void *)c->sharedWindow.address, c->sharedWindow.size);
+    c->sharedWindow.address = NULL;
+    c->sharedWindow.size = 0;
+  }
+}
+
+/* Function : attachSharedWindow */
+/* Maps the client's shared window, returns NULL or an error message */
+static const char *attachSharedWindow(Connection *c, int descriptor, size_t size)
+{
+  const void *address;
+  brlapi_sharedWindowHeader_t header;
+  struct stat status;
+  int seals;
+
+  if (size < sizeof(header)) return "shared window too small";
+  if (fstat(descriptor, &status) == -1) return "shared window not accessible";
+  if (status.st_size != size) return "shared window size mismatch";
+
+  /* the client mustn't be able to pull the pages out from under us */
+  seals = fcntl(descriptor, F_GET_SEALS);
+  if ((seals == -1) || !(seals & F_SEAL_SHRINK)) return "shared window not sealed";
+
+  address = mmap(NULL, size, PROT_READ, MAP_SHARED, descriptor, 0);
+  if (address == MAP_FAILED) return "shared window not mappable";
+
+  /* the client can still write to the mapping, so only the copy which has
+   * been validated may be used */
+  memcpy(&header, address, sizeof(header));
+
+  if ((header.magic != BRLAPI_SHARED_WINDOW_MAGIC) ||
+      (header.cells != displaySize) ||
+      (header.frames < 2) ||
+      (header.frameSize != BRLAPI_SHARED_WINDOW_FRAME_SIZE(header.cells)) ||
+      (BRLAPI_SHARED_WINDOW_SIZE(header.cells, header.frames) != size)) {
+    munmap((void *)address, size);
+    return "invalid shared window";
+  }
+
+  detachSharedWindow(c);
+  c->sharedWindow.address = address;
+  c->sharedWindow.size = size;
+  c->sharedWindow.cells = header.cells;
+  c->sharedWindow.frames = header.frames;
+  c->sharedWindow.frameSize = header.frameSize;
+  c->sharedWindow.shown = 0;
+  return NULL;
+}
+#endif /* HAVE_MEMFD_CREATE */
+
 /* Function : freeConnection */
 /* Frees all resources associated to a connection */
 static void freeConnection(Connection *c)
@@ -702,9 +1034,18 @@ static void freeConnection(Connection *c)
     unlockMutex(&apiParamMutex);
 
     if (c->auth != 1) unauthConnections--;
+    if (c->statistics.watching) serverStatistics.watchers--;
     closeFileDescriptor(c->fd);
   }
 
+#ifndef __MINGW32__
+  brlapi_discardPacket(&c->packet);
+#endif /* __MINGW32__ */
+
+#ifdef HAVE_MEMFD_CREATE
+  detachSharedWindow(c);
+#endif /* HAVE_MEMFD_CREATE */
+
   pthread_mutex_destroy(&c->brailleWindowMutex);
   unsetAddressName(&c->brailleWindowMutex);
 
@@ -801,10 +1142,63 @@ static inline void removeTty(Tty *toremove)
 /* frees a tty */
 static inline void freeTty(Tty *tty)
 {
+  freeKeyrangeIndex(tty->keyIndex);
   freeConnection(tty->connections);
   free(tty);
 }
 
+/* Function: invalidateKeyIndex */
+/* Must be called with apiConnectionsMutex locked whenever the accepted */
+/* keys of the tty's connections or the connections themselves change */
+/* The index is only rebuilt when the next key is dispatched, so that a */
+/* client which sends many accept/ignore packets in a row doesn't pay for */
+/* a rebuild after each of them */
+static void invalidateKeyIndex(Tty *tty)
+{
+  freeKeyrangeIndex(tty->keyIndex);
+  tty->keyIndex = NULL;
+  tty->keyIndexStale = 1;
+}
+
+/* Function: updateKeyIndex */
+/* Compiles the accepted keys of the tty's connections, so that whoGetsKey */
+/* needn't lock and scan each of them: must be called with */
+/* apiConnectionsMutex locked */
+static void updateKeyIndex(Tty *tty)
+{
+  Connection *c;
+  unsigned int count = 0;
+
+  freeKeyrangeIndex(tty->keyIndex);
+  tty->keyIndex = NULL;
+  tty->keyIndexStale = 0;
+
+  for (c=tty->connections->next; c!=tty->connections; c=c->next) count++;
+
+  {
+    KeyrangeList *lists[count+1];
+    void *owners[count+1];
+    unsigned int i = 0;
+
+    for (c=tty->connections->next; c!=tty->connections; c=c->next) {
+      lockMutex(&c->acceptedKeysMutex);
+      lists[i] = c->acceptedKeys;
+      owners[i] = c;
+      i++;
+    }
+
+    tty->keyIndex = newKeyrangeIndex(lists, owners, count);
+
+    for (c=tty->connections->next; c!=tty->connections; c=c->next) {
+      unlockMutex(&c->acceptedKeysMutex);
+    }
+  }
+
+  if (!tty->keyIndex) {
+    logMessage(LOG_WARNING, "no memory for the key index of tty %#010x", tty->number);
+  }
+}
+
 /****************************************************************************/
 /** COMMUNICATION PROTOCOL HANDLING                                        **/
 /****************************************************************************/
@@ -821,7 +1215,7 @@ static int handleGetDriver(Connection *c, brlapi_packetType_t type, size_t size,
   int len = strlen(str);
   CHECKERR(size==0,BRLAPI_ERROR_INVALID_PACKET,"packet should be empty");
   CHECKERR(!c->raw,BRLAPI_ERROR_ILLEGAL_INSTRUCTION,"not allowed in raw mode");
-  brlapiserver_writePacket(c->fd, type, str, len+1);
+  writePacket(c->fd, type, str, len+1);
   return 0;
 }
 
@@ -839,7 +1233,7 @@ static int handleGetDisplaySize(Connection *c, brlapi_packetType_t type, brlapi_
 {
   CHECKERR(size==0,BRLAPI_ERROR_INVALID_PACKET,"packet should be empty");
   CHECKERR(!c->raw,BRLAPI_ERROR_ILLEGAL_INSTRUCTION,"not allowed in raw mode");
-  brlapiserver_writePacket(c->fd,BRLAPI_PACKET_GETDISPLAYSIZE,&displayDimensions[0],sizeof(displayDimensions));
+  writePacket(c->fd,BRLAPI_PACKET_GETDISPLAYSIZE,&displayDimensions[0],sizeof(displayDimensions));
   return 0;
 }
 
@@ -929,6 +1323,8 @@ static int handleEnterTtyMode(Connection *c, brlapi_packetType_t type, brlapi_pa
     tty = tty2;
   }
   if (c->tty) {
+    /* initializeAcceptedKeys changed its ranges */
+    invalidateKeyIndex(c->tty);
     unlockMutex(&apiConnectionsMutex);
     if (c->tty == tty) {
       if (c->how==how) {
@@ -952,6 +1348,7 @@ static int handleEnterTtyMode(Connection *c, brlapi_packetType_t type, brlapi_pa
   c->how = how;
   __removeConnection(c);
   __addConnectionSorted(c,tty->connections);
+  invalidateKeyIndex(tty);
   unlockMutex(&apiConnectionsMutex);
   writeAck(c->fd);
   logMessage(LOG_CATEGORY(SERVER_EVENTS), "fd %"PRIfd" taking control of tty %#010x (how=%d)",c->fd,tty->number,how);
@@ -976,9 +1373,13 @@ static void doLeaveTty(Connection *c)
   Tty *tty = c->tty;
   logMessage(LOG_CATEGORY(SERVER_EVENTS), "fd %"PRIfd" releasing tty %#010x",c->fd,tty->number);
   c->tty = NULL;
+#ifdef HAVE_MEMFD_CREATE
+  detachSharedWindow(c);
+#endif /* HAVE_MEMFD_CREATE */
   lockMutex(&apiConnectionsMutex);
   __removeConnection(c);
   __addConnection(c,notty.connections);
+  invalidateKeyIndex(tty);
   unlockMutex(&apiConnectionsMutex);
   freeKeyrangeList(&c->acceptedKeys);
   freeBrailleWindow(&c->brailleWindow);
@@ -1016,6 +1417,9 @@ static int handleKeyRanges(Connection *c, brlapi_packetType_t type, brlapi_packe
     }
   }
   unlockMutex(&c->acceptedKeysMutex);
+  lockMutex(&apiConnectionsMutex);
+  invalidateKeyIndex(c->tty);
+  unlockMutex(&apiConnectionsMutex);
   if (!res) writeAck(c->fd);
   return 0;
 }
@@ -1062,6 +1466,71 @@ convertFromUTF8 (Connection *c, wchar_t *outBuff, size_t *outLeft, const char *i
   return 1;
 }
 
+#ifdef HAVE_MEMFD_CREATE
+/* Function : handleSharedWindowWrite */
+/* Shows the latest frame the client published in its shared window */
+static int handleSharedWindowWrite(Connection *c, brlapi_packetType_t type, brlapi_packet_t *packet, size_t size)
+{
+  const brlapi_sharedWindowHeader_t *header = (const void *)c->sharedWindow.address;
+  const volatile uint32_t *published = &header->published;
+  unsigned int cells = c->sharedWindow.cells;
+  wchar_t text[cells];
+  unsigned char andAttr[cells];
+  unsigned char orAttr[cells];
+  int32_t cursor;
+  uint32_t count;
+  int attempts = 0;
+
+  CHECKEXC(size==sizeof(uint32_t), BRLAPI_ERROR_INVALID_PACKET, "shared window write with fields");
+  CHECKEXC(header, BRLAPI_ERROR_ILLEGAL_INSTRUCTION, "no shared window");
+  CHECKEXC(cells==displaySize, BRLAPI_ERROR_INVALID_PARAMETER, "shared window doesn't match the display");
+
+  while (1) {
+    /* doorbells for frames which have already been shown are coalesced */
+    if ((count = *published) == c->sharedWindow.shown) return 0;
+    __sync_synchronize();
+
+    {
+      const unsigned char *frame = (const unsigned char *)(header + 1) +
+                                   (((count - 1) % c->sharedWindow.frames) * c->sharedWindow.frameSize);
+      const uint32_t *frameText = (const uint32_t *)(frame + BRLAPI_SHARED_WINDOW_TEXT_OFFSET);
+      unsigned int i;
+
+      memcpy(&cursor, frame, sizeof(cursor));
+      memcpy(andAttr, frame + BRLAPI_SHARED_WINDOW_AND_OFFSET(cells), cells);
+      memcpy(orAttr, frame + BRLAPI_SHARED_WINDOW_OR_OFFSET(cells), cells);
+
+      for (i=0; i<cells; i+=1) {
+        uint32_t character = frameText[i];
+        text[i] = (character <= UNICODE_LAST_CHARACTER)? character: UNICODE_REPLACEMENT_CHARACTER;
+      }
+    }
+
+    /* the slot is only reused once the client has gone all the way around */
+    __sync_synchronize();
+    if ((*published - count) < (c->sharedWindow.frames - 1)) break;
+
+    /* the client is writing faster than we can read - its next doorbell will do */
+    if (++attempts == 3) return 0;
+  }
+
+  c->sharedWindow.shown = count;
+  CHECKEXC(cursor<=(int32_t)displaySize, BRLAPI_ERROR_INVALID_PACKET, "wrong cursor");
+
+  lockMutex(&c->brailleWindowMutex);
+  wmemcpy(c->brailleWindow.text, text, cells);
+  memcpy(c->brailleWindow.andAttr, andAttr, cells);
+  memcpy(c->brailleWindow.orAttr, orAttr, cells);
+  if (cursor >= 0) c->brailleWindow.cursor = cursor;
+  c->brlbufstate = TODISPLAY;
+  c->statistics.values.writes++;
+  unlockMutex(&c->brailleWindowMutex);
+
+  flushOutput();
+  return 0;
+}
+#endif /* HAVE_MEMFD_CREATE */
+
 static int handleWrite(Connection *c, brlapi_packetType_t type, brlapi_packet_t *packet, size_t size)
 {
   brlapi_writeArgumentsPacket_t *wa = &packet->writeArguments;
@@ -1077,6 +1546,9 @@ static int handleWrite(Connection *c, brlapi_packetType_t type, brlapi_packet_t
   CHECKEXC(!c->raw,BRLAPI_ERROR_ILLEGAL_INSTRUCTION,"not allowed in raw mode");
   CHECKEXC(c->tty,BRLAPI_ERROR_ILLEGAL_INSTRUCTION,"not allowed out of tty mode");
   wa->flags = ntohl(wa->flags);
+#ifdef HAVE_MEMFD_CREATE
+  if (wa->flags & BRLAPI_WF_SHARED_WINDOW) return handleSharedWindowWrite(c, type, packet, size);
+#endif /* HAVE_MEMFD_CREATE */
   if ((remaining==sizeof(wa->flags))&&(wa->flags==0)) {
     c->brlbufstate = EMPTY;
     return 0;
@@ -1304,6 +1776,7 @@ static int handleWrite(Connection *c, brlapi_packetType_t type, brlapi_packet_t
   if (cursor >= 0) c->brailleWindow.cursor = cursor;
 
   c->brlbufstate = TODISPLAY;
+  c->statistics.values.writes++;
   unlockMutex(&c->brailleWindowMutex);
   flushOutput();
   return 0;
@@ -1472,6 +1945,7 @@ PARAM_WRITER(clientPriority)
     if (c->tty) {
       __removeConnection(c);
       __addConnectionSorted(c,c->tty->connections);
+      invalidateKeyIndex(c->tty);
     }
   unlockMutex(&apiConnectionsMutex);
 
@@ -2033,6 +2507,293 @@ PARAM_WRITER(messageLocale)
   return param_writeString(changeMessageLocale, data, size);
 }
 
+/* A reader may set this (apiParamMutex is held) to have a file descriptor
+ * passed along with the parameter value. */
+static int paramReplyDescriptor = -1;
+
+#ifdef HAVE_MEMFD_CREATE
+typedef struct {
+  int descriptor;
+  size_t size;
+} TableSegment;
+
+static TableSegment computerBrailleTableSegment = {
+  .descriptor = -1
+};
+
+static void param_discardSegment(TableSegment *segment)
+{
+  if (segment->descriptor != -1) {
+    close(segment->descriptor);
+    segment->descriptor = -1;
+  }
+}
+
+static int param_isLocalConnection(Connection *c)
+{
+  struct sockaddr_storage address;
+  socklen_t length = sizeof(address);
+
+  if (getsockname(c->fd, (struct sockaddr *)&address, &length) == -1) return 0;
+  return address.ss_family == AF_LOCAL;
+}
+
+static int param_createSegment(TableSegment *segment, const char *name, const void *data, size_t size)
+{
+  int descriptor = memfd_create(name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+
+  if (descriptor != -1) {
+    const unsigned char *from = data;
+    size_t left = size;
+
+    while (left) {
+      ssize_t count = write(descriptor, from, left);
+
+      if (count == -1) {
+        if (errno == EINTR) continue;
+        break;
+      }
+
+      from += count;
+      left -= count;
+    }
+
+    if (!left) {
+      if (fcntl(descriptor, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != -1) {
+        segment->descriptor = descriptor;
+        segment->size = size;
+        return 1;
+      }
+    }
+
+    logSystemError("table segment");
+    close(descriptor);
+  } else {
+    logSystemError("memfd_create");
+  }
+
+  return 0;
+}
+
+static int param_makeComputerBrailleTableSegment(TableSegment *segment)
+{
+  typedef struct {
+    brlapi_param_computerBrailleRowsMask_t mask;
+    brlapi_param_computerBrailleRowCells_t rows[sizeof(brlapi_param_computerBrailleRowsMask_t) * 8];
+  } Table;
+
+  Table *table;
+  int ok;
+
+  if (!(table = malloc(sizeof(*table)))) {
+    logMallocError();
+    return 0;
+  }
+
+  lockTextTable();
+  {
+    size_t maskSize = getTextTableRowsMask(textTable, table->mask, sizeof(table->mask));
+    brlapi_param_computerBrailleRowCells_t *row = table->rows;
+    uint32_t rowIndex;
+
+    memset(&table->mask[maskSize], 0, sizeof(table->mask) - maskSize);
+
+    for (rowIndex=0; rowIndex<ARRAY_COUNT(table->rows); rowIndex+=1) {
+      if (table->mask[rowIndex / 8] & (1 << (rowIndex % 8))) {
+        if (!getTextTableRowCells(textTable, rowIndex, row->cells, row->defined)) {
+          memset(row, 0, sizeof(*row));
+        }
+
+        row += 1;
+      }
+    }
+
+    ok = param_createSegment(segment, "brltty-computer-braille-table",
+                             table, (void *)row - (void *)table);
+  }
+  unlockTextTable();
+
+  free(table);
+  return ok;
+}
+#endif /* HAVE_MEMFD_CREATE */
+
+/* BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE_SEGMENT */
+PARAM_READER(computerBrailleTableSegment)
+{
+#ifdef HAVE_MEMFD_CREATE
+  brlapi_param_computerBrailleTableSegment_t *value = data;
+  TableSegment *segment = &computerBrailleTableSegment;
+
+  if (c && !param_isLocalConnection(c)) return "segments can only be passed over local connections";
+
+  if (segment->descriptor == -1) {
+    if (!param_makeComputerBrailleTableSegment(segment)) {
+      return "computer braille table segment not available";
+    }
+  }
+
+  *value = segment->size;
+  *size = sizeof(*value);
+  if (c) paramReplyDescriptor = segment->descriptor;
+  return NULL;
+#else /* HAVE_MEMFD_CREATE */
+  return "segments not supported";
+#endif /* HAVE_MEMFD_CREATE */
+}
+
+/* BRLAPI_PARAM_SHARED_WINDOW */
+PARAM_READER(sharedWindow)
+{
+  brlapi_param_sharedWindow_t *sharedWindow = data;
+  *size = sizeof(*sharedWindow);
+
+#ifdef HAVE_MEMFD_CREATE
+  *sharedWindow = c->sharedWindow.size;
+#else /* HAVE_MEMFD_CREATE */
+  *sharedWindow = 0;
+#endif /* HAVE_MEMFD_CREATE */
+
+  return NULL;
+}
+
+PARAM_WRITER(sharedWindow)
+{
+  const brlapi_param_sharedWindow_t *sharedWindow = data;
+  PARAM_ASSERT_SIZE(sharedWindow);
+
+#ifdef HAVE_MEMFD_CREATE
+  int descriptor = brlapi_takePacketDescriptor(&c->packet);
+  const char *error = NULL;
+
+  if (!*sharedWindow) {
+    detachSharedWindow(c);
+  } else if (descriptor == -1) {
+    error = "shared window not passed";
+  } else if (!c->tty || c->raw) {
+    error = "shared window only allowed in tty mode";
+  } else {
+    error = attachSharedWindow(c, descriptor, *sharedWindow);
+  }
+
+  if (descriptor != -1) close(descriptor);
+  return error;
+#else /* HAVE_MEMFD_CREATE */
+  return "shared windows not supported";
+#endif /* HAVE_MEMFD_CREATE */
+}
+
+/* BRLAPI_PARAM_KEY_BATCHING */
+PARAM_READER(keyBatching)
+{
+  brlapi_param_keyBatching_t *keyBatching = data;
+  *size = sizeof(*keyBatching);
+  *keyBatching = c->keyBatch.enabled;
+  return NULL;
+}
+
+PARAM_WRITER(keyBatching)
+{
+  const brlapi_param_keyBatching_t *keyBatching = data;
+  PARAM_ASSERT_SIZE(keyBatching);
+  c->keyBatch.enabled = *keyBatching;
+  return NULL;
+}
+
+/* Durations are only measured once somebody is interested in them */
+static void param_watchStatistics(Connection *c)
+{
+  if (!c->statistics.watching) {
+    c->statistics.watching = 1;
+    serverStatistics.watchers++;
+  }
+}
+
+static unsigned int param_countConnections(const Tty *tty)
+{
+  unsigned int count = 0;
+  const Connection *c;
+  const Tty *t;
+
+  for (c=tty->connections->next; c!=tty->connections; c=c->next) count += 1;
+  for (t=tty->subttys; t; t=t->next) count += param_countConnections(t);
+  return count;
+}
+
+/* Finds the connection with the given index, in the same order as it is
+ * counted, and decrements the index by the number of connections passed */
+static Connection *param_findConnection(Tty *tty, brlapi_param_subparam_t *index)
+{
+  Connection *c;
+  Tty *t;
+
+  for (c=tty->connections->next; c!=tty->connections; c=c->next) {
+    if (!*index) return c;
+    *index -= 1;
+  }
+
+  for (t=tty->subttys; t; t=t->next)
+    if ((c = param_findConnection(t, index))) return c;
+
+  return NULL;
+}
+
+/* BRLAPI_PARAM_SERVER_STATISTICS */
+PARAM_READER(serverStatistics)
+{
+  brlapi_param_serverStatistics_t *statistics = data;
+  *size = sizeof(*statistics);
+  param_watchStatistics(c);
+
+  lockMutex(&apiConnectionsMutex);
+    *statistics = serverStatistics;
+    statistics->connections = param_countConnections(&notty) + param_countConnections(&ttys);
+  unlockMutex(&apiConnectionsMutex);
+
+  statistics->packetTypes = ARRAY_COUNT(packetStatistics);
+  return NULL;
+}
+
+/* BRLAPI_PARAM_CONNECTION_STATISTICS */
+PARAM_READER(connectionStatistics)
+{
+  brlapi_param_connectionStatistics_t *statistics = data;
+  brlapi_param_subparam_t index = subparam;
+  Connection *connection;
+  param_watchStatistics(c);
+
+  lockMutex(&apiConnectionsMutex);
+    if (!(connection = param_findConnection(&notty, &index))) {
+      connection = param_findConnection(&ttys, &index);
+    }
+
+    if (connection) {
+      *statistics = connection->statistics.values;
+      statistics->identifier = (uintptr_t)connection->fd;
+      statistics->tty = connection->tty? (uint32_t)connection->tty->number: UINT64_MAX;
+      statistics->priority = connection->client_priority;
+      statistics->upTime = time(NULL) - connection->upTime;
+      statistics->bytesQueued = getQueuedBytes(connection->fd);
+    }
+  unlockMutex(&apiConnectionsMutex);
+
+  if (!connection) return "no such connection";
+  *size = sizeof(*statistics);
+  return NULL;
+}
+
+/* BRLAPI_PARAM_PACKET_STATISTICS */
+PARAM_READER(packetStatistics)
+{
+  brlapi_param_packetStatistics_t *statistics = data;
+  param_watchStatistics(c);
+
+  if (subparam >= ARRAY_COUNT(packetStatistics)) return "no such packet type";
+  *statistics = packetStatistics[subparam];
+  *size = sizeof(*statistics);
+  return NULL;
+}
+
 typedef struct {
   unsigned local:1;
   unsigned global:1;
@@ -2228,6 +2989,40 @@ static const ParamDispatch paramDispatch[BRLAPI_PARAM_COUNT] = {
     .read = param_messageLocale_read,
     .write = param_messageLocale_write,
   },
+
+  [BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE_SEGMENT] = {
+    .global = 1,
+    .rootParameter = BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE,
+    .read = param_computerBrailleTableSegment_read,
+  },
+
+  [BRLAPI_PARAM_SHARED_WINDOW] = {
+    .local = 1,
+    .read = param_sharedWindow_read,
+    .write = param_sharedWindow_write,
+  },
+
+  [BRLAPI_PARAM_KEY_BATCHING] = {
+    .local = 1,
+    .read = param_keyBatching_read,
+    .write = param_keyBatching_write,
+  },
+
+//Statistics Parameters
+  [BRLAPI_PARAM_SERVER_STATISTICS] = {
+    .global = 1,
+    .read = param_serverStatistics_read,
+  },
+
+  [BRLAPI_PARAM_CONNECTION_STATISTICS] = {
+    .global = 1,
+    .read = param_connectionStatistics_read,
+  },
+
+  [BRLAPI_PARAM_PACKET_STATISTICS] = {
+    .global = 1,
+    .read = param_packetStatistics_read,
+  },
 };
 
 static inline const ParamDispatch *param_getDispatch(brlapi_param_t parameter)
@@ -2317,7 +3112,7 @@ static void sendConnectionParamUpdate(Connection *c, brlapi_param_t param, brlap
 	&& ((s->flags & BRLAPI_PARAMF_SELF) || (paramUpdateConnection != c)))
     {
       logMessage(LOG_CATEGORY(SERVER_EVENTS), "writing parameter %"PRIx32" update to fd %"PRIfd,param,c->fd);
-      brlapiserver_writePacket(c->fd,BRLAPI_PACKET_PARAM_UPDATE,paramValue,size);
+      writePacket(c->fd,BRLAPI_PACKET_PARAM_UPDATE,paramValue,size);
       break;
     }
   }
@@ -2373,6 +3168,15 @@ void api_updateParameter(brlapi_param_t parameter, brlapi_param_subparam_t subpa
 {
   const ParamDispatch *pd = param_getDispatch(parameter);
 
+#ifdef HAVE_MEMFD_CREATE
+  if (parameter == BRLAPI_PARAM_COMPUTER_BRAILLE_TABLE) {
+    /* clients which still have the old segment mapped keep their copy */
+    lockMutex(&apiParamMutex);
+    param_discardSegment(&computerBrailleTableSegment);
+    unlockMutex(&apiParamMutex);
+  }
+#endif /* HAVE_MEMFD_CREATE */
+
   if (pd) {
     if (pd->global) {
       ParamReader *readHandler = pd->read;
@@ -2500,6 +3304,7 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     paramValue->subparam_hi = paramRequest->subparam_hi;
     paramValue->subparam_lo = paramRequest->subparam_lo;
     size = sizeof(paramValue->data);
+    paramReplyDescriptor = -1;
     const char *error = readHandler(c, param, subparam, flags, paramValue->data, &size);
 
     if (error) {
@@ -2507,7 +3312,16 @@ static int handleParamRequest(Connection *c, brlapi_packetType_t type, brlapi_pa
     } else {
       _brlapi_htonParameter(param, paramValue, size);
       size += sizeof(flags) + sizeof(param) + sizeof(subparam);
-      brlapiserver_writePacket(c->fd,BRLAPI_PACKET_PARAM_VALUE,paramValue,size);
+
+#ifndef __MINGW32__
+      if (paramReplyDescriptor != -1) {
+        writeDescriptorPacket(c->fd,BRLAPI_PACKET_PARAM_VALUE,paramValue,size,paramReplyDescriptor);
+        paramReplyDescriptor = -1;
+      } else
+#endif /* __MINGW32__ */
+      {
+        writePacket(c->fd,BRLAPI_PACKET_PARAM_VALUE,paramValue,size);
+      }
     }
   } else { /* Ack with ack */
     writeAck(c->fd);
@@ -2537,7 +3351,7 @@ static void handleNewConnection(Connection *c)
   brlapi_packet_t versionPacket;
   versionPacket.version.protocolVersion = htonl(BRLAPI_PROTOCOL_VERSION);
 
-  brlapiserver_writePacket(c->fd,BRLAPI_PACKET_VERSION,&versionPacket.data,sizeof(versionPacket.version));
+  writePacket(c->fd,BRLAPI_PACKET_VERSION,&versionPacket.data,sizeof(versionPacket.version));
 }
 
 static int
@@ -2591,7 +3405,7 @@ static int handleUnauthorizedConnection(Connection *c, brlapi_packetType_t type,
 	c->auth = 0;
       }
 
-      brlapiserver_writePacket(c->fd,BRLAPI_PACKET_AUTH,&serverPacket,nbmethods*sizeof(authPacket->type));
+      writePacket(c->fd,BRLAPI_PACKET_AUTH,&serverPacket,nbmethods*sizeof(authPacket->type));
 
       return 0;
     }
@@ -2699,6 +3513,7 @@ static int processRequest(Connection *c, PacketHandlers *handlers)
   }
   size = c->packet.header.size;
   type = c->packet.header.type;
+  countReceivedPacket(c, type, size);
 
   if (c->auth!=1) return handleUnauthorizedConnection(c, type, packet, size);
 
@@ -2726,8 +3541,12 @@ static int processRequest(Connection *c, PacketHandlers *handlers)
     case BRLAPI_PACKET_SYNCHRONIZE: p = handlers->sync; break;
   }
   if (p!=NULL) {
+    StatisticsTimer timer;
+
     logRequest(type, c->fd);
+    startStatisticsTimer(&timer);
     p(c, type, packet, size);
+    stopStatisticsTimer(&timer, &c->statistics.values.requestLatency);
   } else {
     WEXC(c->fd,BRLAPI_ERROR_UNKNOWN_INSTRUCTION, type, packet, size, "unknown packet type %x", type);
   }
@@ -3830,6 +4649,7 @@ THREAD_FUNCTION(runServer) {
             closeFileDescriptor(resfd);
           } else {
 	    unauthConnections++;
+	    serverStatistics.connectionsAccepted++;
 	    addConnection(c, notty.connections);
 	    handleNewConnection(c);
 	  }
@@ -4023,6 +4843,8 @@ static void ttyTerminationHandler(Tty *tty)
     removeFreeConnection(tty->connections->next);
   }
   freeConnection(tty->connections);
+  freeKeyrangeIndex(tty->keyIndex);
+  tty->keyIndex = NULL;
 
   {
     Tty *t = tty->subttys;
@@ -4054,6 +4876,10 @@ static void terminationHandler(void)
   ttyTerminationHandler(&notty);
   ttyTerminationHandler(&ttys);
 
+#ifdef HAVE_MEMFD_CREATE
+  param_discardSegment(&computerBrailleTableSegment);
+#endif /* HAVE_MEMFD_CREATE */
+
   if (authDescriptor) {
     authEnd(authDescriptor);
     authDescriptor = NULL;
@@ -4105,7 +4931,7 @@ static int api_writeWindow(BrailleDisplay *brl, const wchar_t *text)
   memcpy(coreWindowDots, brl->buffer, displaySize * sizeof(*coreWindowDots));
   coreWindowCursor = brl->cursor;
   setCurrentRootTty();
-  lockMutex(&apiConnectionsMutex);
+  lockConnections();
   lockMutex(&apiRawMutex);
   if (!offline && !suspendConnection && !rawConnection && !whoFillsTty(&ttys)) {
     lockMutex(&apiDriverMutex);
@@ -4117,6 +4943,19 @@ static int api_writeWindow(BrailleDisplay *brl, const wchar_t *text)
   return ok;
 }
 
+typedef struct {
+  unsigned int how;
+  unsigned int retainDots;
+} KeyRecipientCriteria;
+
+static int isKeyRecipient(void *owner, void *data)
+{
+  const Connection *c = owner;
+  const KeyRecipientCriteria *criteria = data;
+  return (c->how==criteria->how)
+    && (criteria->how != BRL_COMMANDS || (!criteria->retainDots || c->retainDots));
+}
+
 /* Function: whoGetsKey */
 /* Returns the connection which gets that key */
 static Connection *whoGetsKey(Tty *tty, brlapi_keyCode_t code, unsigned int how, unsigned int retainDots)
@@ -4124,6 +4963,16 @@ static Connection *whoGetsKey(Tty *tty, brlapi_keyCode_t code, unsigned int how,
   Connection *c;
   Tty *t;
   int passKey;
+  if (tty->keyIndexStale) updateKeyIndex(tty);
+  if (tty->keyIndex) {
+    KeyRecipientCriteria criteria = {
+      .how = how,
+      .retainDots = retainDots
+    };
+
+    c = searchKeyrangeIndex(tty->keyIndex, code, isKeyRecipient, &criteria);
+    goto found;
+  }
   for (c=tty->connections->next; c!=tty->connections; c = c->next) {
     lockMutex(&c->acceptedKeysMutex);
     passKey = (c->how==how) && (inKeyrangeList(c->acceptedKeys,code) != NULL)
@@ -4149,7 +4998,7 @@ static void broadcastKey(Tty *tty, brlapi_keyCode_t code, unsigned int how) {
   for (c=tty->connections->next; c!=tty->connections; c = c->next) {
     lockMutex(&c->acceptedKeysMutex);
     if ((c->how==how) && (inKeyrangeList(c->acceptedKeys,code) != NULL))
-      writeKey(c->fd,code);
+      writeKey(c,code);
     unlockMutex(&c->acceptedKeysMutex);
   }
   for (t = tty->subttys; t; t = t->next)
@@ -4167,9 +5016,10 @@ static int api__handleKeyEvent(brlapi_keyCode_t clientCode) {
   /* somebody gets the raw code */
   if ((c = whoGetsKey(&ttys, clientCode, BRL_KEYCODES, 0))) {
     logMessage(LOG_CATEGORY(SERVER_EVENTS), "transmitting accepted key %016"BRLAPI_PRIxKEYCODE" to fd %"PRIfd,clientCode,c->fd);
-    writeKey(c->fd,clientCode);
+    writeKey(c,clientCode);
     return 1;
   }
+  serverStatistics.keysUnclaimed++;
   return 0;
 }
 
@@ -4178,8 +5028,11 @@ int api_handleKeyEvent(KeyGroup group, KeyNumber number, int press) {
   logMessage(LOG_CATEGORY(SERVER_EVENTS), "API got key %02x %02x (press %d), thus client code %016"BRLAPI_PRIxKEYCODE, group, number, press, clientCode);
 
   int ret;
-  lockMutex(&apiConnectionsMutex);
+  StatisticsTimer timer;
+  lockConnections();
+  startStatisticsTimer(&timer);
   ret = api__handleKeyEvent(clientCode);
+  stopStatisticsTimer(&timer, &serverStatistics.keyDispatch);
   unlockMutex(&apiConnectionsMutex);
   return ret;
 }
@@ -4224,9 +5077,11 @@ static int api__handleCommand(int command) {
 
     if (c) {
       logMessage(LOG_CATEGORY(SERVER_EVENTS), "transmitting accepted command %lx as client code %016"BRLAPI_PRIxKEYCODE" to fd %"PRIfd,(unsigned long)command,code,c->fd);
-      writeKey(c->fd, code);
+      writeKey(c, code);
       return 1;
     }
+
+    serverStatistics.keysUnclaimed++;
   }
 
   return 0;
@@ -4234,9 +5089,12 @@ static int api__handleCommand(int command) {
 
 int api_handleCommand(int command) {
   int handled;
+  StatisticsTimer timer;
 
-  lockMutex(&apiConnectionsMutex);
+  lockConnections();
+  startStatisticsTimer(&timer);
   handled = api__handleCommand(command);
+  stopStatisticsTimer(&timer, &serverStatistics.keyDispatch);
   unlockMutex(&apiConnectionsMutex);
 
   return handled;
@@ -4251,7 +5109,7 @@ static int api_readCommand(BrailleDisplay *brl, KeyTableCommandContext context)
   int res;
   int command = EOF;
 
-  lockMutex(&apiConnectionsMutex);
+  lockConnections();
   lockMutex(&apiRawMutex);
   if (suspendConnection || !driverConstructed) {
     unlockMutex(&apiRawMutex);
@@ -4264,14 +5122,17 @@ static int api_readCommand(BrailleDisplay *brl, KeyTableCommandContext context)
     if (size<0)
       writeException(rawConnection->fd, BRLAPI_ERROR_DRIVERERROR, BRLAPI_PACKET_PACKET, NULL, 0);
     else if (size)
-      brlapiserver_writePacket(rawConnection->fd,BRLAPI_PACKET_PACKET,&packet.data,size);
+      writePacket(rawConnection->fd,BRLAPI_PACKET_PACKET,&packet.data,size);
     unlockMutex(&apiRawMutex);
     goto out;
   }
 
+  /* keys which the driver produces while reading are sent together */
+  beginKeyBatch();
   lockMutex(&apiDriverMutex);
   res = trueBraille->readCommand(brl,context);
   unlockMutex(&apiDriverMutex);
+  endKeyBatch();
   if (brl->resizeRequired)
     brlResize(brl);
   command = res;
@@ -4291,9 +5152,11 @@ int api_flushOutput(BrailleDisplay *brl) {
   int ok = 1;
   int drain = 0;
   int update = 0;
+  StatisticsTimer timer;
 
+  startStatisticsTimer(&timer);
   lockMutex(&apiParamMutex);
-  lockMutex(&apiConnectionsMutex);
+  lockConnections();
   lockMutex(&apiRawMutex);
   if (suspendConnection) {
     unlockMutex(&apiRawMutex);
@@ -4365,6 +5228,7 @@ int api_flushOutput(BrailleDisplay *brl) {
     drainBrailleOutput(brl, 0);
   unlockMutex(&apiRawMutex);
 out:
+  stopStatisticsTimer(&timer, &serverStatistics.flushLatency);
   unlockMutex(&apiConnectionsMutex);
   unlockMutex(&apiParamMutex);
   return ok;
@@ -0,0 +1,277 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "timing.h"
+#include "brlapi.h"
+
+static char *opt_apiHost;
+static char *opt_authSchemes;
+static char *opt_interval;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "brlapi",
+    .letter = 'b',
+    .argument = "[host][:port]",
+    .setting.string = &opt_apiHost,
+    .description = "BrlAPIa host and/or port to connect to."
+  },
+
+  { .word = "auth",
+    .letter = 'a',
+    .argument = "scheme+...",
+    .setting.string = &opt_authSchemes,
+    .description = "BrlAPI authorization/authentication schemes."
+  },
+
+  { .word = "interval",
+    .letter = 'i',
+    .argument = "seconds",
+    .setting.string = &opt_interval,
+    .internal.setting = "",
+    .description = "Keep reporting at this interval."
+  },
+END_OPTION_TABLE
+
+static int
+getStatistics (brlapi_param_t parameter, brlapi_param_subparam_t subparam, void *statistics, size_t size) {
+  /* a server which has fewer fields leaves the rest of them zero */
+  memset(statistics, 0, size);
+
+  if (brlapi_getParameter(parameter, subparam, BRLAPI_PARAMF_GLOBAL, statistics, size) == -1) {
+    logMessage(LOG_ERR, "statistics not available: %s", brlapi_strerror(&brlapi_error));
+    return 0;
+  }
+
+  return 1;
+}
+
+static void
+writeHeader (const char *header) {
+  size_t length = strlen(header);
+
+  printf("%s\n", header);
+  while (length--) putchar('=');
+  printf("\n\n");
+}
+
+static void
+writeCount (const char *label, uint64_t count) {
+  printf("%s: %" PRIu64 "\n", label, count);
+}
+
+static void
+writeTraffic (const char *label, uint64_t packets, uint64_t bytes) {
+  printf("%s: %" PRIu64 " packets, %" PRIu64 " bytes\n", label, packets, bytes);
+}
+
+static void
+writeLatency (const char *label, const brlapi_param_latencyHistogram_t *histogram) {
+  printf("%s:", label);
+
+  if (!histogram->count) {
+    printf(" not measured\n");
+    return;
+  }
+
+  printf(
+    " %" PRIu64 " times, average %" PRIu64 "us, maximum %" PRIu64 "us\n",
+    histogram->count, histogram->total / histogram->count, histogram->maximum
+  );
+
+  for (unsigned int bucket=0; bucket<BRLAPI_PARAM_LATENCY_BUCKETS; bucket+=1) {
+    uint64_t count = histogram->buckets[bucket];
+    if (!count) continue;
+
+    if (!bucket) {
+      printf("  <1us");
+    } else {
+      uint64_t from = UINT64_C(1) << (bucket - 1);
+      uint64_t to = (UINT64_C(1) << bucket) - 1;
+
+      if (bucket == (BRLAPI_PARAM_LATENCY_BUCKETS - 1)) {
+        printf("  >=%" PRIu64 "us", from);
+      } else if (from == to) {
+        printf("  %" PRIu64 "us", from);
+      } else {
+        printf("  %" PRIu64 "-%" PRIu64 "us", from, to);
+      }
+    }
+
+    printf(": %" PRIu64 "\n", count);
+  }
+}
+
+static int
+writeServerStatistics (brlapi_param_serverStatistics_t *server) {
+  if (!getStatistics(BRLAPI_PARAM_SERVER_STATISTICS, 0, server, sizeof(*server))) return 0;
+
+  writeHeader("Server");
+  writeCount("watchers", server->watchers);
+  writeCount("connections", server->connections);
+  writeCount("connections accepted", server->connectionsAccepted);
+  writeTraffic("received", server->packetsReceived, server->bytesReceived);
+  writeTraffic("sent", server->packetsSent, server->bytesSent);
+  writeCount("keys delivered", server->keysDelivered);
+  writeCount("keys unclaimed", server->keysUnclaimed);
+  writeLatency("flush latency", &server->flushLatency);
+  writeLatency("lock wait", &server->lockWait);
+  writeLatency("key dispatch", &server->keyDispatch);
+  printf("\n");
+  return 1;
+}
+
+static int
+writeConnectionStatistics (const brlapi_param_serverStatistics_t *server) {
+  writeHeader("Connections");
+
+  for (uint64_t index=0; index<server->connections; index+=1) {
+    brlapi_param_connectionStatistics_t connection;
+
+    /* it may have been closed since the server statistics were read */
+    if (!getStatistics(BRLAPI_PARAM_CONNECTION_STATISTICS, index, &connection, sizeof(connection))) break;
+
+    printf("fd %" PRIu64 ":", connection.identifier);
+
+    if (connection.tty == UINT64_MAX) {
+      printf(" no tty");
+    } else {
+      printf(" tty %" PRIu64, connection.tty);
+    }
+
+    printf(
+      ", priority %" PRIu64 ", up %" PRIu64 "s\n",
+      connection.priority, connection.upTime
+    );
+
+    writeTraffic("  received", connection.packetsReceived, connection.bytesReceived);
+    writeCount("  writes", connection.writes);
+    writeCount("  keys delivered", connection.keysDelivered);
+    writeCount("  bytes queued", connection.bytesQueued);
+    writeLatency("  request latency", &connection.requestLatency);
+  }
+
+  printf("\n");
+  return 1;
+}
+
+static int
+writePacketStatistics (const brlapi_param_serverStatistics_t *server) {
+  writeHeader("Packets");
+  printf("%-16s %10s %12s %10s %12s\n", "Type", "Received", "Bytes", "Sent", "Bytes");
+
+  for (uint64_t index=0; index<server->packetTypes; index+=1) {
+    brlapi_param_packetStatistics_t packet;
+    if (!getStatistics(BRLAPI_PARAM_PACKET_STATISTICS, index, &packet, sizeof(packet))) return 0;
+    if (!(packet.packetsReceived || packet.packetsSent)) continue;
+
+    printf(
+      "%-16s %10" PRIu64 " %12" PRIu64 " %10" PRIu64 " %12" PRIu64 "\n",
+      brlapi_getPacketTypeName(packet.type),
+      packet.packetsReceived, packet.bytesReceived,
+      packet.packetsSent, packet.bytesSent
+    );
+  }
+
+  printf("\n");
+  return 1;
+}
+
+static int
+writeStatistics (void) {
+  brlapi_param_serverStatistics_t server;
+
+  if (!writeServerStatistics(&server)) return 0;
+  if (!writeConnectionStatistics(&server)) return 0;
+  if (!writePacketStatistics(&server)) return 0;
+
+  fflush(stdout);
+  if (ferror(stdout)) {
+    logMessage(LOG_ERR, "standard output write error: %s", strerror(errno));
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "brltty-apistat"
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  int interval = 0;
+
+  if (*opt_interval) {
+    static const int minimum = 1;
+    static const int maximum = 3600;
+
+    if (!validateInteger(&interval, opt_interval, &minimum, &maximum)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid interval", opt_interval);
+      return PROG_EXIT_SYNTAX;
+    }
+  }
+
+  if (argc > 0) {
+    logMessage(LOG_ERR, "too many arguments");
+    return PROG_EXIT_SYNTAX;
+  }
+
+  brlapi_connectionSettings_t settings = {
+    .host = opt_apiHost,
+    .auth = opt_authSchemes
+  };
+
+  brlapi_fileDescriptor fileDescriptor = brlapi_openConnection(&settings, &settings);
+
+  if (fileDescriptor != (brlapi_fileDescriptor)(-1)) {
+    /* the server only measures durations once it has been asked for
+     * statistics, so ours only show up from the second report on */
+    while (writeStatistics()) {
+      if (!interval) {
+        exitStatus = PROG_EXIT_SUCCESS;
+        break;
+      }
+
+      approximateDelay(interval * MSECS_PER_SEC);
+    }
+
+    brlapi_closeConnection();
+  } else {
+    logMessage(LOG_ERR, "failed to connect to %s using auth %s: %s",
+               settings.host, settings.auth, brlapi_strerror(&brlapi_error));
+  }
+
+  return exitStatus;
+}
@@ -32,6 +32,8 @@
 #include "utf8.h"
 #include "unicode.h"
 #include "ascii.h"
+#include "thread.h"
+#include "async_signal.h"
 #include "ttb.h"
 #include "ctb.h"
 
@@ -43,6 +45,10 @@ static int opt_reformatText;
 static char *opt_outputWidth;
 static int opt_forceOutput;
 
+#ifdef GOT_PTHREADS
+static char *opt_translationThreads;
+#endif /* GOT_PTHREADS */
+
 BEGIN_OPTION_TABLE(programOptions)
   { .word = "tables-directory",
     .letter = 'T',
@@ -95,6 +101,16 @@ BEGIN_OPTION_TABLE(programOptions)
     .setting.flag = &opt_forceOutput,
     .description = strtext("Force immediate output.")
   },
+
+#ifdef GOT_PTHREADS
+  { .word = "threads",
+    .letter = 'j',
+    .argument = "count",
+    .setting.string = &opt_translationThreads,
+    .internal.setting = "1",
+    .description = strtext("Number of threads to translate with.")
+  },
+#endif /* GOT_PTHREADS */
 END_OPTION_TABLE
 
 static wchar_t *inputBuffer;
@@ -102,10 +118,34 @@ static size_t inputSize;
 static size_t inputLength;
 
 static FILE *outputStream;
-static unsigned char *outputBuffer;
 static int outputWidth;
 static int outputExtend;
 
+typedef struct {
+  unsigned char *cells;
+  size_t cellSize;
+  size_t cellCount;
+
+  size_t *breaks;
+  size_t breakSize;
+  size_t breakCount;
+} ContractedText;
+
+typedef struct {
+  ContractionContext *context;
+  int outputWidth;
+  ContractedText text;
+
+#ifdef GOT_PTHREADS
+  pthread_t thread;
+#endif /* GOT_PTHREADS */
+} TranslationThread;
+
+static TranslationThread *translationThreads;
+static unsigned int translationThreadCount;
+
+#define TRANSLATION_BATCH_SIZE 0X400
+
 #define VERIFICATION_TABLE_EXTENSION ".cvb"
 #define VERIFICATION_SUBTABLE_EXTENSION ".cvi"
 
@@ -147,7 +187,7 @@ flushOutputStream (void *data) {
 }
 
 static int
-putCharacter (unsigned char character, void *data) {
+writeCharacter (unsigned char character, void *data) {
   fputc(character, outputStream);
   return checkOutputStream(data);
 }
@@ -171,51 +211,318 @@ putBrailleCell (unsigned char cell, void *data) {
   return putCellCharacter((UNICODE_BRAILLE_ROW | cell), data);
 }
 
+static void
+initializeContractedText (ContractedText *text) {
+  text->cells = NULL;
+  text->cellSize = 0;
+  text->cellCount = 0;
+
+  text->breaks = NULL;
+  text->breakSize = 0;
+  text->breakCount = 0;
+}
+
+static void
+deallocateContractedText (ContractedText *text) {
+  if (text->cells) free(text->cells);
+  if (text->breaks) free(text->breaks);
+  initializeContractedText(text);
+}
+
 static int
-writeCharacters (const wchar_t *inputLine, size_t inputLength, void *data) {
-  const wchar_t *inputBuffer = inputLine;
+contractCharacters (
+  TranslationThread *tt, ContractedText *text,
+  const wchar_t *characters, size_t length
+) {
+  text->cellCount = 0;
+  text->breakCount = 0;
 
-  while (inputLength) {
-    int inputCount = inputLength;
-    int outputCount = outputWidth;
+  while (length) {
+    int inputCount = length;
+    int outputCount = tt->outputWidth;
 
-    if (!outputBuffer) {
-      if (!(outputBuffer = malloc(outputWidth))) {
-        noMemory(data);
-        return 0;
+    {
+      size_t size = text->cellCount + outputCount;
+
+      if (size > text->cellSize) {
+        unsigned char *cells = realloc(text->cells, (size |= 0XFF));
+        if (!cells) return 0;
+
+        text->cells = cells;
+        text->cellSize = size;
       }
     }
 
-    contractText(contractionTable,
-                 inputBuffer, &inputCount,
-                 outputBuffer, &outputCount,
-                 NULL, CTB_NO_CURSOR);
+    contractTextInContext(tt->context,
+                          characters, &inputCount,
+                          &text->cells[text->cellCount], &outputCount,
+                          NULL, CTB_NO_CURSOR);
 
-    if ((inputCount < inputLength) && outputExtend) {
-      free(outputBuffer);
-      outputBuffer = NULL;
-      outputWidth <<= 1;
+    if ((inputCount < length) && outputExtend) {
+      tt->outputWidth <<= 1;
     } else {
-      {
-        int index;
+      text->cellCount += outputCount;
+      characters += inputCount;
+      length -= inputCount;
+
+      if (length) {
+        if (text->breakCount == text->breakSize) {
+          size_t size = text->breakSize? text->breakSize<<1: 0X10;
+          size_t *breaks = realloc(text->breaks, ARRAY_SIZE(breaks, size));
+          if (!breaks) return 0;
+
+          text->breaks = breaks;
+          text->breakSize = size;
+        }
 
-        for (index=0; index<outputCount; index+=1)
-          if (!putCell(outputBuffer[index], data))
-            return 0;
+        text->breaks[text->breakCount++] = text->cellCount;
       }
+    }
+  }
 
-      inputBuffer += inputCount;
-      inputLength -= inputCount;
+  return 1;
+}
 
-      if (inputLength)
-        if (!putCharacter('\n', data))
-          return 0;
+static int
+putContractedText (const ContractedText *text, void *data) {
+  const size_t *lineBreak = text->breaks;
+  const size_t *end = lineBreak + text->breakCount;
+  size_t index;
+
+  for (index=0; index<text->cellCount; index+=1) {
+    while ((lineBreak < end) && (*lineBreak == index)) {
+      if (!writeCharacter('\n', data)) return 0;
+      lineBreak += 1;
+    }
+
+    if (!putCell(text->cells[index], data)) return 0;
+  }
+
+  while (lineBreak < end) {
+    if (!writeCharacter('\n', data)) return 0;
+    lineBreak += 1;
+  }
+
+  return 1;
+}
+
+#ifdef GOT_PTHREADS
+typedef struct {
+  wchar_t *characters;
+  size_t length;
+
+  unsigned char character;
+  unsigned char contracted:1;
+  ContractedText text;
+} TranslationJob;
+
+static struct {
+  TranslationJob *array;
+  size_t size;
+  size_t count;
+
+  size_t next;
+  pthread_mutex_t mutex;
+} translationJobs = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER
+};
+
+static TranslationJob *
+newTranslationJob (void *data) {
+  if (translationJobs.count == translationJobs.size) {
+    size_t newSize = translationJobs.size? translationJobs.size<<1: TRANSLATION_BATCH_SIZE;
+    TranslationJob *newArray = realloc(translationJobs.array, ARRAY_SIZE(newArray, newSize));
+
+    if (!newArray) {
+      noMemory(data);
+      return NULL;
+    }
+
+    translationJobs.array = newArray;
+    translationJobs.size = newSize;
+  }
+
+  {
+    TranslationJob *job = &translationJobs.array[translationJobs.count++];
+
+    memset(job, 0, sizeof(*job));
+    initializeContractedText(&job->text);
+    return job;
+  }
+}
+
+static
+THREAD_FUNCTION(runTranslationThread) {
+  TranslationThread *tt = argument;
+
+  while (1) {
+    TranslationJob *job;
+
+    lockMutex(&translationJobs.mutex);
+      job = (translationJobs.next < translationJobs.count)?
+            &translationJobs.array[translationJobs.next++]:
+            NULL;
+    unlockMutex(&translationJobs.mutex);
+
+    if (!job) break;
+
+    if (job->characters) {
+      job->contracted = contractCharacters(tt, &job->text, job->characters, job->length);
+    }
+  }
+
+  return NULL;
+}
+
+static int
+processTranslationJobs (void *data) {
+  int ok = 1;
+
+  if (translationJobs.count) {
+    unsigned int started = 1;
+    translationJobs.next = 0;
+
+    while (started < translationThreadCount) {
+      TranslationThread *tt = &translationThreads[started];
+      if (createThread("ctb-translate", &tt->thread, NULL, runTranslationThread, tt) != 0) break;
+      started += 1;
+    }
+
+    runTranslationThread(&translationThreads[0]);
+    while (--started) pthread_join(translationThreads[started].thread, NULL);
+
+    for (size_t index=0; index<translationJobs.count; index+=1) {
+      TranslationJob *job = &translationJobs.array[index];
+
+      if (ok) {
+        if (!job->characters) {
+          if (!writeCharacter(job->character, data)) ok = 0;
+        } else if (!job->contracted) {
+          noMemory(data);
+          ok = 0;
+        } else if (!putContractedText(&job->text, data)) {
+          ok = 0;
+        }
+      }
+
+      if (job->characters) free(job->characters);
+      deallocateContractedText(&job->text);
     }
+
+    translationJobs.count = 0;
   }
 
+  return ok;
+}
+
+static int
+checkTranslationBatch (void *data) {
+  if (translationJobs.count < TRANSLATION_BATCH_SIZE) return 1;
+  return processTranslationJobs(data);
+}
+#endif /* GOT_PTHREADS */
+
+static int
+finishTranslations (void *data) {
+#ifdef GOT_PTHREADS
+  if (!processTranslationJobs(data)) return 0;
+#endif /* GOT_PTHREADS */
+
   return 1;
 }
 
+static int
+putCharacter (unsigned char character, void *data) {
+#ifdef GOT_PTHREADS
+  if (translationThreadCount > 1) {
+    TranslationJob *job = newTranslationJob(data);
+    if (!job) return 0;
+
+    job->character = character;
+    return checkTranslationBatch(data);
+  }
+#endif /* GOT_PTHREADS */
+
+  return writeCharacter(character, data);
+}
+
+static int
+writeCharacters (const wchar_t *inputLine, size_t inputLength, void *data) {
+#ifdef GOT_PTHREADS
+  if (translationThreadCount > 1) {
+    TranslationJob *job = newTranslationJob(data);
+    if (!job) return 0;
+
+    if (!(job->characters = malloc(ARRAY_SIZE(job->characters, inputLength)))) {
+      translationJobs.count -= 1;
+      noMemory(data);
+      return 0;
+    }
+
+    wmemcpy(job->characters, inputLine, inputLength);
+    job->length = inputLength;
+    return checkTranslationBatch(data);
+  }
+#endif /* GOT_PTHREADS */
+
+  {
+    TranslationThread *tt = &translationThreads[0];
+
+    if (!contractCharacters(tt, &tt->text, inputLine, inputLength)) {
+      noMemory(data);
+      return 0;
+    }
+
+    return putContractedText(&tt->text, data);
+  }
+}
+
+static int
+startTranslationThreads (unsigned int count) {
+  if ((translationThreads = calloc(count, sizeof(*translationThreads)))) {
+    translationThreadCount = 0;
+
+    while (translationThreadCount < count) {
+      TranslationThread *tt = &translationThreads[translationThreadCount];
+
+      if (!(tt->context = newContractionContext(contractionTable))) break;
+      tt->outputWidth = outputWidth;
+      initializeContractedText(&tt->text);
+
+      translationThreadCount += 1;
+    }
+
+    if (translationThreadCount == count) return 1;
+  } else {
+    logMallocError();
+  }
+
+  return 0;
+}
+
+static void
+stopTranslationThreads (void) {
+  if (translationThreads) {
+    while (translationThreadCount) {
+      TranslationThread *tt = &translationThreads[--translationThreadCount];
+
+      destroyContractionContext(tt->context);
+      deallocateContractedText(&tt->text);
+    }
+
+    free(translationThreads);
+    translationThreads = NULL;
+  }
+
+#ifdef GOT_PTHREADS
+  if (translationJobs.array) {
+    free(translationJobs.array);
+    translationJobs.array = NULL;
+    translationJobs.size = 0;
+  }
+#endif /* GOT_PTHREADS */
+}
+
 static int
 flushCharacters (wchar_t end, void *data) {
   if (inputLength) {
@@ -297,9 +604,10 @@ writeContractedBraille (const wchar_t *characters, size_t length, void *data) {
   }
   if (!processCharacters(character, length, '\n', data)) return 0;
 
-  if (opt_forceOutput)
-    if (!flushOutputStream(data))
-      return 0;
+  if (opt_forceOutput) {
+    if (!finishTranslations(data)) return 0;
+    if (!flushOutputStream(data)) return 0;
+  }
 
   return 1;
 }
@@ -449,12 +757,22 @@ main (int argc, char *argv[]) {
     PROCESS_OPTIONS(descriptor, argc, argv);
   }
 
+#ifdef ASYNC_CAN_HANDLE_SIGNALS
+#ifdef SIGPIPE
+  /* An external contraction table which terminates unexpectedly mustn't
+   * abort program execution.
+   */
+  asyncIgnoreSignal(SIGPIPE, NULL);
+#endif /* SIGPIPE */
+#endif /* ASYNC_CAN_HANDLE_SIGNALS */
+
   inputBuffer = NULL;
   inputSize = 0;
   inputLength = 0;
 
   outputStream = stdout;
-  outputBuffer = NULL;
+  translationThreads = NULL;
+  translationThreadCount = 0;
 
   if ((outputExtend = !*opt_outputWidth)) {
     outputWidth = 0X80;
@@ -467,6 +785,23 @@ main (int argc, char *argv[]) {
     }
   }
 
+  unsigned int threadCount = 1;
+
+#ifdef GOT_PTHREADS
+  {
+    static const int minimum = 1;
+    static const int maximum = 0X100;
+    int count;
+
+    if (!validateInteger(&count, opt_translationThreads, &minimum, &maximum)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid thread count", opt_translationThreads);
+      return PROG_EXIT_SYNTAX;
+    }
+
+    threadCount = count;
+  }
+#endif /* GOT_PTHREADS */
+
   {
     char *contractionTablePath;
 
@@ -521,11 +856,17 @@ main (int argc, char *argv[]) {
               }
             };
 
-            if ((exitStatus = processInputFiles(argv, argc, &parameters)) == PROG_EXIT_SUCCESS) {
-              if (!(flushCharacters('\n', &lpd) && flushOutputStream(&lpd))) {
-                exitStatus = lpd.exitStatus;
+            if (startTranslationThreads(threadCount)) {
+              if ((exitStatus = processInputFiles(argv, argc, &parameters)) == PROG_EXIT_SUCCESS) {
+                if (!(flushCharacters('\n', &lpd) && finishTranslations(&lpd) && flushOutputStream(&lpd))) {
+                  exitStatus = lpd.exitStatus;
+                }
               }
+            } else {
+              exitStatus = PROG_EXIT_FATAL;
             }
+
+            stopTranslationThreads();
           }
 
           if (textTable) destroyTextTable(textTable);
@@ -553,7 +894,6 @@ main (int argc, char *argv[]) {
     verificationTablePath = NULL;
   }
 
-  if (outputBuffer) free(outputBuffer);
   if (inputBuffer) free(inputBuffer);
   return exitStatus;
 }
@@ -230,7 +230,7 @@ BEGIN_OPTION_TABLE(programOptions)
   { .word = "echo-input",
     .letter = 'e',
     .setting.flag = &opt_echoInput,
-    .description = strtext("Echo (in hexadecimal) input received from the device.")
+    .description = strtext("Echo (in hexadecimal) input received from the device, and the usages (page:usage) that it activates.")
   },
 
   { .word = "input-timeout",
@@ -286,6 +286,29 @@ writeBytesLine (const char *format, const unsigned char *from, size_t count, ...
   return canWriteOutput();
 }
 
+static int
+writeActiveUsages (HidDevice *device, HidReportIdentifier identifier, const unsigned char *report, size_t size) {
+  const HidLayout *layout = hidGetLayout(device);
+  if (!layout) return 1;
+
+  HidUnsignedValue usages[0X40];
+  unsigned int count = hidGetActiveUsages(layout, identifier, report, size, usages, ARRAY_COUNT(usages));
+  if (!count) return 1;
+
+  fprintf(outputStream, "Active Usages:");
+
+  for (unsigned int index=0; index<count; index+=1) {
+    HidUnsignedValue usage = usages[index];
+    fprintf(outputStream, " %04X:%04X", (usage >> 16), (usage & 0XFFFF));
+  }
+
+  fprintf(outputStream, "\n");
+  if (!canWriteOutput()) return 0;
+
+  fflush(outputStream);
+  return canWriteOutput();
+}
+
 static int
 openDevice (HidDevice **device) {
   HidFilter filter = {
@@ -323,9 +346,8 @@ getItems (HidDevice *device) {
 
 static int
 getReportSize (HidDevice *device, HidReportIdentifier identifier, HidReportSize *size) {
-  const HidItemsDescriptor *items = getItems(device);
-  if (!items) return 0;
-  return hidReportSize(items, identifier, size);
+  if (!getItems(device)) return 0;
+  return hidGetReportSize(device, identifier, size);
 }
 
 static void
@@ -441,7 +463,7 @@ performListReports (HidDevice *device) {
     STR_BEGIN(line, sizeof(line));
     STR_PRINTF("Report %02X:", identifier);
 
-    if (hidReportSize(items, identifier, &size)) {
+    if (hidGetReportSize(device, identifier, &size)) {
       typedef struct {
         const char *label;
         const size_t value;
@@ -944,6 +966,7 @@ performEchoInput (HidDevice *device) {
       }
 
       if (!writeBytesLine("Input Report", from, *inputSize)) return 0;
+      if (!writeActiveUsages(device, reportIdentifier, from, *inputSize)) return 0;
       from += *inputSize;
     }
   }
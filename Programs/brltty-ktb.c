@@ -31,8 +31,11 @@
 #include "ktb_keyboard.h"
 #include "brl.h"
 
+#define KEY_TABLE_BENCHMARK_ROUNDS 100
+
 static char *opt_brailleDriver;
 static int opt_audit;
+static int opt_benchmark;
 static int opt_listKeyNames;
 static int opt_listHelpScreen;
 static int opt_listRestructuredText;
@@ -53,6 +56,12 @@ BEGIN_OPTION_TABLE(programOptions)
     .description = strtext("Report problems with the key table.")
   },
 
+  { .word = "benchmark",
+    .letter = 'B',
+    .setting.flag = &opt_benchmark,
+    .description = strtext("Measure key binding lookup throughput.")
+  },
+
   { .word = "keys",
     .letter = 'k',
     .setting.flag = &opt_listKeyNames,
@@ -328,6 +337,12 @@ main (int argc, char *argv[]) {
             }
           }
 
+          if (opt_benchmark) {
+            if (!benchmarkKeyTable(keyTable, KEY_TABLE_BENCHMARK_ROUNDS)) {
+              exitStatus = PROG_EXIT_FATAL;
+            }
+          }
+
           if (opt_listHelpScreen) {
             if (!listKeyTable(keyTable, NULL, hlpWriteLine, NULL)) {
               exitStatus = PROG_EXIT_FATAL;
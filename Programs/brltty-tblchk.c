@@ -0,0 +1,655 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif /* HAVE_SYS_WAIT_H */
+
+#include "log.h"
+#include "program.h"
+#include "options.h"
+#include "parse.h"
+#include "file.h"
+#include "timing.h"
+#include "bitmask.h"
+
+#include "ttb.h"
+#include "ttb_internal.h"
+
+#include "atb.h"
+#include "atb_internal.h"
+
+#include "ctb.h"
+#include "ctb_internal.h"
+
+static char *opt_jobCount;
+static char *opt_outputDirectory;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "jobs",
+    .letter = 'j',
+    .argument = "count",
+    .setting.string = &opt_jobCount,
+    .internal.setting = "",
+    .description = "Number of tables to compile at the same time."
+  },
+
+  { .word = "output-directory",
+    .letter = 'o',
+    .argument = "directory",
+    .setting.string = &opt_outputDirectory,
+    .internal.setting = "",
+    .description = "Directory to write the compiled tables to."
+  },
+END_OPTION_TABLE
+
+typedef struct {
+  void *object;
+  const unsigned char *bytes;
+  size_t size;
+  unsigned int entries;
+} TableData;
+
+typedef struct {
+  const char *extension;
+  int (*load) (const char *path, TableData *data);
+  void (*unload) (TableData *data);
+  unsigned countsEntries:1;
+} TableEntry;
+
+static int
+loadTextTable (const char *path, TableData *data) {
+  TextTable *table = compileTextTable(path);
+  if (!table) return 0;
+
+  data->object = table;
+  data->bytes = table->header.bytes;
+  data->size = table->size;
+  data->entries = 0;
+
+  const TextTableHeader *header = table->header.fields;
+
+  for (unsigned int groupNumber=0; groupNumber<UNICODE_GROUP_COUNT; groupNumber+=1) {
+    TextTableOffset groupOffset = header->unicodeGroups[groupNumber];
+    if (!groupOffset) continue;
+    const UnicodeGroupEntry *group = (const void *)(data->bytes + groupOffset);
+
+    for (unsigned int planeNumber=0; planeNumber<UNICODE_PLANES_PER_GROUP; planeNumber+=1) {
+      TextTableOffset planeOffset = group->planes[planeNumber];
+      if (!planeOffset) continue;
+      const UnicodePlaneEntry *plane = (const void *)(data->bytes + planeOffset);
+
+      for (unsigned int rowNumber=0; rowNumber<UNICODE_ROWS_PER_PLANE; rowNumber+=1) {
+        TextTableOffset rowOffset = plane->rows[rowNumber];
+        if (!rowOffset) continue;
+        const UnicodeRowEntry *row = (const void *)(data->bytes + rowOffset);
+
+        for (unsigned int cellNumber=0; cellNumber<UNICODE_CELLS_PER_ROW; cellNumber+=1) {
+          if (BITMASK_TEST(row->cellDefined, cellNumber)) data->entries += 1;
+        }
+      }
+    }
+  }
+
+  return 1;
+}
+
+static void
+unloadTextTable (TableData *data) {
+  destroyTextTable(data->object);
+}
+
+static int
+loadAttributesTable (const char *path, TableData *data) {
+  AttributesTable *table = compileAttributesTable(path);
+  if (!table) return 0;
+
+  data->object = table;
+  data->bytes = table->header.bytes;
+  data->size = table->size;
+  data->entries = 0;
+  return 1;
+}
+
+static void
+unloadAttributesTable (TableData *data) {
+  destroyAttributesTable(data->object);
+}
+
+static unsigned int
+countContractionRules (const unsigned char *bytes, ContractionTableOffset offset) {
+  unsigned int count = 0;
+
+  while (offset) {
+    const ContractionTableRule *rule = (const void *)(bytes + offset);
+    offset = rule->next;
+    count += 1;
+  }
+
+  return count;
+}
+
+static int
+loadContractionTable (const char *path, TableData *data) {
+  ContractionTable *table = compileContractionTable(path);
+  if (!table) return 0;
+
+  data->object = table;
+  data->bytes = table->data.internal.header.bytes;
+  data->size = table->data.internal.size;
+  data->entries = 0;
+
+  const ContractionTableHeader *header = table->data.internal.header.fields;
+
+  for (unsigned int index=0; index<HASHNUM; index+=1) {
+    data->entries += countContractionRules(data->bytes, header->rules[index]);
+  }
+
+  if (header->characters) {
+    const ContractionTableCharacter *characters = (const void *)(data->bytes + header->characters);
+
+    for (unsigned int index=0; index<header->characterCount; index+=1) {
+      data->entries += countContractionRules(data->bytes, characters[index].rules);
+    }
+  }
+
+  return 1;
+}
+
+static void
+unloadContractionTable (TableData *data) {
+  destroyContractionTable(data->object);
+}
+
+static const TableEntry tableEntries[] = {
+  {
+    .extension = TEXT_TABLE_EXTENSION,
+    .load = loadTextTable,
+    .unload = unloadTextTable,
+    .countsEntries = 1
+  }
+  ,
+  {
+    .extension = ATTRIBUTES_TABLE_EXTENSION,
+    .load = loadAttributesTable,
+    .unload = unloadAttributesTable
+  }
+  ,
+  {
+    .extension = CONTRACTION_TABLE_EXTENSION,
+    .load = loadContractionTable,
+    .unload = unloadContractionTable,
+    .countsEntries = 1
+  }
+  ,
+  {
+    .extension = NULL
+  }
+};
+
+static const TableEntry *
+findTableEntry (const char *extension) {
+  const TableEntry *entry = tableEntries;
+
+  while (entry->extension) {
+    if (strcmp(entry->extension, extension) == 0) return entry;
+    entry += 1;
+  }
+
+  return NULL;
+}
+
+typedef struct {
+  long int microseconds;
+  size_t size;
+  unsigned int entries;
+  unsigned compiled:1;
+  unsigned saved:1;
+} TableResult;
+
+typedef struct {
+  char *path;
+  char *name;
+  const TableEntry *table;
+  TableResult result;
+
+#ifdef HAVE_SYS_WAIT_H
+  pid_t process;
+  int resultPipe;
+#endif /* HAVE_SYS_WAIT_H */
+} TableJob;
+
+typedef struct {
+  TableJob *array;
+  unsigned int size;
+  unsigned int count;
+} TableJobs;
+
+static int
+addTableJob (TableJobs *jobs, const char *path, const char *name, const TableEntry *table) {
+  if (jobs->count == jobs->size) {
+    unsigned int newSize = jobs->size? jobs->size<<1: 0X40;
+    TableJob *newArray = realloc(jobs->array, ARRAY_SIZE(newArray, newSize));
+
+    if (!newArray) {
+      logMallocError();
+      return 0;
+    }
+
+    jobs->array = newArray;
+    jobs->size = newSize;
+  }
+
+  TableJob *job = &jobs->array[jobs->count];
+  memset(job, 0, sizeof(*job));
+  job->table = table;
+
+  if ((job->path = strdup(path))) {
+    if ((job->name = strdup(name))) {
+      jobs->count += 1;
+      return 1;
+    }
+
+    free(job->path);
+  }
+
+  logMallocError();
+  return 0;
+}
+
+static int
+addTableJobs (TableJobs *jobs, const char *path, const char *name) {
+  if (testDirectoryPath(path)) {
+    DIR *directory;
+
+    if (!(directory = opendir(path))) {
+      logMessage(LOG_ERR, "cannot open directory: %s: %s", path, strerror(errno));
+      return 0;
+    }
+
+    int ok = 1;
+    struct dirent *entry;
+
+    while ((entry = readdir(directory))) {
+      if (entry->d_name[0] == '.') continue;
+
+      char *subpath = makePath(path, entry->d_name);
+      char *subname = *name? makePath(name, entry->d_name): strdup(entry->d_name);
+
+      if (subpath && subname) {
+        if (!addTableJobs(jobs, subpath, subname)) ok = 0;
+      } else {
+        logMallocError();
+        ok = 0;
+      }
+
+      if (subname) free(subname);
+      if (subpath) free(subpath);
+      if (!ok) break;
+    }
+
+    closedir(directory);
+    return ok;
+  }
+
+  const char *extension = locatePathExtension(path);
+  if (!extension) return 1;
+
+  const TableEntry *table = findTableEntry(extension);
+  if (!table) return 1;
+
+  if (testProgramPath(path)) {
+    logMessage(LOG_DEBUG, "not compiling executable table: %s", path);
+    return 1;
+  }
+
+  return addTableJob(jobs, path, name, table);
+}
+
+static int
+sortTableJobs (const void *element1, const void *element2) {
+  const TableJob *job1 = element1;
+  const TableJob *job2 = element2;
+  return strcmp(job1->name, job2->name);
+}
+
+static void
+deallocateTableJobs (TableJobs *jobs) {
+  while (jobs->count) {
+    TableJob *job = &jobs->array[--jobs->count];
+    free(job->name);
+    free(job->path);
+  }
+
+  if (jobs->array) free(jobs->array);
+}
+
+/* the source extension is kept so that tables of different types which
+ * have the same name don't collide, and the suffix is added so that an
+ * output directory which is also an input directory doesn't lose its
+ * sources */
+#define COMPILED_TABLE_SUFFIX ".bin"
+
+static char *
+makeCompiledTablePath (const TableJob *job) {
+  char *path = NULL;
+  char *file = makePath(opt_outputDirectory, job->name);
+
+  if (file) {
+    const char *strings[] = {file, COMPILED_TABLE_SUFFIX};
+    path = joinStrings(strings, ARRAY_COUNT(strings));
+    free(file);
+  }
+
+  return path;
+}
+
+static int
+saveCompiledTable (const TableJob *job, const TableData *data) {
+  int ok = 0;
+  char *path = makeCompiledTablePath(job);
+
+  if (path) {
+    if (ensurePathDirectory(path)) {
+      FILE *stream = fopen(path, "wb");
+
+      if (stream) {
+        if (fwrite(data->bytes, 1, data->size, stream) == data->size) ok = 1;
+        if (fclose(stream) == EOF) ok = 0;
+      }
+
+      if (!ok) logMessage(LOG_ERR, "cannot write compiled table: %s: %s", path, strerror(errno));
+    }
+
+    free(path);
+  } else {
+    logMallocError();
+  }
+
+  return ok;
+}
+
+static void
+compileTable (TableJob *job) {
+  TableResult *result = &job->result;
+  TableData data;
+
+  TimeValue start;
+  getMonotonicTime(&start);
+
+  if (job->table->load(job->path, &data)) {
+    TimeValue end;
+    getMonotonicTime(&end);
+
+    result->microseconds = ((end.seconds - start.seconds) * 1000000L)
+                         + ((end.nanoseconds - start.nanoseconds) / 1000);
+
+    result->size = data.size;
+    result->entries = data.entries;
+    result->compiled = 1;
+
+    if (*opt_outputDirectory) {
+      if (saveCompiledTable(job, &data)) result->saved = 1;
+    }
+
+    job->table->unload(&data);
+  }
+}
+
+#ifdef HAVE_SYS_WAIT_H
+static int
+startTableJob (TableJob *job) {
+  int pipeDescriptors[2];
+
+  if (pipe(pipeDescriptors) == -1) {
+    logSystemError("pipe");
+    return 0;
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+  job->process = fork();
+
+  if (job->process == -1) {
+    logSystemError("fork");
+    close(pipeDescriptors[0]);
+    close(pipeDescriptors[1]);
+    return 0;
+  }
+
+  if (!job->process) {
+    close(pipeDescriptors[0]);
+    compileTable(job);
+
+    /* smaller than PIPE_BUF so it's written atomically and without blocking */
+    ssize_t count = write(pipeDescriptors[1], &job->result, sizeof(job->result));
+    _exit((count == sizeof(job->result))? PROG_EXIT_SUCCESS: PROG_EXIT_FATAL);
+  }
+
+  close(pipeDescriptors[1]);
+  job->resultPipe = pipeDescriptors[0];
+  return 1;
+}
+
+static void
+finishTableJob (TableJob *job, int status) {
+  ssize_t count = read(job->resultPipe, &job->result, sizeof(job->result));
+
+  if (count != sizeof(job->result)) {
+    memset(&job->result, 0, sizeof(job->result));
+
+    if (WIFSIGNALED(status)) {
+      logMessage(LOG_ERR, "table compiler terminated by signal %d: %s",
+                 WTERMSIG(status), job->path);
+    } else {
+      logMessage(LOG_ERR, "table compiler failed: %s", job->path);
+    }
+  }
+
+  close(job->resultPipe);
+  job->resultPipe = -1;
+  job->process = 0;
+}
+
+static void
+runTableJobs (TableJobs *jobs, unsigned int limit) {
+  unsigned int next = 0;
+  unsigned int running = 0;
+
+  while ((next < jobs->count) || running) {
+    while ((next < jobs->count) && (running < limit)) {
+      TableJob *job = &jobs->array[next++];
+
+      if (startTableJob(job)) {
+        running += 1;
+      } else {
+        compileTable(job);
+      }
+    }
+
+    if (running) {
+      int status;
+      pid_t process = wait(&status);
+
+      if (process == -1) {
+        if (errno == EINTR) continue;
+        logSystemError("wait");
+        break;
+      }
+
+      for (unsigned int index=0; index<next; index+=1) {
+        TableJob *job = &jobs->array[index];
+
+        if (job->process == process) {
+          finishTableJob(job, status);
+          running -= 1;
+          break;
+        }
+      }
+    }
+  }
+}
+
+#else /* HAVE_SYS_WAIT_H */
+static void
+runTableJobs (TableJobs *jobs, unsigned int limit) {
+  for (unsigned int index=0; index<jobs->count; index+=1) {
+    compileTable(&jobs->array[index]);
+  }
+}
+#endif /* HAVE_SYS_WAIT_H */
+
+static unsigned int
+getDefaultJobCount (void) {
+#ifdef _SC_NPROCESSORS_ONLN
+  long int count = sysconf(_SC_NPROCESSORS_ONLN);
+  if (count > 0) return count;
+#endif /* _SC_NPROCESSORS_ONLN */
+
+  return 1;
+}
+
+static int
+reportTableJobs (const TableJobs *jobs, long int elapsed) {
+  unsigned int failures = 0;
+  long int compileTime = 0;
+  size_t totalSize = 0;
+
+  printf("%10s %10s %8s  %s\n", "time(ms)", "size", "entries", "table");
+
+  for (unsigned int index=0; index<jobs->count; index+=1) {
+    const TableJob *job = &jobs->array[index];
+    const TableResult *result = &job->result;
+
+    if (!result->compiled) {
+      printf("%10s %10s %8s  %s\n", "failed", "-", "-", job->name);
+      failures += 1;
+      continue;
+    }
+
+    if (*opt_outputDirectory && !result->saved) failures += 1;
+    compileTime += result->microseconds;
+    totalSize += result->size;
+
+    char entries[0X10];
+
+    if (job->table->countsEntries) {
+      snprintf(entries, sizeof(entries), "%u", result->entries);
+    } else {
+      snprintf(entries, sizeof(entries), "%s", "-");
+    }
+
+    printf("%6ld.%03ld %10zu %8s  %s\n",
+           (result->microseconds / 1000), (result->microseconds % 1000),
+           result->size, entries, job->name);
+  }
+
+  printf("%u tables, %u failed, %zu bytes, compile time %ld.%03ldms, elapsed time %ldms\n",
+         jobs->count, failures, totalSize,
+         (compileTime / 1000), (compileTime % 1000), elapsed);
+
+  return !failures;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "brltty-tblchk",
+      .argumentsSummary = "{table-file | directory} ..."
+    };
+
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+  unsigned int jobLimit;
+
+  if (*opt_jobCount) {
+    static const int minimum = 1;
+    static const int maximum = 0X100;
+    int count;
+
+    if (!validateInteger(&count, opt_jobCount, &minimum, &maximum)) {
+      logMessage(LOG_ERR, "%s: %s", "invalid job count", opt_jobCount);
+      return PROG_EXIT_SYNTAX;
+    }
+
+    jobLimit = count;
+  } else {
+    jobLimit = getDefaultJobCount();
+  }
+
+  if (argc == 0) {
+    logMessage(LOG_ERR, "missing table file or directory");
+    return PROG_EXIT_SYNTAX;
+  }
+
+  TableJobs jobs = {
+    .array = NULL,
+    .size = 0,
+    .count = 0
+  };
+
+  do {
+    const char *path = *argv++;
+    argc -= 1;
+    const char *name = "";
+
+    if (!testDirectoryPath(path)) {
+      const char *extension = locatePathExtension(path);
+
+      if (!extension || !findTableEntry(extension)) {
+        logMessage(LOG_ERR, "unrecognized table: %s", path);
+        exitStatus = PROG_EXIT_SEMANTIC;
+        goto done;
+      }
+
+      name = locatePathName(path);
+    }
+
+    if (!addTableJobs(&jobs, path, name)) goto done;
+  } while (argc);
+
+  qsort(jobs.array, jobs.count, sizeof(*jobs.array), sortTableJobs);
+
+  {
+    TimeValue start;
+    getMonotonicTime(&start);
+
+    runTableJobs(&jobs, jobLimit);
+
+    exitStatus = reportTableJobs(&jobs, getMonotonicElapsed(&start))?
+                 PROG_EXIT_SUCCESS:
+                 PROG_EXIT_SEMANTIC;
+  }
+
+done:
+  deallocateTableJobs(&jobs);
+  return exitStatus;
+}
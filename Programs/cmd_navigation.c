@@ -53,24 +53,49 @@ canMoveDown (void) {
   return (ses->winy + brl.textRows) < scr.rows;
 }
 
+static int
+haveSameRowHash (int row1, int row2, IsSameCharacter isSame) {
+  const ScreenRowSummary *summary1 = getScreenRowSummary(row1);
+  if (!summary1) return 1;
+
+  const ScreenRowSummary *summary2 = getScreenRowSummary(row2);
+  if (!summary2) return 1;
+
+  if (isSame == isSameText) return summary1->textHash == summary2->textHash;
+  if (isSame == isSameAttributes) return summary1->attributesHash == summary2->attributesHash;
+  if (isSame == isSameCharacter) return summary1->characterHash == summary2->characterHash;
+  return 1;
+}
+
+static int
+isBlankRow (int row) {
+  const ScreenRowSummary *summary = getScreenRowSummary(row);
+  return summary && summary->isBlank;
+}
+
 static int
 toDifferentLine (
   IsSameCharacter isSameCharacter,
   CanMoveWindow canMoveWindow,
   int amount, int from, int width
 ) {
-  if (canMoveWindow()) {
-    ScreenCharacter characters1[width];
+  const ScreenCharacter *characters1;
+
+  if (canMoveWindow() && (characters1 = getScreenRowCharacters(ses->winy))) {
+    int reference = ses->winy;
+    int wholeRow = (from == 0) && (width == scr.cols);
     unsigned int skipped = 0;
 
     if ((isSameCharacter == isSameText) && ses->displayMode) isSameCharacter = isSameAttributes;
-    readScreen(from, ses->winy, width, 1, characters1);
+    characters1 += from;
 
     do {
-      ScreenCharacter characters2[width];
-      readScreen(from, ses->winy+=amount, width, 1, characters2);
+      const ScreenCharacter *characters2 = getScreenRowCharacters(ses->winy+=amount);
+      if (!characters2) return 1;
+      characters2 += from;
 
-      if (!isSameRow(characters1, characters2, width, isSameCharacter) ||
+      if ((wholeRow && !haveSameRowHash(reference, ses->winy, isSameCharacter)) ||
+          !isSameRow(characters1, characters2, width, isSameCharacter) ||
           (showScreenCursor() && (scr.posy == ses->winy) &&
            (scr.posx >= from) && (scr.posx < (from + width)))) {
         return 1;
@@ -163,9 +188,10 @@ findRow (int column, int increment, RowTester test, void *data) {
 
 static int
 testIndent (int column, int row, void *data UNUSED) {
-  int count = column+1;
-  ScreenCharacter characters[count];
-  readScreenRow(row, count, characters);
+  if (isBlankRow(row)) return 0;
+
+  const ScreenCharacter *characters = getScreenRowCharacters(row);
+  if (!characters) return 0;
 
   while (column >= 0) {
     wchar_t text = characters[column].text;
@@ -207,8 +233,8 @@ testPromptOriginal (int column, int row, void *data) {
   if (!column) return 0;
 
   int length = column + 1;
-  ScreenCharacter characters[length];
-  readScreenRow(row, length, characters);
+  const ScreenCharacter *characters = getScreenRowCharacters(row);
+  if (!characters) return 0;
 
   const ScreenCharacter *prompt = data;
   return isSameRow(characters, prompt, length, isSameText);
@@ -220,8 +246,8 @@ testPromptPatterns (int column, int row, void *data) {
   wchar_t text[length];
 
   {
-    ScreenCharacter characters[length];
-    readScreenRow(row, length, characters);
+    const ScreenCharacter *characters = getScreenRowCharacters(row);
+    if (!characters) return 0;
 
     const ScreenCharacter *from = characters;
     const ScreenCharacter *end = from + length;
@@ -238,7 +264,6 @@ toPreviousNonblankWindow (void) {
   int oldX = ses->winx;
   int oldY = ses->winy;
   int tuneLimit = 3;
-  ScreenCharacter characters[scr.cols];
 
   while (1) {
     int charCount;
@@ -258,9 +283,17 @@ toPreviousNonblankWindow (void) {
       placeBrailleWindowRight();
     }
 
+    if (isBlankRow(ses->winy) && !(showScreenCursor() && (scr.posy == ses->winy))) {
+      ses->winx = 0;
+      continue;
+    }
+
+    const ScreenCharacter *characters = getScreenRowCharacters(ses->winy);
+    if (!characters) break;
+    characters += ses->winx;
+
     charCount = getWindowLength();
     charCount = MIN(charCount, scr.cols-ses->winx);
-    readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
     for (charIndex=charCount-1; charIndex>=0; charIndex-=1) {
       wchar_t text = characters[charIndex].text;
@@ -284,7 +317,6 @@ toNextNonblankWindow (void) {
   int oldX = ses->winx;
   int oldY = ses->winy;
   int tuneLimit = 3;
-  ScreenCharacter characters[scr.cols];
 
   while (1) {
     int charCount;
@@ -304,9 +336,17 @@ toNextNonblankWindow (void) {
       ses->winx = 0;
     }
 
+    if (isBlankRow(ses->winy) && !(showScreenCursor() && (scr.posy == ses->winy))) {
+      placeBrailleWindowRight();
+      continue;
+    }
+
+    const ScreenCharacter *characters = getScreenRowCharacters(ses->winy);
+    if (!characters) break;
+    characters += ses->winx;
+
     charCount = getWindowLength();
     charCount = MIN(charCount, scr.cols-ses->winx);
-    readScreen(ses->winx, ses->winy, charCount, 1, characters);
 
     for (charIndex=0; charIndex<charCount; charIndex+=1) {
       wchar_t text = characters[charIndex].text;
@@ -121,6 +121,20 @@ toggleFunctionalSetting (
   return result;
 }
 
+static void
+shiftSessionRow (int *row, int amount) {
+  if (*row >= 0) {
+    if ((*row += amount) < 0) *row = 0;
+  }
+}
+
+static void
+shiftSessionRows (int amount) {
+  shiftSessionRow(&ses->winy, amount);
+  shiftSessionRow(&ses->trky, amount);
+  shiftSessionRow(&ses->spky, amount);
+}
+
 static int
 handleToggleCommands (int command, void *data) {
   switch (command & BRL_MSK_CMD) {
@@ -278,11 +292,16 @@ handleToggleCommands (int command, void *data) {
 
       switch (toggleSetting(&setting, command, ALERT_SCREEN_UNFROZEN, ALERT_SCREEN_FROZEN)) {
         case TOGGLE_OFF:
+          shiftSessionRows(-(int)getFrozenScreenHistorySize());
           deactivateSpecialScreen(SCR_FROZEN);
           break;
 
         case TOGGLE_ON:
-          if (!activateSpecialScreen(SCR_FROZEN)) alert(ALERT_COMMAND_REJECTED);
+          if (!activateSpecialScreen(SCR_FROZEN)) {
+            alert(ALERT_COMMAND_REJECTED);
+          } else {
+            shiftSessionRows((int)getFrozenScreenHistorySize());
+          }
           break;
 
         default:
@@ -905,6 +905,7 @@ static int
 setTextTable (const char *name) {
   if (!name) name = "";
   if (!replaceTextTable(opt_tablesDirectory, name)) return 0;
+  resetBrailleWindowCache();
 
   if (!*name) name = TEXT_TABLE;
   changeStringSetting(&opt_textTable, name);
@@ -942,10 +943,16 @@ exitTextTable (void *data) {
   setTextTable(NULL);
 }
 
+static void
+handleContractionResults (void *data) {
+  scheduleUpdate("contraction results");
+}
+
 static int
 setContractionTable (const char *name) {
   if (!name) name = "";
   if (!replaceContractionTable(opt_tablesDirectory, name)) return 0;
+  if (contractionTable) setContractionResultsHandler(contractionTable, handleContractionResults, NULL);
 
   if (!*name) name = CONTRACTION_TABLE;
   changeStringSetting(&opt_contractionTable, name);
@@ -1033,6 +1040,7 @@ int
 changeAttributesTable (const char *name) {
   if (!name) name = "";
   if (!replaceAttributesTable(opt_tablesDirectory, name)) return 0;
+  resetBrailleWindowCache();
 
   if (!*name) name = ATTRIBUTES_TABLE;
   changeStringSetting(&opt_attributesTable, name);
@@ -1703,6 +1711,15 @@ constructBrailleDriver (void) {
   initializeBrailleDisplay();
 
   if (braille->construct(&brl, brailleDriverParameters, brailleDevice)) {
+    {
+      const char *device = brailleDevice;
+
+      if (device && isBluetoothDeviceIdentifier(&device)) {
+        // only a driver which has accepted the device is remembered
+        bthRememberDeviceDriver(device, braille->definition.code);
+      }
+    }
+
     if (ensureBrailleBuffer(&brl, LOG_INFO)) {
       if (brl.keyBindings) {
         char *keyTablePath = makeBrailleKeyTablePath();
@@ -1832,6 +1849,7 @@ activateBrailleDriver (int verify) {
 
   while (*device) {
     const char *const *autodetectableDrivers = NULL;
+    const char **bluetoothDrivers = NULL;
 
     brailleDevice = *device;
     logMessage(LOG_DEBUG, "checking braille device: %s", brailleDevice);
@@ -1855,7 +1873,9 @@ activateBrailleDriver (int verify) {
           }
 
           case GIO_TYPE_BLUETOOTH: {
-            if (!(autodetectableDrivers = bthGetDriverCodes(dev, BLUETOOTH_DEVICE_NAME_OBTAIN_TIMEOUT))) {
+            if ((bluetoothDrivers = bthGetDriverCodes(dev, BLUETOOTH_DEVICE_NAME_OBTAIN_TIMEOUT))) {
+              autodetectableDrivers = bluetoothDrivers;
+            } else {
               autodetectableDrivers = autodetectableBrailleDrivers_Bluetooth;
             }
 
@@ -1884,7 +1904,10 @@ activateBrailleDriver (int verify) {
         .haveDriver = haveBrailleDriver,
         .initializeDriver = initializeBrailleDriver
       };
-      if (activateDriver(&data, verify)) return 1;
+      int activated = activateDriver(&data, verify);
+
+      if (bluetoothDrivers) free(bluetoothDrivers);
+      if (activated) return 1;
     }
 
     device += 1;
@@ -195,7 +195,7 @@ postprocessCommand (void *state, int command, const CommandEntry *cmd, int handl
 
   if (pre) {
     resumeUpdates(0);
-    if (handled) scheduleUpdate("command executed");
+    if (handled) schedulePriorityUpdate("command executed", 0, UPDATE_PRIORITY_FEEDBACK);
 
     if ((ses->winx != pre->motionColumn) || (ses->winy != pre->motionRow)) {
       /* The braille window has been manually moved. */
@@ -300,7 +300,7 @@ ASYNC_ALARM_CALLBACK(handleDelayedCursorTrackingAlarm) {
   ses->dctx = -1;
   ses->dcty = -1;
 
-  scheduleUpdate("delayed cursor tracking");
+  schedulePriorityUpdate("delayed cursor tracking", 0, UPDATE_PRIORITY_FEEDBACK);
 }
 
 void
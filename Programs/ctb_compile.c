@@ -34,7 +34,6 @@
 #include "ctb_internal.h"
 #include "brl_dots.h"
 #include "cldr.h"
-#include "hostcmd.h"
 
 static const wchar_t *const characterClassNames[] = {
   WS_C("space"),
@@ -252,8 +251,27 @@ addByteRule (
           if ((newRule->opcode == currentRule->opcode) &&
               (newRule->after == currentRule->after) &&
               (newRule->before == currentRule->before) &&
-              (wmemcmp(newRule->findrep, currentRule->findrep, newRule->findlen) == 0))
+              (wmemcmp(newRule->findrep, currentRule->findrep, newRule->findlen) == 0)) {
+            if ((newRule->replen == currentRule->replen) &&
+                (memcmp(&newRule->findrep[newRule->findlen],
+                        &currentRule->findrep[currentRule->findlen],
+                        newRule->replen) == 0)) {
+              /* An identical rule is already in effect (typically defined by
+               * another include of the same subtable) so reuse it.
+               */
+              ContractionTableOffset currentOffset = *offsetAddress;
+
+              if (newRule->findlen == 1) {
+                ContractionTableCharacter *ctc = getCharacterEntry(newRule->findrep[0], ctd);
+                if (ctc->always == ruleOffset) ctc->always = currentOffset;
+              }
+
+              releaseDataItems(ctd->area, ruleOffset);
+              return getDataItem(ctd->area, currentOffset);
+            }
+
             break;
+          }
 
           if ((currentRule->opcode == CTO_Always) && (newRule->opcode != CTO_Always))
             break;
@@ -707,51 +725,13 @@ initializeCommonFields (ContractionTable *table) {
   table->rules.size = 0;
   table->rules.count = 0;
 
-  table->cache.input.characters = NULL;
-  table->cache.input.size = 0;
-  table->cache.input.count = 0;
-
-  table->cache.output.cells = NULL;
-  table->cache.output.size = 0;
-  table->cache.output.count = 0;
-
-  table->cache.offsets.array = NULL;
-  table->cache.offsets.size = 0;
-  table->cache.offsets.count = 0;
+  table->context = NULL;
+  table->translationLock = NULL;
 }
 
 static void
 destroyCommonFields (ContractionTable *table) {
-  if (table->characters.array) {
-    free(table->characters.array);
-    table->characters.array = NULL;
-  }
-
-  if (table->rules.array) {
-    {
-      ContractionTableRule **rule = table->rules.array;
-      ContractionTableRule **end = rule + table->rules.count;
-      while (rule < end) free(*rule++);
-    }
-
-    free(table->rules.array);
-    table->rules.array = NULL;
-  }
-
-  if (table->cache.input.characters) {
-    free(table->cache.input.characters);
-    table->cache.input.characters = NULL;
-  }
-
-  if (table->cache.output.cells) {
-    free(table->cache.output.cells);
-    table->cache.output.cells = NULL;
-  }
-
-  if (table->cache.offsets.array) {
-    free(table->cache.offsets.array);
-    table->cache.offsets.array = NULL;
-  }
+  releaseContractionTable(table);
 }
 
 static void
@@ -818,7 +798,7 @@ compileContractionTable_native (const char *name) {
             };
 
             if (processDataFile(name, &parameters)) {
-              if (saveCharacterTable(&ctd)) {
+              if (saveCharacterTable(&ctd) && compactDataArea(ctd.area)) {
                 table = newContractionTable(getDataItem(ctd.area, 0), getDataSize(ctd.area));
                 resetDataArea(ctd.area);
               }
@@ -840,42 +820,9 @@ compileContractionTable_native (const char *name) {
   return table;
 }
 
-int
-startContractionCommand (ContractionTable *table) {
-  if (!table->data.external.commandStarted) {
-    const char *command[] = {table->data.external.command, NULL};
-    HostCommandOptions options;
-
-    initializeHostCommandOptions(&options);
-    options.asynchronous = 1;
-    options.standardInput = &table->data.external.standardInput;
-    options.standardOutput = &table->data.external.standardOutput;
-
-    logMessage(LOG_DEBUG, "starting external contraction table: %s", table->data.external.command);
-    if (runHostCommand(command, &options) != 0) return 0;
-    logMessage(LOG_DEBUG, "external contraction table started: %s", table->data.external.command);
-
-    table->data.external.commandStarted = 1;
-  }
-
-  return 1;
-}
-
-void
-stopContractionCommand (ContractionTable *table) {
-  if (table->data.external.commandStarted) {
-    fclose(table->data.external.standardInput);
-    fclose(table->data.external.standardOutput);
-
-    logMessage(LOG_DEBUG, "external contraction table stopped: %s", table->data.external.command);
-    table->data.external.commandStarted = 0;
-  }
-}
-
 static void
 destroyContractionTable_external (ContractionTable *table) {
   stopContractionCommand(table);
-  if (table->data.external.input.buffer) free(table->data.external.input.buffer);
   free(table->data.external.command);
 
   destroyCommonFields(table);
@@ -898,10 +845,15 @@ compileContractionTable_external (const char *name) {
       table->translationMethods = getContractionTableTranslationMethods_external();
       initializeCommonFields(table);
 
-      table->data.external.commandStarted = 0;
+      table->data.external.helpers = NULL;
+      table->data.external.requestIdentifier = 0;
 
-      table->data.external.input.buffer = NULL;
-      table->data.external.input.size = 0;
+      table->data.external.results.array = NULL;
+      table->data.external.results.count = 0;
+      table->data.external.results.usage = 0;
+
+      table->data.external.resultsHandler = NULL;
+      table->data.external.resultsData = NULL;
 
       if (startContractionCommand(table)) {
         return table;
@@ -1012,7 +964,16 @@ compileContractionTable (const char *name) {
     }
   }
 
-  return compile(name);
+  ContractionTable *table = compile(name);
+
+  if (table) {
+    if (!prepareContractionTable(table)) {
+      destroyContractionTable(table);
+      table = NULL;
+    }
+  }
+
+  return table;
 }
 
 void
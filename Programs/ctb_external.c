@@ -22,14 +22,248 @@
 #include <errno.h>
 
 #include "log.h"
+#include "parameters.h"
 #include "ctb_translate.h"
 #include "brl_dots.h"
 #include "file.h"
+#include "io_misc.h"
+#include "hostcmd.h"
+#include "async_handle.h"
+#include "async_io.h"
+#include "timing.h"
 #include "parse.h"
 #include "utf8.h"
 
+/* Requests are written as name=value lines, the text being last, and the
+ * responses are read as name=value lines, brf being last. The first request
+ * to a newly started helper also has protocol=binary and request-id=<number>
+ * lines. Helpers which don't know about them ignore them. A helper which
+ * supports the binary protocol answers with a protocol=binary line and then
+ * uses binary frames in both directions, beginning with its response to that
+ * first request.
+ *
+ * A binary frame is a length (of the rest of the frame), a request
+ * identifier, and a sequence of properties. Each property is a one-byte code,
+ * a length, and a value. Lengths, identifiers, and numeric values are 32-bit
+ * big-endian integers. Text is UTF-8, cells are dot bytes, and output offsets
+ * are a sequence of numbers.
+ */
+
+typedef enum {
+  EXT_REQ_CURSOR_POSITION = 1,
+  EXT_REQ_EXPAND_CURRENT_WORD,
+  EXT_REQ_CAPITALIZATION_MODE,
+  EXT_REQ_MAXIMUM_LENGTH,
+  EXT_REQ_TEXT
+} ExternalRequestCode;
+
+typedef enum {
+  EXT_RSP_CELLS = 1,
+  EXT_RSP_BRF,
+  EXT_RSP_CONSUMED_LENGTH,
+  EXT_RSP_OUTPUT_OFFSETS
+} ExternalResponseCode;
+
+#define EXT_FRAME_NUMBER_SIZE 4
+#define EXT_FRAME_HEADER_SIZE (EXT_FRAME_NUMBER_SIZE * 2)
+#define EXT_FRAME_PROPERTY_HEADER_SIZE (1 + EXT_FRAME_NUMBER_SIZE)
+#define EXT_FRAME_SIZE_LIMIT 0X100000
+
+typedef enum {
+  EXT_PROTOCOL_TEXT,
+  EXT_PROTOCOL_BINARY
+} ExternalProtocol;
+
+struct ExternalContractionResultStruct {
+  uint32_t identifier;
+  unsigned long int usage;
+
+  struct {
+    wchar_t *characters;
+    unsigned int length;
+    unsigned int maximum;
+    int cursor;
+    unsigned char expandCurrentWord;
+    unsigned char capitalizationMode;
+  } request;
+
+  struct {
+    unsigned char *array;
+    unsigned int count;
+  } cells;
+
+  unsigned int consumed;
+
+  struct {
+    int *array;
+    unsigned int count;
+  } offsets;
+};
+
+struct ExternalContractionHelperStruct {
+  ContractionTable *table;
+  unsigned int number;
+
+  FILE *standardInput;
+  FILE *standardOutput;
+  AsyncHandle inputMonitor;
+
+  ExternalProtocol protocol;
+  unsigned negotiated:1;
+
+  struct {
+    unsigned char *buffer;
+    size_t size;
+    size_t length;
+  } input;
+
+  ExternalContractionResult *pending;
+  TimePeriod pendingPeriod;
+};
+
+static const char *
+getExternalCommand (ContractionTable *table) {
+  return table->data.external.command;
+}
+
+static int
+getRequestCursor (BrailleContractionData *bcd) {
+  return bcd->input.cursor? (bcd->input.cursor - bcd->input.begin): CTB_NO_CURSOR;
+}
+
+static void
+destroyExternalResult (ExternalContractionResult *result) {
+  if (result->request.characters) free(result->request.characters);
+  if (result->cells.array) free(result->cells.array);
+  if (result->offsets.array) free(result->offsets.array);
+  free(result);
+}
+
+static ExternalContractionResult *
+newExternalResult (BrailleContractionData *bcd) {
+  ExternalContractionResult *result;
+
+  if ((result = malloc(sizeof(*result)))) {
+    memset(result, 0, sizeof(*result));
+
+    result->identifier = ++bcd->table->data.external.requestIdentifier;
+    result->request.length = getInputCount(bcd);
+    result->request.maximum = getOutputCount(bcd);
+    result->request.cursor = getRequestCursor(bcd);
+    result->request.expandCurrentWord = prefs.expandCurrentWord;
+    result->request.capitalizationMode = prefs.capitalizationMode;
+
+    if ((result->request.characters = malloc(ARRAY_SIZE(result->request.characters, result->request.length)))) {
+      wmemcpy(result->request.characters, bcd->input.begin, result->request.length);
+      return result;
+    }
+
+    free(result);
+  }
+
+  logMallocError();
+  return NULL;
+}
+
+static int
+testExternalResult (const ExternalContractionResult *result, BrailleContractionData *bcd) {
+  if (result->request.length != getInputCount(bcd)) return 0;
+  if (result->request.maximum != getOutputCount(bcd)) return 0;
+  if (result->request.cursor != getRequestCursor(bcd)) return 0;
+  if (result->request.expandCurrentWord != prefs.expandCurrentWord) return 0;
+  if (result->request.capitalizationMode != prefs.capitalizationMode) return 0;
+  return wmemcmp(result->request.characters, bcd->input.begin, result->request.length) == 0;
+}
+
+static ExternalContractionResult *
+findExternalResult (BrailleContractionData *bcd) {
+  ContractionTable *table = bcd->table;
+  ExternalContractionResult **result = table->data.external.results.array;
+  ExternalContractionResult **end = result + table->data.external.results.count;
+
+  while (result < end) {
+    if (testExternalResult(*result, bcd)) {
+      (*result)->usage = ++table->data.external.results.usage;
+      return *result;
+    }
+
+    result += 1;
+  }
+
+  return NULL;
+}
+
 static int
-putExternalRequests (BrailleContractionData *bcd) {
+addExternalResult (ContractionTable *table, ExternalContractionResult *result) {
+  ExternalContractionResult **array = table->data.external.results.array;
+
+  if (!array) {
+    if (!(array = malloc(ARRAY_SIZE(array, EXTERNAL_CONTRACTION_RESULT_LIMIT)))) {
+      logMallocError();
+      return 0;
+    }
+
+    table->data.external.results.array = array;
+  }
+
+  result->usage = ++table->data.external.results.usage;
+
+  if (table->data.external.results.count < EXTERNAL_CONTRACTION_RESULT_LIMIT) {
+    array[table->data.external.results.count++] = result;
+  } else {
+    ExternalContractionResult **oldest = array;
+
+    for (unsigned int index=1; index<EXTERNAL_CONTRACTION_RESULT_LIMIT; index+=1) {
+      if (array[index]->usage < (*oldest)->usage) oldest = &array[index];
+    }
+
+    destroyExternalResult(*oldest);
+    *oldest = result;
+  }
+
+  return 1;
+}
+
+static void
+removeExternalResults (ContractionTable *table) {
+  ExternalContractionResult **array = table->data.external.results.array;
+
+  if (array) {
+    while (table->data.external.results.count) {
+      destroyExternalResult(array[--table->data.external.results.count]);
+    }
+
+    free(array);
+    table->data.external.results.array = NULL;
+  }
+}
+
+static uint32_t
+getExternalNumber (const unsigned char *bytes) {
+  uint32_t number = 0;
+
+  for (unsigned int index=0; index<EXT_FRAME_NUMBER_SIZE; index+=1) {
+    number <<= 8;
+    number |= bytes[index];
+  }
+
+  return number;
+}
+
+static unsigned char *
+putExternalNumber (unsigned char *bytes, uint32_t number) {
+  unsigned int index = EXT_FRAME_NUMBER_SIZE;
+
+  while (index) {
+    bytes[--index] = number & 0XFF;
+    number >>= 8;
+  }
+
+  return bytes + EXT_FRAME_NUMBER_SIZE;
+}
+
+static int
+putExternalRequests (ExternalContractionHelper *helper, ExternalContractionResult *result) {
   typedef enum {
     REQ_TEXT,
     REQ_NUMBER
@@ -37,6 +271,7 @@ putExternalRequests (BrailleContractionData *bcd) {
 
   typedef struct {
     const char *name;
+    ExternalRequestCode code;
     ExternalRequestType type;
 
     union {
@@ -51,78 +286,143 @@ putExternalRequests (BrailleContractionData *bcd) {
 
   const ExternalRequestEntry externalRequestTable[] = {
     { .name = "cursor-position",
+      .code = EXT_REQ_CURSOR_POSITION,
       .type = REQ_NUMBER,
-      .value.number = bcd->input.cursor? bcd->input.cursor-bcd->input.begin+1: 0
+      .value.number = (result->request.cursor == CTB_NO_CURSOR)? 0: result->request.cursor+1
     },
 
     { .name = "expand-current-word",
+      .code = EXT_REQ_EXPAND_CURRENT_WORD,
       .type = REQ_NUMBER,
-      .value.number = prefs.expandCurrentWord
+      .value.number = result->request.expandCurrentWord
     },
 
     { .name = "capitalization-mode",
+      .code = EXT_REQ_CAPITALIZATION_MODE,
       .type = REQ_NUMBER,
-      .value.number = prefs.capitalizationMode
+      .value.number = result->request.capitalizationMode
     },
 
     { .name = "maximum-length",
+      .code = EXT_REQ_MAXIMUM_LENGTH,
       .type = REQ_NUMBER,
-      .value.number = getOutputCount(bcd)
+      .value.number = result->request.maximum
     },
 
     { .name = "text",
+      .code = EXT_REQ_TEXT,
       .type = REQ_TEXT,
       .value.text = {
-        .start = bcd->input.begin,
-        .count = getInputCount(bcd)
+        .start = result->request.characters,
+        .count = result->request.length
       }
     },
 
     { .name = NULL }
   };
 
-  FILE *stream = bcd->table->data.external.standardInput;
-  const ExternalRequestEntry *req = externalRequestTable;
+  FILE *stream = helper->standardInput;
+  const ExternalRequestEntry *req;
+
+  // the text can be as long as the screen, so it's not put on the stack
+  char *utf8Text = malloc((result->request.length * UTF8_LEN_MAX) + 1);
+  size_t utf8Length = 0;
 
-  while (req->name) {
-    if (fputs(req->name, stream) == EOF) goto outputError;
-    if (fputc('=', stream) == EOF) goto outputError;
+  unsigned char *frame = NULL;
+  int ok = 0;
 
-    switch (req->type) {
-      case REQ_TEXT: {
-        const wchar_t *character = req->value.text.start;
-        const wchar_t *end = character + req->value.text.count;
+  if (!utf8Text) {
+    logMallocError();
+    return 0;
+  }
 
-        while (character < end) {
-          Utf8Buffer utf8;
-          size_t utfs = convertWcharToUtf8(*character++, utf8);
+  {
+    const wchar_t *character = result->request.characters;
+    const wchar_t *end = character + result->request.length;
 
-          if (!utfs) return 0;
-          if (fputs(utf8, stream) == EOF) goto outputError;
-        }
+    while (character < end) {
+      size_t utfs = convertWcharToUtf8(*character++, &utf8Text[utf8Length]);
+      if (!utfs) goto done;
+      utf8Length += utfs;
+    }
 
-        break;
-      }
+    utf8Text[utf8Length] = 0;
+  }
 
-      case REQ_NUMBER:
-        if (fprintf(stream, "%u", req->value.number) == EOF) goto outputError;
-        break;
+  if (helper->protocol == EXT_PROTOCOL_BINARY) {
+    size_t size = EXT_FRAME_HEADER_SIZE;
 
-      default:
-        logMessage(LOG_WARNING, "unimplemented external contraction request property type: %s: %u (%s)", bcd->table->data.external.command, req->type, req->name);
-        return 0;
+    for (req=externalRequestTable; req->name; req+=1) {
+      size += EXT_FRAME_PROPERTY_HEADER_SIZE;
+      size += (req->type == REQ_TEXT)? utf8Length: EXT_FRAME_NUMBER_SIZE;
+    }
+
+    if (!(frame = malloc(size))) {
+      logMallocError();
+      goto done;
+    }
+
+    unsigned char *byte = frame;
+
+    byte = putExternalNumber(byte, size - EXT_FRAME_NUMBER_SIZE);
+    byte = putExternalNumber(byte, result->identifier);
+
+    for (req=externalRequestTable; req->name; req+=1) {
+      *byte++ = req->code;
+
+      switch (req->type) {
+        case REQ_TEXT:
+          byte = putExternalNumber(byte, utf8Length);
+          byte = mempcpy(byte, utf8Text, utf8Length);
+          break;
+
+        case REQ_NUMBER:
+          byte = putExternalNumber(byte, EXT_FRAME_NUMBER_SIZE);
+          byte = putExternalNumber(byte, req->value.number);
+          break;
+      }
+    }
+
+    if (fwrite(frame, 1, size, stream) != size) goto outputError;
+  } else {
+    if (!helper->negotiated) {
+      if (fprintf(stream, "protocol=binary\nrequest-id=%"PRIu32"\n", result->identifier) < 0) goto outputError;
+      helper->negotiated = 1;
     }
 
-    if (fputc('\n', stream) == EOF) goto outputError;
-    req += 1;
+    for (req=externalRequestTable; req->name; req+=1) {
+      if (fputs(req->name, stream) == EOF) goto outputError;
+      if (fputc('=', stream) == EOF) goto outputError;
+
+      switch (req->type) {
+        case REQ_TEXT:
+          if (fputs(utf8Text, stream) == EOF) goto outputError;
+          break;
+
+        case REQ_NUMBER:
+          if (fprintf(stream, "%u", req->value.number) == EOF) goto outputError;
+          break;
+
+        default:
+          logMessage(LOG_WARNING, "unimplemented external contraction request property type: %s: %u (%s)", getExternalCommand(helper->table), req->type, req->name);
+          goto done;
+      }
+
+      if (fputc('\n', stream) == EOF) goto outputError;
+    }
   }
 
   if (fflush(stream) == EOF) goto outputError;
-  return 1;
+  ok = 1;
+  goto done;
 
 outputError:
-  logMessage(LOG_WARNING, "external contraction output error: %s: %s", bcd->table->data.external.command, strerror(errno));
-  return 0;
+  logMessage(LOG_WARNING, "external contraction output error: %s: %s", getExternalCommand(helper->table), strerror(errno));
+
+done:
+  if (frame) free(frame);
+  free(utf8Text);
+  return ok;
 }
 
 static const unsigned char brfTable[0X40] = {
@@ -192,78 +492,131 @@ static const unsigned char brfTable[0X40] = {
   /* 0X5F _ */ BRL_DOT_4 | BRL_DOT_5 | BRL_DOT_6
 };
 
+
 static int
-handleExternalResponse_brf (BrailleContractionData *bcd, const char *value) {
-  int useDot7 = prefs.capitalizationMode == CTB_CAP_DOT7;
+setExternalBrf (ExternalContractionResult *result, const unsigned char *brf, size_t count) {
+  int useDot7 = result->request.capitalizationMode == CTB_CAP_DOT7;
+  if (count > result->request.maximum) count = result->request.maximum;
 
-  while (*value && (bcd->output.current < bcd->output.end)) {
-    unsigned char brf = *value++ & 0XFF;
+  unsigned char *cells = malloc(count + 1);
+  if (!cells) {
+    logMallocError();
+    return 0;
+  }
+
+  for (unsigned int index=0; index<count; index+=1) {
+    unsigned char byte = brf[index];
     unsigned char dots = 0;
     unsigned char superimpose = 0;
 
-    if ((brf >= 0X60) && (brf <= 0X7F)) {
-      brf -= 0X20;
-    } else if ((brf >= 0X41) && (brf <= 0X5A)) {
+    if ((byte >= 0X60) && (byte <= 0X7F)) {
+      byte -= 0X20;
+    } else if ((byte >= 0X41) && (byte <= 0X5A)) {
       if (useDot7) superimpose |= BRL_DOT_7;
     }
 
-    if ((brf >= 0X20) && (brf <= 0X5F)) dots = brfTable[brf - 0X20] | superimpose;
-    *bcd->output.current++ = dots;
+    if ((byte >= 0X20) && (byte <= 0X5F)) dots = brfTable[byte - 0X20] | superimpose;
+    cells[index] = dots;
   }
 
+  if (result->cells.array) free(result->cells.array);
+  result->cells.array = cells;
+  result->cells.count = count;
   return 1;
 }
 
 static int
-handleExternalResponse_consumedLength (BrailleContractionData *bcd, const char *value) {
-  int length;
+setExternalCells (ExternalContractionResult *result, const unsigned char *dots, size_t count) {
+  if (count > result->request.maximum) count = result->request.maximum;
 
-  if (!isInteger(&length, value)) return 0;
+  unsigned char *cells = malloc(count + 1);
+  if (!cells) {
+    logMallocError();
+    return 0;
+  }
+
+  memcpy(cells, dots, count);
+
+  if (result->cells.array) free(result->cells.array);
+  result->cells.array = cells;
+  result->cells.count = count;
+  return 1;
+}
+
+static int
+setExternalConsumedLength (ExternalContractionResult *result, int length) {
   if (length < 1) return 0;
-  if (length > getInputCount(bcd)) return 0;
+  if (length > result->request.length) return 0;
 
-  bcd->input.current = bcd->input.begin + length;
+  result->consumed = length;
   return 1;
 }
 
 static int
-handleExternalResponse_outputOffsets (BrailleContractionData *bcd, const char *value) {
-  if (bcd->input.offsets) {
-    int previous = CTB_NO_OFFSET;
-    unsigned int count = getInputCount(bcd);
-    unsigned int index = 0;
+addExternalOutputOffset (ExternalContractionResult *result, int offset) {
+  if (!result->offsets.array) {
+    if (!(result->offsets.array = malloc(ARRAY_SIZE(result->offsets.array, result->request.length)))) {
+      logMallocError();
+      return 0;
+    }
+  }
 
-    while (*value && (index < count)) {
-      int offset;
+  if (result->offsets.count == result->request.length) return 1;
+  if (offset >= result->request.maximum) return 0;
 
-      {
-        char *delimiter = strchr(value, ',');
+  if (result->offsets.count > 0) {
+    if (offset < result->offsets.array[result->offsets.count - 1]) return 0;
+  } else if (offset < 0) {
+    return 0;
+  }
 
-        if (delimiter) {
-          int ok;
+  result->offsets.array[result->offsets.count++] = offset;
+  return 1;
+}
 
-          {
-            char oldDelimiter = *delimiter;
-            *delimiter = 0;
-            ok = isInteger(&offset, value);
-            *delimiter = oldDelimiter;
-          }
+static int
+handleExternalResponse_brf (ExternalContractionResult *result, const char *value) {
+  return setExternalBrf(result, (const unsigned char *)value, strlen(value));
+}
 
-          if (!ok) return 0;
-          value = delimiter + 1;
-        } else if (isInteger(&offset, value)) {
-          value += strlen(value);
-        } else {
-          return 0;
-        }
-      }
+static int
+handleExternalResponse_consumedLength (ExternalContractionResult *result, const char *value) {
+  int length;
+
+  if (!isInteger(&length, value)) return 0;
+  return setExternalConsumedLength(result, length);
+}
 
-      if (offset < ((index == 0)? 0: previous)) return 0;
-      if (offset >= getOutputCount(bcd)) return 0;
+static int
+handleExternalResponse_outputOffsets (ExternalContractionResult *result, const char *value) {
+  result->offsets.count = 0;
 
-      bcd->input.offsets[index++] = (offset == previous)? CTB_NO_OFFSET: offset;
-      previous = offset;
+  while (*value) {
+    int offset;
+
+    {
+      char *delimiter = strchr(value, ',');
+
+      if (delimiter) {
+        int ok;
+
+        {
+          char oldDelimiter = *delimiter;
+          *delimiter = 0;
+          ok = isInteger(&offset, value);
+          *delimiter = oldDelimiter;
+        }
+
+        if (!ok) return 0;
+        value = delimiter + 1;
+      } else if (isInteger(&offset, value)) {
+        value += strlen(value);
+      } else {
+        return 0;
+      }
     }
+
+    if (!addExternalOutputOffset(result, offset)) return 0;
   }
 
   return 1;
@@ -271,7 +624,7 @@ handleExternalResponse_outputOffsets (BrailleContractionData *bcd, const char *v
 
 typedef struct {
   const char *name;
-  int (*handler) (BrailleContractionData *bcd, const char *value);
+  int (*handler) (ExternalContractionResult *result, const char *value);
   unsigned stop:1;
 } ExternalResponseEntry;
 
@@ -293,39 +646,492 @@ static const ExternalResponseEntry externalResponseTable[] = {
 };
 
 static int
-getExternalResponses (BrailleContractionData *bcd) {
-  FILE *stream = bcd->table->data.external.standardOutput;
+completeExternalRequest (ExternalContractionHelper *helper) {
+  ExternalContractionResult *result = helper->pending;
+  helper->pending = NULL;
+
+  if (addExternalResult(helper->table, result)) return 1;
+  destroyExternalResult(result);
+  return 0;
+}
+
+static int
+handleTextResponse (ExternalContractionHelper *helper, char *line) {
+  if (strcmp(line, "protocol=binary") == 0) {
+    logMessage(LOG_DEBUG, "external contraction helper uses binary protocol: %s[%u]",
+               getExternalCommand(helper->table), helper->number);
+
+    helper->protocol = EXT_PROTOCOL_BINARY;
+    return 0;
+  }
+
+  ExternalContractionResult *result = helper->pending;
+  int ok = 0;
+  int stop = 0;
+  char *delimiter = strchr(line, '=');
+
+  if (result && delimiter) {
+    const char *value = delimiter + 1;
+    const ExternalResponseEntry *rsp = externalResponseTable;
+
+    char oldDelimiter = *delimiter;
+    *delimiter = 0;
+
+    while (rsp->name) {
+      if (strcmp(line, rsp->name) == 0) {
+        if (rsp->handler(result, value)) ok = 1;
+        if (rsp->stop) stop = 1;
+        break;
+      }
+
+      rsp += 1;
+    }
+
+    *delimiter = oldDelimiter;
+  }
+
+  if (!ok) logMessage(LOG_WARNING, "unexpected external contraction response: %s: %s", getExternalCommand(helper->table), line);
+  return stop && completeExternalRequest(helper);
+}
+
+static int
+handleBinaryResponse (ExternalContractionHelper *helper, const unsigned char *frame, size_t size) {
+  ExternalContractionResult *result = helper->pending;
+  uint32_t identifier = getExternalNumber(frame);
+
+  if (!result || (identifier != result->identifier)) {
+    logMessage(LOG_DEBUG, "stale external contraction response: %s: %"PRIu32,
+               getExternalCommand(helper->table), identifier);
+    return 0;
+  }
+
+  const unsigned char *byte = frame + EXT_FRAME_NUMBER_SIZE;
+  const unsigned char *end = frame + size;
+
+  while (byte < end) {
+    if ((end - byte) < EXT_FRAME_PROPERTY_HEADER_SIZE) goto malformed;
+
+    ExternalResponseCode code = *byte++;
+    uint32_t length = getExternalNumber(byte);
+    byte += EXT_FRAME_NUMBER_SIZE;
+
+    if ((end - byte) < length) goto malformed;
+    const unsigned char *value = byte;
+    byte += length;
 
-  while (readLine(stream, &bcd->table->data.external.input.buffer, &bcd->table->data.external.input.size, NULL)) {
     int ok = 0;
-    int stop = 0;
-    char *delimiter = strchr(bcd->table->data.external.input.buffer, '=');
 
-    if (delimiter) {
-      const char *value = delimiter + 1;
-      const ExternalResponseEntry *rsp = externalResponseTable;
+    switch (code) {
+      case EXT_RSP_CELLS:
+        ok = setExternalCells(result, value, length);
+        break;
 
-      char oldDelimiter = *delimiter;
-      *delimiter = 0;
+      case EXT_RSP_BRF:
+        ok = setExternalBrf(result, value, length);
+        break;
 
-      while (rsp->name) {
-        if (strcmp(bcd->table->data.external.input.buffer, rsp->name) == 0) {
-          if (rsp->handler(bcd, value)) ok = 1;
-          if (rsp->stop) stop = 1;
-          break;
+      case EXT_RSP_CONSUMED_LENGTH:
+        ok = (length == EXT_FRAME_NUMBER_SIZE) &&
+             setExternalConsumedLength(result, getExternalNumber(value));
+        break;
+
+      case EXT_RSP_OUTPUT_OFFSETS:
+        if (!(length % EXT_FRAME_NUMBER_SIZE)) {
+          result->offsets.count = 0;
+          ok = 1;
+
+          while (length) {
+            if (!addExternalOutputOffset(result, getExternalNumber(value))) {
+              ok = 0;
+              break;
+            }
+
+            value += EXT_FRAME_NUMBER_SIZE;
+            length -= EXT_FRAME_NUMBER_SIZE;
+          }
         }
+        break;
+    }
+
+    if (!ok) {
+      logMessage(LOG_WARNING, "unexpected external contraction response property: %s: %u",
+                 getExternalCommand(helper->table), code);
+    }
+  }
+
+  return completeExternalRequest(helper);
+
+malformed:
+  logMessage(LOG_WARNING, "malformed external contraction response: %s", getExternalCommand(helper->table));
+  return 0;
+}
+
+static int
+processHelperInput (ExternalContractionHelper *helper, int *completed) {
+  unsigned char *byte = helper->input.buffer;
+  size_t left = helper->input.length;
+  int ok = 1;
+
+  while (left) {
+    size_t used;
+
+    if (helper->protocol == EXT_PROTOCOL_BINARY) {
+      if (left < EXT_FRAME_HEADER_SIZE) break;
+      uint32_t size = getExternalNumber(byte);
+
+      if ((size < EXT_FRAME_NUMBER_SIZE) || (size > EXT_FRAME_SIZE_LIMIT)) {
+        logMessage(LOG_WARNING, "invalid external contraction frame size: %s: %"PRIu32,
+                   getExternalCommand(helper->table), size);
+
+        ok = 0;
+        break;
+      }
+
+      if ((left - EXT_FRAME_NUMBER_SIZE) < size) break;
+      used = EXT_FRAME_NUMBER_SIZE + size;
+      if (handleBinaryResponse(helper, byte+EXT_FRAME_NUMBER_SIZE, size)) *completed = 1;
+    } else {
+      unsigned char *end = memchr(byte, '\n', left);
+      if (!end) break;
+
+      *end = 0;
+      used = end - byte + 1;
+      if (handleTextResponse(helper, (char *)byte)) *completed = 1;
+    }
+
+    byte += used;
+    left -= used;
+  }
+
+  memmove(helper->input.buffer, byte, left);
+  helper->input.length = left;
+  return ok;
+}
+
+static FileDescriptor
+getHelperInputDescriptor (ExternalContractionHelper *helper) {
+#if defined(__MINGW32__)
+  return (HANDLE)_get_osfhandle(fileno(helper->standardOutput));
+#else /* __MINGW32__ */
+  return fileno(helper->standardOutput);
+#endif /* __MINGW32__ */
+}
+
+static int
+readHelperInput (ExternalContractionHelper *helper, int *completed) {
+  while (1) {
+    if (helper->input.length == helper->input.size) {
+      size_t newSize = helper->input.size? helper->input.size<<1: 0X100;
+      unsigned char *newBuffer = realloc(helper->input.buffer, newSize);
+
+      if (!newBuffer) {
+        logMallocError();
+        return 0;
+      }
+
+      helper->input.buffer = newBuffer;
+      helper->input.size = newSize;
+    }
+
+    ssize_t count = readFileDescriptor(
+      getHelperInputDescriptor(helper),
+      &helper->input.buffer[helper->input.length],
+      helper->input.size - helper->input.length
+    );
+
+    if (count == -1) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN) break;
+
+#ifdef EWOULDBLOCK
+      if (errno == EWOULDBLOCK) break;
+#endif /* EWOULDBLOCK */
+
+      logMessage(LOG_WARNING, "external contraction input error: %s: %s", getExternalCommand(helper->table), strerror(errno));
+      return 0;
+    }
+
+    if (!count) {
+      logMessage(LOG_WARNING, "incomplete external contraction response: %s", getExternalCommand(helper->table));
+      return 0;
+    }
+
+    helper->input.length += count;
+    if (!processHelperInput(helper, completed)) return 0;
+  }
+
+  return 1;
+}
+
+static void stopExternalHelper (ExternalContractionHelper *helper);
+
+static ASYNC_MONITOR_CALLBACK(handleExternalHelperInput) {
+  ExternalContractionHelper *helper = parameters->data;
+  ContractionTable *table = helper->table;
+  LockDescriptor *lock = table->translationLock;
+  int completed = 0;
+  int ok;
+
+  if (lock) obtainExclusiveLock(lock);
+    if (!(ok = !parameters->error && readHelperInput(helper, &completed))) {
+      asyncDiscardHandle(helper->inputMonitor);
+      helper->inputMonitor = NULL;
+      stopExternalHelper(helper);
+    }
+  if (lock) releaseLock(lock);
+
+  if (completed) {
+    ContractionResultsHandler *handler = table->data.external.resultsHandler;
+    if (handler) handler(table->data.external.resultsData);
+  }
+
+  return ok;
+}
 
-        rsp += 1;
+static int
+monitorExternalHelper (ExternalContractionHelper *helper) {
+  if (!helper->inputMonitor) {
+    if (helper->table->data.external.resultsHandler) {
+      if (!asyncMonitorFileInput(&helper->inputMonitor, getHelperInputDescriptor(helper),
+                                 handleExternalHelperInput, helper)) {
+        return 0;
       }
+    }
+  }
+
+  return 1;
+}
+
+static void
+stopExternalHelper (ExternalContractionHelper *helper) {
+  if (helper->inputMonitor) {
+    asyncCancelRequest(helper->inputMonitor);
+    helper->inputMonitor = NULL;
+  }
+
+  if (helper->standardInput) {
+    fclose(helper->standardInput);
+    helper->standardInput = NULL;
 
-      *delimiter = oldDelimiter;
+    fclose(helper->standardOutput);
+    helper->standardOutput = NULL;
+
+    logMessage(LOG_DEBUG, "external contraction table stopped: %s[%u]",
+               getExternalCommand(helper->table), helper->number);
+  }
+
+  if (helper->pending) {
+    destroyExternalResult(helper->pending);
+    helper->pending = NULL;
+  }
+
+  helper->input.length = 0;
+  helper->protocol = EXT_PROTOCOL_TEXT;
+  helper->negotiated = 0;
+}
+
+static int
+startExternalHelper (ExternalContractionHelper *helper) {
+  if (!helper->standardInput) {
+    const char *command[] = {getExternalCommand(helper->table), NULL};
+    HostCommandOptions options;
+
+    initializeHostCommandOptions(&options);
+    options.asynchronous = 1;
+    options.standardInput = &helper->standardInput;
+    options.standardOutput = &helper->standardOutput;
+
+    logMessage(LOG_DEBUG, "starting external contraction table: %s[%u]", command[0], helper->number);
+    if (runHostCommand(command, &options) != 0) return 0;
+    logMessage(LOG_DEBUG, "external contraction table started: %s[%u]", command[0], helper->number);
+
+    if (!setBlockingIo(getHelperInputDescriptor(helper), 0)) {
+      stopExternalHelper(helper);
+      return 0;
     }
+  }
 
-    if (!ok) logMessage(LOG_WARNING, "unexpected external contraction response: %s: %s", bcd->table->data.external.command, bcd->table->data.external.input.buffer);
-    if (stop) return 1;
+  if (!monitorExternalHelper(helper)) {
+    stopExternalHelper(helper);
+    return 0;
   }
 
-  logMessage(LOG_WARNING, "incomplete external contraction response: %s", bcd->table->data.external.command);
+  return 1;
+}
+
+static ExternalContractionHelper *
+getExternalHelpers (ContractionTable *table) {
+  ExternalContractionHelper *helpers = table->data.external.helpers;
+
+  if (!helpers) {
+    if (!(helpers = calloc(EXTERNAL_CONTRACTION_HELPER_LIMIT, sizeof(*helpers)))) {
+      logMallocError();
+      return NULL;
+    }
+
+    for (unsigned int number=0; number<EXTERNAL_CONTRACTION_HELPER_LIMIT; number+=1) {
+      ExternalContractionHelper *helper = &helpers[number];
+
+      helper->table = table;
+      helper->number = number;
+      helper->protocol = EXT_PROTOCOL_TEXT;
+    }
+
+    table->data.external.helpers = helpers;
+  }
+
+  return helpers;
+}
+
+int
+startContractionCommand (ContractionTable *table) {
+  ExternalContractionHelper *helpers = getExternalHelpers(table);
+  return helpers && startExternalHelper(&helpers[0]);
+}
+
+void
+stopContractionCommand (ContractionTable *table) {
+  ExternalContractionHelper *helpers = table->data.external.helpers;
+
+  if (helpers) {
+    for (unsigned int number=0; number<EXTERNAL_CONTRACTION_HELPER_LIMIT; number+=1) {
+      ExternalContractionHelper *helper = &helpers[number];
+
+      stopExternalHelper(helper);
+      if (helper->input.buffer) free(helper->input.buffer);
+    }
+
+    free(helpers);
+    table->data.external.helpers = NULL;
+  }
+
+  removeExternalResults(table);
+}
+
+static ExternalContractionHelper *
+findPendingHelper (BrailleContractionData *bcd) {
+  ExternalContractionHelper *helpers = bcd->table->data.external.helpers;
+
+  if (helpers) {
+    for (unsigned int number=0; number<EXTERNAL_CONTRACTION_HELPER_LIMIT; number+=1) {
+      ExternalContractionHelper *helper = &helpers[number];
+      if (helper->pending && testExternalResult(helper->pending, bcd)) return helper;
+    }
+  }
+
+  return NULL;
+}
+
+static ExternalContractionHelper *
+getIdleHelper (ContractionTable *table) {
+  ExternalContractionHelper *helpers = getExternalHelpers(table);
+  if (!helpers) return NULL;
+
+  ExternalContractionHelper *stopped = NULL;
+
+  for (unsigned int number=0; number<EXTERNAL_CONTRACTION_HELPER_LIMIT; number+=1) {
+    ExternalContractionHelper *helper = &helpers[number];
+
+    if (helper->pending) {
+      if (!afterTimePeriod(&helper->pendingPeriod, NULL)) continue;
+
+      logMessage(LOG_WARNING, "external contraction response timeout: %s[%u]",
+                 getExternalCommand(table), helper->number);
+
+      stopExternalHelper(helper);
+    }
+
+    if (helper->standardInput) return helper;
+    if (!stopped) stopped = helper;
+  }
+
+  if (stopped && startExternalHelper(stopped)) return stopped;
+  return NULL;
+}
+
+static ExternalContractionHelper *
+requestExternalContraction (BrailleContractionData *bcd) {
+  ExternalContractionHelper *helper = findPendingHelper(bcd);
+
+  if (!helper) {
+    if ((helper = getIdleHelper(bcd->table))) {
+      ExternalContractionResult *result = newExternalResult(bcd);
+      if (!result) return NULL;
+
+      if (!putExternalRequests(helper, result)) {
+        destroyExternalResult(result);
+        stopExternalHelper(helper);
+        return NULL;
+      }
+
+      helper->pending = result;
+      startTimePeriod(&helper->pendingPeriod, EXTERNAL_CONTRACTION_RESPONSE_TIMEOUT);
+    }
+  }
+
+  return helper;
+}
+
+static void
+awaitExternalContraction (ExternalContractionHelper *helper, int timeout) {
+  ExternalContractionResult *result = helper->pending;
+  TimePeriod period;
+  startTimePeriod(&period, timeout);
+
+  while (helper->pending == result) {
+    long int elapsed;
+    int completed = 0;
+
+    if (afterTimePeriod(&period, &elapsed)) {
+      if (timeout == EXTERNAL_CONTRACTION_RESPONSE_TIMEOUT) {
+        logMessage(LOG_WARNING, "external contraction response timeout: %s[%u]",
+                   getExternalCommand(helper->table), helper->number);
+
+        stopExternalHelper(helper);
+      }
+
+      break;
+    }
+
+    if (awaitFileInput(getHelperInputDescriptor(helper), (timeout - elapsed))) {
+      if (!readHelperInput(helper, &completed)) {
+        stopExternalHelper(helper);
+        break;
+      }
+    } else if (errno != EAGAIN) {
+      stopExternalHelper(helper);
+      break;
+    }
+  }
+}
+
+static void
+applyExternalResult (BrailleContractionData *bcd, const ExternalContractionResult *result) {
+  {
+    unsigned int count = MIN(result->cells.count, getOutputCount(bcd));
+
+    memcpy(bcd->output.begin, result->cells.array, count);
+    bcd->output.current = bcd->output.begin + count;
+  }
+
+  if (result->consumed) bcd->input.current = bcd->input.begin + result->consumed;
+
+  if (bcd->input.offsets && result->offsets.count) {
+    int previous = CTB_NO_OFFSET;
+
+    for (unsigned int index=0; index<result->offsets.count; index+=1) {
+      int offset = result->offsets.array[index];
+
+      bcd->input.offsets[index] = (offset == previous)? CTB_NO_OFFSET: offset;
+      previous = offset;
+    }
+  }
+}
+
+static int
+contractText_fallback (BrailleContractionData *bcd) {
+  // the uncontracted text is shown until the helper's result arrives
+  bcd->provisional = 1;
   return 0;
 }
 
@@ -334,16 +1140,64 @@ contractText_external (BrailleContractionData *bcd) {
   setOffset(bcd);
   while (++bcd->input.current < bcd->input.end) clearOffset(bcd);
 
-  if (startContractionCommand(bcd->table)) {
-    if (putExternalRequests(bcd)) {
-      if (getExternalResponses(bcd)) {
-        return 1;
+  const ExternalContractionResult *result = findExternalResult(bcd);
+
+  if (!result) {
+    ExternalContractionHelper *helper = requestExternalContraction(bcd);
+
+    if (helper) {
+      int asynchronous = !!bcd->table->data.external.resultsHandler;
+
+      awaitExternalContraction(helper,
+        asynchronous? EXTERNAL_CONTRACTION_RESPONSE_WAIT:
+                      EXTERNAL_CONTRACTION_RESPONSE_TIMEOUT
+      );
+
+      result = findExternalResult(bcd);
+    }
+  }
+
+  if (result) {
+    applyExternalResult(bcd, result);
+    return 1;
+  }
+
+  return contractText_fallback(bcd);
+}
+
+static void
+anticipateText_external (BrailleContractionData *bcd) {
+  if (bcd->table->data.external.resultsHandler) {
+    if (!findExternalResult(bcd)) {
+      requestExternalContraction(bcd);
+    }
+  }
+}
+
+static int
+setResultsHandler_external (ContractionTable *table, ContractionResultsHandler *handler, void *data) {
+  table->data.external.resultsHandler = handler;
+  table->data.external.resultsData = data;
+
+  ExternalContractionHelper *helpers = table->data.external.helpers;
+  int ok = 1;
+
+  if (helpers) {
+    for (unsigned int number=0; number<EXTERNAL_CONTRACTION_HELPER_LIMIT; number+=1) {
+      ExternalContractionHelper *helper = &helpers[number];
+
+      if (helper->standardInput) {
+        if (handler) {
+          if (!monitorExternalHelper(helper)) ok = 0;
+        } else if (helper->inputMonitor) {
+          asyncCancelRequest(helper->inputMonitor);
+          helper->inputMonitor = NULL;
+        }
       }
     }
   }
 
-  stopContractionCommand(bcd->table);
-  return 0;
+  return ok;
 }
 
 static void
@@ -352,7 +1206,9 @@ finishCharacterEntry_external (BrailleContractionData *bcd, CharacterEntry *entr
 
 static const ContractionTableTranslationMethods externalTranslationMethods = {
   .contractText = contractText_external,
-  .finishCharacterEntry = finishCharacterEntry_external
+  .finishCharacterEntry = finishCharacterEntry_external,
+  .setResultsHandler = setResultsHandler_external,
+  .anticipateText = anticipateText_external
 };
 
 const ContractionTableTranslationMethods *
@@ -21,6 +21,8 @@
 
 #include <stdio.h>
 
+#include "lock.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -124,6 +126,18 @@ typedef struct {
   wchar_t lowercase;
 } CharacterEntry;
 
+typedef struct {
+  CharacterEntry *array;
+  unsigned int size;
+  unsigned int count;
+} CharacterEntries;
+
+typedef struct {
+  ContractionTableRule **array;
+  unsigned int size;
+  unsigned int count;
+} ContractionRules;
+
 typedef struct {
   void (*destroy) (ContractionTable *table);
 } ContractionTableManagementMethods;
@@ -143,21 +157,11 @@ typedef struct {
   size_t size;
 } InternalContractionTable;
 
-struct ContractionTableStruct {
-  const ContractionTableManagementMethods *managementMethods;
-  const ContractionTableTranslationMethods *translationMethods;
-
-  struct {
-    CharacterEntry *array;
-    unsigned int size;
-    unsigned int count;
-  } characters;
+struct ContractionContextStruct {
+  ContractionTable *table;
 
-  struct {
-    ContractionTableRule **array;
-    unsigned int size;
-    unsigned int count;
-  } rules;
+  CharacterEntries characters;
+  ContractionRules rules;
 
   struct {
     struct {
@@ -184,20 +188,37 @@ struct ContractionTableStruct {
     unsigned char expandCurrentWord;
     unsigned char capitalizationMode;
   } cache;
+};
+
+typedef struct ExternalContractionHelperStruct ExternalContractionHelper;
+typedef struct ExternalContractionResultStruct ExternalContractionResult;
+
+struct ContractionTableStruct {
+  const ContractionTableManagementMethods *managementMethods;
+  const ContractionTableTranslationMethods *translationMethods;
+
+  CharacterEntries characters;
+  ContractionRules rules;
+
+  ContractionContext *context;
+  LockDescriptor *translationLock;
 
   union {
     InternalContractionTable internal;
 
     struct {
       char *command;
-      FILE *standardInput;
-      FILE *standardOutput;
-      unsigned commandStarted:1;
+      ExternalContractionHelper *helpers;
+      uint32_t requestIdentifier;
 
       struct {
-        char *buffer;
-        size_t size;
-      } input;
+        ExternalContractionResult **array;
+        unsigned int count;
+        unsigned long int usage;
+      } results;
+
+      ContractionResultsHandler *resultsHandler;
+      void *resultsData;
     } external;
 
 #ifdef LOUIS_TABLES_DIRECTORY
@@ -208,6 +229,15 @@ struct ContractionTableStruct {
   } data;
 };
 
+extern void initializeCharacterEntries (CharacterEntries *characters);
+extern void deallocateCharacterEntries (CharacterEntries *characters);
+
+extern void initializeContractionRules (ContractionRules *rules);
+extern void deallocateContractionRules (ContractionRules *rules);
+
+extern int prepareContractionTable (ContractionTable *table);
+extern void releaseContractionTable (ContractionTable *table);
+
 extern int startContractionCommand (ContractionTable *table);
 extern void stopContractionCommand (ContractionTable *table);
 
@@ -500,22 +500,22 @@ getContractionTableCharacter (BrailleContractionData *bcd, wchar_t character) {
 
 static int
 addRule (BrailleContractionData *bcd, ContractionTableRule *rule) {
-  ContractionTable *table = bcd->table;
+  ContractionRules *rules = &bcd->context->rules;
 
-  if (table->rules.count == table->rules.size) {
-    size_t newSize = table->rules.size + 10;
-    ContractionTableRule **newArray = realloc(table->rules.array, ARRAY_SIZE(newArray, newSize));
+  if (rules->count == rules->size) {
+    size_t newSize = rules->size + 10;
+    ContractionTableRule **newArray = realloc(rules->array, ARRAY_SIZE(newArray, newSize));
 
     if (!newArray) {
       logMallocError();
       return 0;
     }
 
-    table->rules.array = newArray;
-    table->rules.size = newSize;
+    rules->array = newArray;
+    rules->size = newSize;
   }
 
-  table->rules.array[table->rules.count++] = rule;
+  rules->array[rules->count++] = rule;
   return 1;
 }
 
@@ -536,6 +536,8 @@ makeDecomposedBraille (BrailleContractionData *bcd, wchar_t character, BYTE *cel
       if (character != entry->value) break;
 
       const ContractionTableRule *rule = entry->always;
+      if (!rule) break;
+
       unsigned int cellCount = rule->replen;
       if (!cellCount) break;
       if ((end - from) < cellCount) break;
@@ -583,7 +585,7 @@ setAlwaysRule (wchar_t character, void *data) {
       unsigned int position;
       findCharacterEntry(bcd, character, &position);
 
-      entry = &bcd->table->characters.array[position];
+      entry = &bcd->context->characters.array[position];
       sar->character = entry;
     }
 
@@ -1036,8 +1038,8 @@ contractText_native (BrailleContractionData *bcd) {
         int inputLength = to - characters;
         int outputLength = bcd->output.end - bcd->output.current;
 
-        contractText(
-          bcd->table, inputBuffer, &inputLength,
+        contractTextInContext(
+          bcd->context, inputBuffer, &inputLength,
           bcd->output.current, &outputLength, NULL, CTB_NO_CURSOR
         );
 
@@ -1172,14 +1174,19 @@ contractText_native (BrailleContractionData *bcd) {
       bcd->input.current += 1;
     }
 
-    findLineBreakOpportunities(bcd, &lbo, lineBreakOpportunities, bcd->input.begin, getInputConsumed(bcd));
-    if (lineBreakOpportunities[getInputConsumed(bcd)]) {
-      srcjoin = bcd->input.current;
-      destjoin = bcd->output.current;
+    if (bcd->input.current < bcd->input.end) {
+      // the opportunity before the next character depends on that character
+      unsigned int consumed = getInputConsumed(bcd);
+      findLineBreakOpportunities(bcd, &lbo, lineBreakOpportunities, bcd->input.begin, consumed+1);
+
+      if (lineBreakOpportunities[consumed]) {
+        srcjoin = bcd->input.current;
+        destjoin = bcd->output.current;
 
-      if (bcd->current.opcode != CTO_JoinedWord) {
-        srcword = bcd->input.current;
-        destword = bcd->output.current;
+        if (bcd->current.opcode != CTO_JoinedWord) {
+          srcword = bcd->input.current;
+          destword = bcd->output.current;
+        }
       }
     }
 
@@ -1226,9 +1233,23 @@ finishCharacterEntry_native (BrailleContractionData *bcd, CharacterEntry *entry)
   }
 }
 
+static int
+prepareCharacterEntries_native (BrailleContractionData *bcd) {
+  const ContractionTableHeader *header = getContractionTableHeader(bcd);
+  const ContractionTableCharacter *characters = getContractionTableItem(bcd, header->characters);
+
+  for (unsigned int index=0; index<header->characterCount; index+=1) {
+    if (!getCharacterEntry(bcd, characters[index].value)) return 0;
+  }
+
+  return 1;
+}
+
 static const ContractionTableTranslationMethods nativeTranslationMethods = {
   .contractText = contractText_native,
-  .finishCharacterEntry = finishCharacterEntry_native
+  .finishCharacterEntry = finishCharacterEntry_native,
+  .prepareCharacterEntries = prepareCharacterEntries_native,
+  .isReentrant = 1
 };
 
 const ContractionTableTranslationMethods *
@@ -54,14 +54,145 @@ unlockContractionTable (void) {
   releaseLock(getContractionTableLock());
 }
 
-const CharacterEntry *
-findCharacterEntry (BrailleContractionData *bcd, wchar_t character, unsigned int *position) {
+void
+initializeCharacterEntries (CharacterEntries *characters) {
+  characters->array = NULL;
+  characters->size = 0;
+  characters->count = 0;
+}
+
+void
+deallocateCharacterEntries (CharacterEntries *characters) {
+  if (characters->array) {
+    free(characters->array);
+    initializeCharacterEntries(characters);
+  }
+}
+
+void
+initializeContractionRules (ContractionRules *rules) {
+  rules->array = NULL;
+  rules->size = 0;
+  rules->count = 0;
+}
+
+void
+deallocateContractionRules (ContractionRules *rules) {
+  if (rules->array) {
+    {
+      ContractionTableRule **rule = rules->array;
+      ContractionTableRule **end = rule + rules->count;
+      while (rule < end) free(*rule++);
+    }
+
+    free(rules->array);
+    initializeContractionRules(rules);
+  }
+}
+
+ContractionContext *
+newContractionContext (ContractionTable *table) {
+  ContractionContext *context;
+
+  if ((context = malloc(sizeof(*context)))) {
+    memset(context, 0, sizeof(*context));
+    context->table = table;
+
+    initializeCharacterEntries(&context->characters);
+    initializeContractionRules(&context->rules);
+
+    context->cache.input.characters = NULL;
+    context->cache.input.size = 0;
+    context->cache.input.count = 0;
+
+    context->cache.output.cells = NULL;
+    context->cache.output.size = 0;
+    context->cache.output.count = 0;
+
+    context->cache.offsets.array = NULL;
+    context->cache.offsets.size = 0;
+    context->cache.offsets.count = 0;
+
+    return context;
+  } else {
+    logMallocError();
+  }
+
+  return NULL;
+}
+
+void
+destroyContractionContext (ContractionContext *context) {
+  deallocateCharacterEntries(&context->characters);
+  deallocateContractionRules(&context->rules);
+
+  if (context->cache.input.characters) free(context->cache.input.characters);
+  if (context->cache.output.cells) free(context->cache.output.cells);
+  if (context->cache.offsets.array) free(context->cache.offsets.array);
+
+  free(context);
+}
+
+int
+prepareContractionTable (ContractionTable *table) {
+  const ContractionTableTranslationMethods *methods = table->translationMethods;
+
+  if (methods->prepareCharacterEntries) {
+    ContractionContext *context = newContractionContext(table);
+    if (!context) return 0;
+
+    BrailleContractionData bcd = {
+      .table = table,
+      .context = context
+    };
+
+    int prepared = methods->prepareCharacterEntries(&bcd);
+
+    if (prepared) {
+      // what was made while preparing becomes the table's shared base
+      table->characters = context->characters;
+      initializeCharacterEntries(&context->characters);
+
+      table->rules = context->rules;
+      initializeContractionRules(&context->rules);
+    }
+
+    destroyContractionContext(context);
+    if (!prepared) return 0;
+  }
+
+  if (!methods->isReentrant) {
+    if (!(table->translationLock = newLockDescriptor())) return 0;
+  }
+
+  if (!(table->context = newContractionContext(table))) return 0;
+  return 1;
+}
+
+void
+releaseContractionTable (ContractionTable *table) {
+  if (table->context) {
+    destroyContractionContext(table->context);
+    table->context = NULL;
+  }
+
+  if (table->translationLock) {
+    freeLockDescriptor(table->translationLock);
+    table->translationLock = NULL;
+  }
+
+  deallocateCharacterEntries(&table->characters);
+  deallocateContractionRules(&table->rules);
+}
+
+static const CharacterEntry *
+searchCharacterEntries (const CharacterEntries *characters, wchar_t character, unsigned int *position) {
   unsigned int from = 0;
-  unsigned int to = bcd->table->characters.count;
+  unsigned int to = characters->count;
 
   while (from < to) {
     unsigned int current = (from + to) / 2;
-    const CharacterEntry *entry = &bcd->table->characters.array[current];
+    const CharacterEntry *entry = &characters->array[current];
 
     if (entry->value < character) {
       from = current + 1;
@@ -77,31 +208,38 @@ findCharacterEntry (BrailleContractionData *bcd, wchar_t character, unsigned int
   return NULL;
 }
 
+const CharacterEntry *
+findCharacterEntry (BrailleContractionData *bcd, wchar_t character, unsigned int *position) {
+  const CharacterEntry *entry = searchCharacterEntries(&bcd->table->characters, character, NULL);
+  if (entry) return entry;
+  return searchCharacterEntries(&bcd->context->characters, character, position);
+}
+
 static const CharacterEntry *
 addCharacterEntry (BrailleContractionData *bcd, wchar_t character, unsigned int position) {
-  ContractionTable *table = bcd->table;
+  CharacterEntries *characters = &bcd->context->characters;
 
-  if (table->characters.count == table->characters.size) {
-    int newSize = table->characters.size;
+  if (characters->count == characters->size) {
+    int newSize = characters->size;
     newSize = newSize? newSize<<1: 0X80;
-    CharacterEntry *newArray = realloc(table->characters.array, ARRAY_SIZE(newArray, newSize));
+    CharacterEntry *newArray = realloc(characters->array, ARRAY_SIZE(newArray, newSize));
 
     if (!newArray) {
       logMallocError();
       return NULL;
     }
 
-    table->characters.array = newArray;
-    table->characters.size = newSize;
+    characters->array = newArray;
+    characters->size = newSize;
   }
 
   memmove(
-    &table->characters.array[position+1],
-    &table->characters.array[position],
-    ((table->characters.count++ - position) * sizeof(*table->characters.array))
+    &characters->array[position+1],
+    &characters->array[position],
+    ((characters->count++ - position) * sizeof(*characters->array))
   );
 
-  CharacterEntry *entry = &bcd->table->characters.array[position];
+  CharacterEntry *entry = &characters->array[position];
   memset(entry, 0, sizeof(*entry));
   entry->value = entry->uppercase = entry->lowercase = character;
 
@@ -144,18 +282,18 @@ makeCachedCursorOffset (BrailleContractionData *bcd) {
 
 static int
 checkCache (BrailleContractionData *bcd) {
-  if (!bcd->table->cache.input.characters) return 0;
-  if (!bcd->table->cache.output.cells) return 0;
-  if (bcd->input.offsets && !bcd->table->cache.offsets.count) return 0;
-  if (bcd->table->cache.output.maximum != getOutputCount(bcd)) return 0;
-  if (bcd->table->cache.cursorOffset != makeCachedCursorOffset(bcd)) return 0;
-  if (bcd->table->cache.expandCurrentWord != prefs.expandCurrentWord) return 0;
-  if (bcd->table->cache.capitalizationMode != prefs.capitalizationMode) return 0;
+  if (!bcd->context->cache.input.characters) return 0;
+  if (!bcd->context->cache.output.cells) return 0;
+  if (bcd->input.offsets && !bcd->context->cache.offsets.count) return 0;
+  if (bcd->context->cache.output.maximum != getOutputCount(bcd)) return 0;
+  if (bcd->context->cache.cursorOffset != makeCachedCursorOffset(bcd)) return 0;
+  if (bcd->context->cache.expandCurrentWord != prefs.expandCurrentWord) return 0;
+  if (bcd->context->cache.capitalizationMode != prefs.capitalizationMode) return 0;
 
   {
     unsigned int count = getInputCount(bcd);
-    if (bcd->table->cache.input.count != count) return 0;
-    if (wmemcmp(bcd->input.begin, bcd->table->cache.input.characters, count) != 0) return 0;
+    if (bcd->context->cache.input.count != count) return 0;
+    if (wmemcmp(bcd->input.begin, bcd->context->cache.input.characters, count) != 0) return 0;
   }
 
   return 1;
@@ -166,90 +304,95 @@ updateCache (BrailleContractionData *bcd) {
   {
     unsigned int count = getInputCount(bcd);
 
-    if (count > bcd->table->cache.input.size) {
+    if (count > bcd->context->cache.input.size) {
       unsigned int newSize = count | 0X7F;
       wchar_t *newCharacters = malloc(ARRAY_SIZE(newCharacters, newSize));
 
       if (!newCharacters) {
         logMallocError();
-        bcd->table->cache.input.count = 0;
+        bcd->context->cache.input.count = 0;
         goto inputDone;
       }
 
-      if (bcd->table->cache.input.characters) free(bcd->table->cache.input.characters);
-      bcd->table->cache.input.characters = newCharacters;
-      bcd->table->cache.input.size = newSize;
+      if (bcd->context->cache.input.characters) free(bcd->context->cache.input.characters);
+      bcd->context->cache.input.characters = newCharacters;
+      bcd->context->cache.input.size = newSize;
     }
 
-    wmemcpy(bcd->table->cache.input.characters, bcd->input.begin, count);
-    bcd->table->cache.input.count = count;
-    bcd->table->cache.input.consumed = getInputConsumed(bcd);
+    wmemcpy(bcd->context->cache.input.characters, bcd->input.begin, count);
+    bcd->context->cache.input.count = count;
+    bcd->context->cache.input.consumed = getInputConsumed(bcd);
   }
 inputDone:
 
   {
     unsigned int count = getOutputConsumed(bcd);
 
-    if (count > bcd->table->cache.output.size) {
+    if (count > bcd->context->cache.output.size) {
       unsigned int newSize = count | 0X7F;
       unsigned char *newCells = malloc(ARRAY_SIZE(newCells, newSize));
 
       if (!newCells) {
         logMallocError();
-        bcd->table->cache.output.count = 0;
+        bcd->context->cache.output.count = 0;
         goto outputDone;
       }
 
-      if (bcd->table->cache.output.cells) free(bcd->table->cache.output.cells);
-      bcd->table->cache.output.cells = newCells;
-      bcd->table->cache.output.size = newSize;
+      if (bcd->context->cache.output.cells) free(bcd->context->cache.output.cells);
+      bcd->context->cache.output.cells = newCells;
+      bcd->context->cache.output.size = newSize;
     }
 
-    memcpy(bcd->table->cache.output.cells, bcd->output.begin, count);
-    bcd->table->cache.output.count = count;
-    bcd->table->cache.output.maximum = getOutputCount(bcd);
+    memcpy(bcd->context->cache.output.cells, bcd->output.begin, count);
+    bcd->context->cache.output.count = count;
+    bcd->context->cache.output.maximum = getOutputCount(bcd);
   }
 outputDone:
 
   if (bcd->input.offsets) {
     unsigned int count = getInputCount(bcd);
 
-    if (count > bcd->table->cache.offsets.size) {
+    if (count > bcd->context->cache.offsets.size) {
       unsigned int newSize = count | 0X7F;
       int *newArray = malloc(ARRAY_SIZE(newArray, newSize));
 
       if (!newArray) {
         logMallocError();
-        bcd->table->cache.offsets.count = 0;
+        bcd->context->cache.offsets.count = 0;
         goto offsetsDone;
       }
 
-      if (bcd->table->cache.offsets.array) free(bcd->table->cache.offsets.array);
-      bcd->table->cache.offsets.array = newArray;
-      bcd->table->cache.offsets.size = newSize;
+      if (bcd->context->cache.offsets.array) free(bcd->context->cache.offsets.array);
+      bcd->context->cache.offsets.array = newArray;
+      bcd->context->cache.offsets.size = newSize;
     }
 
-    memcpy(bcd->table->cache.offsets.array, bcd->input.offsets, ARRAY_SIZE(bcd->input.offsets, count));
-    bcd->table->cache.offsets.count = count;
+    memcpy(bcd->context->cache.offsets.array, bcd->input.offsets, ARRAY_SIZE(bcd->input.offsets, count));
+    bcd->context->cache.offsets.count = count;
   } else {
-    bcd->table->cache.offsets.count = 0;
+    bcd->context->cache.offsets.count = 0;
   }
 offsetsDone:
 
-  bcd->table->cache.cursorOffset = makeCachedCursorOffset(bcd);
-  bcd->table->cache.expandCurrentWord = prefs.expandCurrentWord;
-  bcd->table->cache.capitalizationMode = prefs.capitalizationMode;
+  bcd->context->cache.cursorOffset = makeCachedCursorOffset(bcd);
+  bcd->context->cache.expandCurrentWord = prefs.expandCurrentWord;
+  bcd->context->cache.capitalizationMode = prefs.capitalizationMode;
 }
 
 void
-contractText (
-  ContractionTable *contractionTable,
+contractTextInContext (
+  ContractionContext *context,
   const wchar_t *inputBuffer, int *inputLength,
   BYTE *outputBuffer, int *outputLength,
   int *offsetsMap, const int cursorOffset
 ) {
+  ContractionTable *contractionTable = context->table;
+  LockDescriptor *lock = contractionTable->translationLock;
+  if (lock) obtainExclusiveLock(lock);
+
   BrailleContractionData bcd = {
     .table = contractionTable,
+    .context = context,
 
     .input = {
       .begin = inputBuffer,
@@ -267,16 +410,16 @@ contractText (
   };
 
   if (checkCache(&bcd)) {
-    bcd.input.current = bcd.input.begin + bcd.table->cache.input.consumed;
+    bcd.input.current = bcd.input.begin + bcd.context->cache.input.consumed;
 
     if (bcd.input.offsets) {
-      memcpy(bcd.input.offsets, bcd.table->cache.offsets.array,
-             ARRAY_SIZE(bcd.input.offsets, bcd.table->cache.offsets.count));
+      memcpy(bcd.input.offsets, bcd.context->cache.offsets.array,
+             ARRAY_SIZE(bcd.input.offsets, bcd.context->cache.offsets.count));
     }
 
-    bcd.output.current = bcd.output.begin + bcd.table->cache.output.count;
-    memcpy(bcd.output.begin, bcd.table->cache.output.cells,
-           ARRAY_SIZE(bcd.output.begin, bcd.table->cache.output.count));
+    bcd.output.current = bcd.output.begin + bcd.context->cache.output.count;
+    memcpy(bcd.output.begin, bcd.context->cache.output.cells,
+           ARRAY_SIZE(bcd.output.begin, bcd.context->cache.output.count));
   } else {
     int contracted;
 
@@ -366,11 +509,76 @@ contractText (
       if (!done) bcd.input.current = srcorig;
     }
 
-    updateCache(&bcd);
+    if (!bcd.provisional) updateCache(&bcd);
   }
 
   *inputLength = getInputConsumed(&bcd);
   *outputLength = getOutputConsumed(&bcd);
+
+  if (lock) releaseLock(lock);
+}
+
+void
+contractText (
+  ContractionTable *contractionTable,
+  const wchar_t *inputBuffer, int *inputLength,
+  BYTE *outputBuffer, int *outputLength,
+  int *offsetsMap, const int cursorOffset
+) {
+  contractTextInContext(
+    contractionTable->context,
+    inputBuffer, inputLength,
+    outputBuffer, outputLength,
+    offsetsMap, cursorOffset
+  );
+}
+
+int
+setContractionResultsHandler (ContractionTable *table, ContractionResultsHandler *handler, void *data) {
+  const ContractionTableTranslationMethods *methods = table->translationMethods;
+
+  if (!methods->setResultsHandler) return 0;
+  return methods->setResultsHandler(table, handler, data);
+}
+
+int
+canAnticipateContraction (ContractionTable *table) {
+  return !!table->translationMethods->anticipateText;
+}
+
+void
+anticipateContraction (
+  ContractionTable *table,
+  const wchar_t *inputBuffer, int inputLength,
+  int outputLength, int cursorOffset
+) {
+  if (canAnticipateContraction(table)) {
+    LockDescriptor *lock = table->translationLock;
+    if (lock) obtainExclusiveLock(lock);
+
+    BYTE outputBuffer[outputLength];
+
+    BrailleContractionData bcd = {
+      .table = table,
+      .context = table->context,
+
+      .input = {
+        .begin = inputBuffer,
+        .current = inputBuffer,
+        .end = inputBuffer + inputLength,
+        .cursor = (cursorOffset == CTB_NO_CURSOR)? NULL: &inputBuffer[cursorOffset]
+      },
+
+      .output = {
+        .begin = outputBuffer,
+        .end = outputBuffer + outputLength,
+        .current = outputBuffer
+      }
+    };
+
+    table->translationMethods->anticipateText(&bcd);
+    if (lock) releaseLock(lock);
+  }
 }
 
 int
@@ -29,6 +29,7 @@ extern "C" {
 
 typedef struct {
   ContractionTable *const table;
+  ContractionContext *const context;
 
   struct {
     const wchar_t *begin;
@@ -56,11 +57,21 @@ typedef struct {
   struct {
     ContractionTableOpcode opcode;
   } previous;
+
+  // the result is a stand-in which mustn't be cached
+  unsigned provisional:1;
 } BrailleContractionData;
 
 struct ContractionTableTranslationMethodsStruct {
   int (*contractText) (BrailleContractionData *bcd);
   void (*finishCharacterEntry) (BrailleContractionData *bcd, CharacterEntry *entry);
+  int (*prepareCharacterEntries) (BrailleContractionData *bcd);
+
+  int (*setResultsHandler) (ContractionTable *table, ContractionResultsHandler *handler, void *data);
+  void (*anticipateText) (BrailleContractionData *bcd);
+
+  // contexts may be used concurrently (only the compiled table is shared)
+  unsigned isReentrant:1;
 };
 
 static inline unsigned int
@@ -55,7 +55,8 @@ allocateDataItem (DataArea *area, DataOffset *offset, size_t size, size_t alignm
   size_t newUsed = newOffset + size;
 
   if (newUsed > area->size) {
-    size_t newSize = (newUsed | 0XFFF) + 1;
+    size_t newSize = area->size? area->size: 0X1000;
+    while (newSize < newUsed) newSize <<= 1;
     unsigned char *newAddress;
 
     if (!(newAddress = realloc(area->address, newSize))) {
@@ -73,6 +74,31 @@ allocateDataItem (DataArea *area, DataOffset *offset, size_t size, size_t alignm
   return 1;
 }
 
+void
+releaseDataItems (DataArea *area, DataOffset offset) {
+  if (offset < area->used) {
+    memset(area->address+offset, 0, (area->used - offset));
+    area->used = offset;
+  }
+}
+
+int
+compactDataArea (DataArea *area) {
+  if (area->used < area->size) {
+    unsigned char *newAddress;
+
+    if (!(newAddress = realloc(area->address, (area->used? area->used: 1)))) {
+      logMallocError();
+      return 0;
+    }
+
+    area->address = newAddress;
+    area->size = area->used;
+  }
+
+  return 1;
+}
+
 void *
 getDataItem (DataArea *area, DataOffset offset) {
   return area->address + offset;
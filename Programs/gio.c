@@ -487,6 +487,19 @@ gioAskResource (
                 endpoint->options.requestTimeout);
 }
 
+const HidLayout *
+gioGetHidLayout (GioEndpoint *endpoint) {
+  GioGetHidLayoutMethod *method = endpoint->handleMethods->getHidLayout;
+
+  if (!method) {
+    logUnsupportedOperation("getHidLayout");
+    errno = ENOSYS;
+    return NULL;
+  }
+
+  return method(endpoint->handle, endpoint->options.requestTimeout);
+}
+
 int
 gioGetHidReportSize (
   GioEndpoint *endpoint,
@@ -84,6 +84,11 @@ monitorHidInput (GioHandle *handle, AsyncMonitorCallback *callback, void *data)
   return hidMonitorInput(handle->device, callback, data);
 }
 
+static const HidLayout *
+getHidLayout (GioHandle *handle, int timeout) {
+  return hidGetLayout(handle->device);
+}
+
 int
 getHidReportSize (
   GioHandle *handle, HidReportIdentifier identifier,
@@ -158,6 +163,7 @@ static const GioHandleMethods gioHidMethods = {
   .readData = readHidData,
   .monitorInput = monitorHidInput,
 
+  .getHidLayout = getHidLayout,
   .getHidReportSize = getHidReportSize,
   .getHidReport = getHidReport,
   .setHidReport = setHidReport,
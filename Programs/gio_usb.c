@@ -42,11 +42,13 @@ struct GioHandleStruct {
   UsbChannel *channel;
   GioUsbConnectionProperties properties;
   HidItemsDescriptor *hidItems;
+  HidLayout *hidLayout;
 };
 
 static int
 disconnectUsbResource (GioHandle *handle) {
   usbCloseChannel(handle->channel);
+  if (handle->hidLayout) hidDestroyLayout(handle->hidLayout);
   if (handle->hidItems) free(handle->hidItems);
   free(handle);
   return 1;
@@ -211,14 +213,25 @@ getUsbHidItems (GioHandle *handle, int timeout) {
   return handle->hidItems;
 }
 
+static const HidLayout *
+getUsbHidLayout (GioHandle *handle, int timeout) {
+  if (!handle->hidLayout) {
+    const HidItemsDescriptor *items = getUsbHidItems(handle, timeout);
+    if (!items) return NULL;
+    handle->hidLayout = hidCompileLayout(items);
+  }
+
+  return handle->hidLayout;
+}
+
 static int
 getUsbHidReportSize (
   GioHandle *handle, HidReportIdentifier identifier,
   HidReportSize *size, int timeout
 ) {
-  const HidItemsDescriptor *items = getUsbHidItems(handle, timeout);
-  if (!items) return 0;
-  return hidReportSize(items, identifier, size);
+  const HidLayout *layout = getUsbHidLayout(handle, timeout);
+  if (!layout) return 0;
+  return hidLayoutReportSize(layout, identifier, size);
 }
 
 static ssize_t
@@ -281,6 +294,7 @@ static const GioHandleMethods gioUsbMethods = {
   .tellResource = tellUsbResource,
   .askResource = askUsbResource,
 
+  .getHidLayout = getUsbHidLayout,
   .getHidReportSize = getUsbHidReportSize,
   .getHidReport = getUsbHidReport,
   .setHidReport = setUsbHidReport,
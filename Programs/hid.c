@@ -25,6 +25,7 @@
 #include "strfmt.h"
 #include "io_hid.h"
 #include "hid_internal.h"
+#include "hid_items.h"
 #include "parse.h"
 #include "device.h"
 
@@ -141,6 +142,8 @@ struct HidDeviceStruct {
 
   const HidBusMethods *busMethods;
   const HidHandleMethods *handleMethods;
+
+  HidLayout *layout;
 };
 
 static void
@@ -441,6 +444,7 @@ hidOpenDeviceWithParameters (HidDevice **device, const char *string) {
 
 void
 hidCloseDevice (HidDevice *device) {
+  if (device->layout) hidDestroyLayout(device->layout);
   hidDestroyHandle(device->handle);
   free(device);
 }
@@ -458,12 +462,29 @@ hidGetItems (HidDevice *device) {
   return method(device->handle);
 }
 
+const HidLayout *
+hidGetLayout (HidDevice *device) {
+  if (!device->layout) {
+    const HidItemsDescriptor *items = hidGetItems(device);
+    if (!items) return NULL;
+    device->layout = hidCompileLayout(items);
+  }
+
+  return device->layout;
+}
+
 int
 hidGetReportSize (
   HidDevice *device,
   HidReportIdentifier identifier,
   HidReportSize *size
 ) {
+  if (device->handleMethods->getItems) {
+    const HidLayout *layout = hidGetLayout(device);
+    if (!layout) return 0;
+    return hidLayoutReportSize(layout, identifier, size);
+  }
+
   HidGetReportSizeMethod *method = device->handleMethods->getReportSize;
 
   if (!method) {
@@ -73,147 +73,583 @@ hidNextItem (
   return 1;
 }
 
-int
-hidReportSize (
-  const HidItemsDescriptor *items,
-  HidReportIdentifier identifier,
-  HidReportSize *size
-) {
-  const unsigned char *nextByte = items->bytes;
-  size_t bytesLeft = items->count;
+typedef struct {
+  uint32_t bits[HID_RPT_TYPE_COUNT];
+  unsigned int firstField[HID_RPT_TYPE_COUNT];
+  unsigned int fieldCount[HID_RPT_TYPE_COUNT];
+} HidReportLayout;
+
+struct HidLayoutStruct {
+  unsigned char hasIdentifiers;
+  int16_t reportIndex[UINT8_MAX + 1];
+
+  HidReportLayout *reports;
+  unsigned int reportCount;
+
+  HidReportField *fields;
+  unsigned int fieldCount;
+
+  HidUnsignedValue *usages;
+  unsigned int usageCount;
+};
+
+typedef struct {
+  HidReportField field;
+  HidReportIdentifier identifier;
+  HidReportType type;
+  unsigned int order;
+  uint32_t usageIndex;
+} HidCompiledField;
+
+typedef struct {
+  HidUnsignedValue usagePage;
+  HidUnsignedValue reportIdentifier;
+  HidUnsignedValue reportSize;
+  HidUnsignedValue reportCount;
+  HidSignedValue logicalMinimum;
+} HidGlobalItems;
+
+#define HID_GLOBAL_STACK_SIZE 8
+#define HID_LOCAL_USAGE_LIMIT 0X100
+#define HID_NO_USAGE_LIST UINT32_MAX
+
+typedef struct {
+  HidLayout *layout;
+  unsigned int reportLimit;
+
+  HidCompiledField *fields;
+  unsigned int fieldCount;
+  unsigned int fieldLimit;
+
+  unsigned int usageLimit;
+
+  HidGlobalItems global;
+  HidGlobalItems globalStack[HID_GLOBAL_STACK_SIZE];
+  unsigned int globalDepth;
+
+  HidUnsignedValue usages[HID_LOCAL_USAGE_LIMIT];
+  unsigned int usageCount;
+  HidUnsignedValue usageMinimum;
+  HidUnsignedValue usageMaximum;
+  unsigned char haveUsageMinimum:1;
+  unsigned char haveUsageMaximum:1;
+} HidLayoutCompiler;
+
+static HidUnsignedValue
+hidExtendUsage (const HidLayoutCompiler *hlc, const HidItem *item) {
+  if (item->valueSize == 4) return item->value.u;
+  return (hlc->global.usagePage << 16) | item->value.u;
+}
 
-  int noIdentifier = !identifier;
-  int reportFound = noIdentifier;
+static HidReportLayout *
+hidGetReportLayout (HidLayoutCompiler *hlc, HidReportIdentifier identifier) {
+  HidLayout *layout = hlc->layout;
+  int16_t *index = &layout->reportIndex[identifier];
+
+  if (*index < 0) {
+    if (layout->reportCount == hlc->reportLimit) {
+      unsigned int newLimit = hlc->reportLimit? hlc->reportLimit<<1: 4;
+      HidReportLayout *newReports = realloc(layout->reports, ARRAY_SIZE(newReports, newLimit));
+
+      if (!newReports) {
+        logMallocError();
+        return NULL;
+      }
+
+      layout->reports = newReports;
+      hlc->reportLimit = newLimit;
+    }
+
+    memset(&layout->reports[layout->reportCount], 0, sizeof(layout->reports[0]));
+    *index = layout->reportCount++;
+  }
+
+  return &layout->reports[*index];
+}
+
+static HidCompiledField *
+hidAddField (HidLayoutCompiler *hlc) {
+  if (hlc->fieldCount == hlc->fieldLimit) {
+    unsigned int newLimit = hlc->fieldLimit? hlc->fieldLimit<<1: 0X10;
+    HidCompiledField *newFields = realloc(hlc->fields, ARRAY_SIZE(newFields, newLimit));
+
+    if (!newFields) {
+      logMallocError();
+      return NULL;
+    }
+
+    hlc->fields = newFields;
+    hlc->fieldLimit = newLimit;
+  }
+
+  {
+    HidCompiledField *field = &hlc->fields[hlc->fieldCount];
+
+    memset(field, 0, sizeof(*field));
+    field->order = hlc->fieldCount++;
+    return field;
+  }
+}
+
+static uint32_t
+hidSaveUsageList (HidLayoutCompiler *hlc) {
+  HidLayout *layout = hlc->layout;
+  unsigned int needed = layout->usageCount + hlc->usageCount;
+
+  if (needed > hlc->usageLimit) {
+    unsigned int newLimit = hlc->usageLimit? hlc->usageLimit: 0X20;
+    while (newLimit < needed) newLimit <<= 1;
+
+    HidUnsignedValue *newUsages = realloc(layout->usages, ARRAY_SIZE(newUsages, newLimit));
+
+    if (!newUsages) {
+      logMallocError();
+      return HID_NO_USAGE_LIST;
+    }
+
+    layout->usages = newUsages;
+    hlc->usageLimit = newLimit;
+  }
+
+  {
+    uint32_t index = layout->usageCount;
+
+    memcpy(&layout->usages[index], hlc->usages, ARRAY_SIZE(hlc->usages, hlc->usageCount));
+    layout->usageCount = needed;
+    return index;
+  }
+}
+
+static int
+hidAddMainItem (HidLayoutCompiler *hlc, HidReportType type, HidUnsignedValue flags) {
+  const HidGlobalItems *global = &hlc->global;
+  if (global->reportIdentifier > UINT8_MAX) return 1;
+
+  HidReportLayout *report = hidGetReportLayout(hlc, global->reportIdentifier);
+  if (!report) return 0;
+
+  uint32_t *bits = &report->bits[type];
+  uint32_t width = global->reportSize;
+  uint32_t count = global->reportCount;
+
+  int haveRange = hlc->haveUsageMinimum && hlc->haveUsageMaximum &&
+                  (hlc->usageMaximum >= hlc->usageMinimum);
+  int haveUsages = hlc->usageCount || haveRange;
 
-  size_t inputSize = 0;
-  size_t outputSize = 0;
-  size_t featureSize = 0;
+  if ((width > 0) && (width <= 32) && haveUsages && !(flags & HID_USG_FLG_CONSTANT)) {
+    int isArray = !(flags & HID_USG_FLG_VARIABLE);
+    uint32_t usageIndex = HID_NO_USAGE_LIST;
 
+    if (isArray && hlc->usageCount) {
+      if ((usageIndex = hidSaveUsageList(hlc)) == HID_NO_USAGE_LIST) return 0;
+    }
+
+    for (uint32_t index=0; index<count; index+=1) {
+      HidCompiledField *compiled = hidAddField(hlc);
+      if (!compiled) return 0;
+
+      HidReportField *field = &compiled->field;
+      compiled->identifier = global->reportIdentifier;
+      compiled->type = type;
+      compiled->usageIndex = usageIndex;
+
+      field->bitOffset = *bits + (index * width);
+      field->bitWidth = width;
+      field->isArray = isArray;
+
+      if (isArray) {
+        field->logicalMinimum = global->logicalMinimum;
+
+        if (hlc->usageCount) {
+          field->usage = hlc->usages[0];
+          field->usageCount = hlc->usageCount;
+        } else {
+          field->usage = hlc->usageMinimum;
+          field->usageCount = hlc->usageMaximum - hlc->usageMinimum + 1;
+        }
+      } else if (hlc->usageCount) {
+        field->usage = hlc->usages[MIN(index, hlc->usageCount-1)];
+      } else {
+        field->usage = MIN(hlc->usageMinimum + index, hlc->usageMaximum);
+      }
+    }
+  }
+
+  *bits += width * count;
+  return 1;
+}
+
+static void
+hidResetLocalItems (HidLayoutCompiler *hlc) {
+  hlc->usageCount = 0;
+  hlc->haveUsageMinimum = 0;
+  hlc->haveUsageMaximum = 0;
+}
+
+static int
+hidCompareCompiledFields (const void *element1, const void *element2) {
+  const HidCompiledField *field1 = element1;
+  const HidCompiledField *field2 = element2;
+
+  if (field1->identifier < field2->identifier) return -1;
+  if (field1->identifier > field2->identifier) return 1;
+
+  if (field1->type < field2->type) return -1;
+  if (field1->type > field2->type) return 1;
+
+  if (field1->field.usage < field2->field.usage) return -1;
+  if (field1->field.usage > field2->field.usage) return 1;
+
+  if (field1->order < field2->order) return -1;
+  if (field1->order > field2->order) return 1;
+  return 0;
+}
+
+static int
+hidFinishLayout (HidLayoutCompiler *hlc) {
+  HidLayout *layout = hlc->layout;
+  unsigned int count = hlc->fieldCount;
+
+  qsort(hlc->fields, count, sizeof(*hlc->fields), hidCompareCompiledFields);
+
+  if (count) {
+    if (!(layout->fields = malloc(ARRAY_SIZE(layout->fields, count)))) {
+      logMallocError();
+      return 0;
+    }
+  }
+
+  for (unsigned int index=0; index<count; index+=1) {
+    const HidCompiledField *compiled = &hlc->fields[index];
+    HidReportField *field = &layout->fields[index];
+    HidReportLayout *report = &layout->reports[layout->reportIndex[compiled->identifier]];
+
+    *field = compiled->field;
+    if (layout->hasIdentifiers) field->bitOffset += 8;
+
+    if (compiled->usageIndex != HID_NO_USAGE_LIST) {
+      field->usageList = &layout->usages[compiled->usageIndex];
+    }
+
+    if (!report->fieldCount[compiled->type]) report->firstField[compiled->type] = index;
+    report->fieldCount[compiled->type] += 1;
+  }
+
+  layout->fieldCount = count;
+  return 1;
+}
+
+HidLayout *
+hidCompileLayout (const HidItemsDescriptor *items) {
+  HidLayoutCompiler hlc;
+  memset(&hlc, 0, sizeof(hlc));
+
+  if (!(hlc.layout = malloc(sizeof(*hlc.layout)))) {
+    logMallocError();
+    return NULL;
+  }
+
+  HidLayout *layout = hlc.layout;
+  memset(layout, 0, sizeof(*layout));
+
+  for (unsigned int identifier=0; identifier<ARRAY_COUNT(layout->reportIndex); identifier+=1) {
+    layout->reportIndex[identifier] = -1;
+  }
+
+  const unsigned char *nextByte = items->bytes;
+  size_t bytesLeft = items->count;
   uint64_t itemTagsEncountered = 0;
-  HidUnsignedValue reportIdentifier = 0;
-  HidUnsignedValue reportSize = 0;
-  HidUnsignedValue reportCount = 0;
+  int ok = 1;
 
   while (bytesLeft) {
     size_t offset = nextByte - items->bytes;
     HidItem item;
 
     if (!hidNextItem(&item, &nextByte, &bytesLeft)) {
-      if (bytesLeft) return 0;
+      logMessage(LOG_CATEGORY(HID_IO),
+        "malformed item at offset %"PRIsize, offset
+      );
+
+      ok = 0;
       break;
     }
 
-    if (item.tag == HID_ITM_ReportID) {
-      if (noIdentifier) {
-        reportFound = 0;
-        break;
-      }
-
-      reportIdentifier = item.value.u;
-      if (reportIdentifier == identifier) reportFound = 1;
-    } else {
-      switch (item.tag) {
+    switch (item.tag) {
       {
-        size_t *size;
+        HidReportType type;
 
         case HID_ITM_Input:
-          size = &inputSize;
-          goto doSize;
+          type = HID_RPT_INPUT;
+          goto doMain;
 
         case HID_ITM_Output:
-          size = &outputSize;
-          goto doSize;
+          type = HID_RPT_OUTPUT;
+          goto doMain;
 
         case HID_ITM_Feature:
-          size = &featureSize;
-          goto doSize;
+          type = HID_RPT_FEATURE;
+          goto doMain;
 
-        doSize:
-          if (reportIdentifier == identifier) *size += reportSize * reportCount;
+        doMain:
+          if (!hidAddMainItem(&hlc, type, item.value.u)) ok = 0;
+          hidResetLocalItems(&hlc);
           break;
       }
 
-        case HID_ITM_ReportCount:
-          reportCount = item.value.u;
-          break;
+      case HID_ITM_Collection:
+      case HID_ITM_EndCollection:
+        hidResetLocalItems(&hlc);
+        break;
 
-        case HID_ITM_ReportSize:
-          reportSize = item.value.u;
-          break;
+      case HID_ITM_ReportID:
+        layout->hasIdentifiers = 1;
+        hlc.global.reportIdentifier = item.value.u;
 
-        case HID_ITM_Collection:
-        case HID_ITM_EndCollection:
-        case HID_ITM_UsagePage:
-        case HID_ITM_UsageMinimum:
-        case HID_ITM_UsageMaximum:
-        case HID_ITM_Usage:
-        case HID_ITM_LogicalMinimum:
-        case HID_ITM_LogicalMaximum:
-        case HID_ITM_PhysicalMinimum:
-        case HID_ITM_PhysicalMaximum:
-          break;
+        if (item.value.u <= UINT8_MAX) {
+          if (!hidGetReportLayout(&hlc, item.value.u)) ok = 0;
+        }
+        break;
 
-        default: {
-          if (!(itemTagsEncountered & HID_ITEM_TAG_BIT(item.tag))) {
-            logMessage(LOG_CATEGORY(HID_IO),
-              "unhandled item tag at offset %"PRIsize ": 0X%02X",
-              offset, item.tag
-            );
-          }
+      case HID_ITM_UsagePage:
+        hlc.global.usagePage = item.value.u;
+        break;
 
-          break;
+      case HID_ITM_ReportSize:
+        hlc.global.reportSize = item.value.u;
+        break;
+
+      case HID_ITM_ReportCount:
+        hlc.global.reportCount = item.value.u;
+        break;
+
+      case HID_ITM_LogicalMinimum:
+        hlc.global.logicalMinimum = item.value.s;
+        break;
+
+      case HID_ITM_Push:
+        if (hlc.globalDepth < ARRAY_COUNT(hlc.globalStack)) {
+          hlc.globalStack[hlc.globalDepth++] = hlc.global;
         }
+        break;
+
+      case HID_ITM_Pop:
+        if (hlc.globalDepth) hlc.global = hlc.globalStack[--hlc.globalDepth];
+        break;
+
+      case HID_ITM_Usage:
+        if (hlc.usageCount < ARRAY_COUNT(hlc.usages)) {
+          hlc.usages[hlc.usageCount++] = hidExtendUsage(&hlc, &item);
+        }
+        break;
+
+      case HID_ITM_UsageMinimum:
+        hlc.usageMinimum = hidExtendUsage(&hlc, &item);
+        hlc.haveUsageMinimum = 1;
+        break;
+
+      case HID_ITM_UsageMaximum:
+        hlc.usageMaximum = hidExtendUsage(&hlc, &item);
+        hlc.haveUsageMaximum = 1;
+        break;
+
+      case HID_ITM_LogicalMaximum:
+      case HID_ITM_PhysicalMinimum:
+      case HID_ITM_PhysicalMaximum:
+        break;
+
+      default: {
+        if (!(itemTagsEncountered & HID_ITEM_TAG_BIT(item.tag))) {
+          logMessage(LOG_CATEGORY(HID_IO),
+            "unhandled item tag at offset %"PRIsize ": 0X%02X",
+            offset, item.tag
+          );
+        }
+
+        break;
       }
     }
 
+    if (!ok) break;
     itemTagsEncountered |= HID_ITEM_TAG_BIT(item.tag);
   }
 
-  if (reportFound) {
-    char log[0X100];
-    STR_BEGIN(log, sizeof(log));
-    STR_PRINTF("report size: %02X", identifier);
-
-    {
-      typedef struct {
-        const char *label;
-        size_t *bytes;
-        size_t bits;
-      } SizeEntry;
-
-      SizeEntry sizeTable[] = {
-        { .label = "In",
-          .bits = inputSize,
-          .bytes = &size->input
-        },
-
-        { .label = "Out",
-          .bits = outputSize,
-          .bytes = &size->output
-        },
-
-        { .label = "Ftr",
-          .bits = featureSize,
-          .bytes = &size->feature
-        },
-      };
-
-      SizeEntry *entry = sizeTable;
-      const SizeEntry *end = entry + ARRAY_COUNT(sizeTable);
-
-      while (entry < end) {
-        size_t bytes = (entry->bits + 7) / 8;
-        if (bytes && !noIdentifier) bytes += 1;
-        *entry->bytes = bytes;
-
-        STR_PRINTF(" %s:%" PRIsize, entry->label, bytes);
-        entry += 1;
+  if (ok) ok = hidFinishLayout(&hlc);
+  if (hlc.fields) free(hlc.fields);
+  if (ok) return layout;
+
+  hidDestroyLayout(layout);
+  return NULL;
+}
+
+void
+hidDestroyLayout (HidLayout *layout) {
+  if (layout->usages) free(layout->usages);
+  if (layout->fields) free(layout->fields);
+  if (layout->reports) free(layout->reports);
+  free(layout);
+}
+
+static const HidReportLayout *
+hidFindReportLayout (const HidLayout *layout, HidReportIdentifier identifier) {
+  int16_t index = layout->reportIndex[identifier];
+  if (index < 0) return NULL;
+  return &layout->reports[index];
+}
+
+int
+hidLayoutReportSize (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  HidReportSize *size
+) {
+  int noIdentifier = !identifier;
+  const HidReportLayout *report = hidFindReportLayout(layout, identifier);
+
+  if (noIdentifier) {
+    if (layout->hasIdentifiers) return 0;
+  } else if (!report) {
+    return 0;
+  }
+
+  char log[0X100];
+  STR_BEGIN(log, sizeof(log));
+  STR_PRINTF("report size: %02X", identifier);
+
+  {
+    typedef struct {
+      const char *label;
+      size_t *bytes;
+      HidReportType type;
+    } SizeEntry;
+
+    const SizeEntry sizeTable[] = {
+      { .label = "In",
+        .type = HID_RPT_INPUT,
+        .bytes = &size->input
+      },
+
+      { .label = "Out",
+        .type = HID_RPT_OUTPUT,
+        .bytes = &size->output
+      },
+
+      { .label = "Ftr",
+        .type = HID_RPT_FEATURE,
+        .bytes = &size->feature
+      },
+    };
+
+    const SizeEntry *entry = sizeTable;
+    const SizeEntry *end = entry + ARRAY_COUNT(sizeTable);
+
+    while (entry < end) {
+      size_t bits = report? report->bits[entry->type]: 0;
+      size_t bytes = (bits + 7) / 8;
+      if (bytes && !noIdentifier) bytes += 1;
+      *entry->bytes = bytes;
+
+      STR_PRINTF(" %s:%" PRIsize, entry->label, bytes);
+      entry += 1;
+    }
+  }
+
+  STR_END;
+  logMessage(LOG_CATEGORY(HID_IO), "%s", log);
+  return 1;
+}
+
+int
+hidReportSize (
+  const HidItemsDescriptor *items,
+  HidReportIdentifier identifier,
+  HidReportSize *size
+) {
+  HidLayout *layout = hidCompileLayout(items);
+  if (!layout) return 0;
+
+  int found = hidLayoutReportSize(layout, identifier, size);
+  hidDestroyLayout(layout);
+  return found;
+}
+
+const HidReportField *
+hidGetReportFields (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  HidReportType type,
+  unsigned int *count
+) {
+  const HidReportLayout *report = hidFindReportLayout(layout, identifier);
+
+  if (!report || !(*count = report->fieldCount[type])) {
+    *count = 0;
+    return NULL;
+  }
+
+  return &layout->fields[report->firstField[type]];
+}
+
+HidUnsignedValue
+hidGetReportBits (
+  const unsigned char *report, size_t size,
+  uint32_t bitOffset, unsigned char bitWidth
+) {
+  if (((size_t)bitOffset + bitWidth) > (size * 8)) return 0;
+
+  const unsigned char *byte = &report[bitOffset / 8];
+  unsigned char shift = bitOffset % 8;
+
+  if (!shift && (bitWidth == 8)) return *byte;
+  if (bitWidth == 1) return (*byte >> shift) & 1;
+
+  unsigned int count = (shift + bitWidth + 7) / 8;
+  uint64_t bits = 0;
+
+  for (unsigned int index=0; index<count; index+=1) {
+    bits |= (uint64_t)byte[index] << (index * 8);
+  }
+
+  bits >>= shift;
+  if (bitWidth < 32) bits &= (UINT64_C(1) << bitWidth) - 1;
+  return bits;
+}
+
+HidUnsignedValue
+hidGetFieldValue (
+  const HidReportField *field,
+  const unsigned char *report, size_t size
+) {
+  return hidGetReportBits(report, size, field->bitOffset, field->bitWidth);
+}
+
+unsigned int
+hidGetActiveUsages (
+  const HidLayout *layout,
+  HidReportIdentifier identifier,
+  const unsigned char *report, size_t size,
+  HidUnsignedValue *usages, unsigned int limit
+) {
+  unsigned int count = 0;
+  unsigned int fieldCount;
+  const HidReportField *field = hidGetReportFields(layout, identifier, HID_RPT_INPUT, &fieldCount);
+  const HidReportField *end = field + fieldCount;
+
+  while ((field < end) && (count < limit)) {
+    HidUnsignedValue value = hidGetFieldValue(field, report, size);
+
+    if (field->isArray) {
+      int64_t index = (int64_t)value - field->logicalMinimum;
+
+      if ((index >= 0) && (index < field->usageCount)) {
+        HidUnsignedValue usage = field->usageList? field->usageList[index]: (field->usage + index);
+        if (usage & 0XFFFF) usages[count++] = usage;
       }
+    } else if ((field->bitWidth == 1) && value) {
+      usages[count++] = field->usage;
     }
 
-    STR_END;
-    logMessage(LOG_CATEGORY(HID_IO), "%s", log);
+    field += 1;
   }
 
-  return reportFound;
+  return count;
 }
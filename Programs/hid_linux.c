@@ -30,7 +30,6 @@
 #include "log.h"
 #include "hid_types.h"
 #include "hid_internal.h"
-#include "hid_items.h"
 #include "io_misc.h"
 #include "async_handle.h"
 #include "async_io.h"
@@ -103,17 +102,6 @@ hidLinuxGetItems (HidHandle *handle) {
   return NULL;
 }
 
-static int
-hidLinuxGetReportSize (
-  HidHandle *handle,
-  HidReportIdentifier identifier,
-  HidReportSize *size
-) {
-  const HidItemsDescriptor *items = hidLinuxGetItems(handle);
-  if (!items) return 0;
-  return hidReportSize(items, identifier, size);
-}
-
 static ssize_t
 hidLinuxGetReport (HidHandle *handle, unsigned char *buffer, size_t size) {
   int length;
@@ -294,7 +282,6 @@ static const HidHandleMethods hidLinuxHandleMethods = {
 
   .getItems = hidLinuxGetItems,
 
-  .getReportSize = hidLinuxGetReportSize,
   .getReport = hidLinuxGetReport,
   .setReport = hidLinuxSetReport,
   .getFeature = hidLinuxGetFeature,
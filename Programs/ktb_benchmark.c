@@ -0,0 +1,282 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "strfmt.h"
+#include "timing.h"
+#include "ktb.h"
+#include "ktb_internal.h"
+#include "ktb_inspect.h"
+
+typedef const KeyBinding *KeyBindingFinder (
+  const KeyContext *ctx, const KeyValue *keys, unsigned int count,
+  const KeyValue *immediate, int *isIncomplete
+);
+
+static int
+sortModifierKeys (const void *element1, const void *element2) {
+  const KeyValue *modifier1 = element1;
+  const KeyValue *modifier2 = element2;
+  return compareKeyValues(modifier1, modifier2);
+}
+
+static int
+searchKeyBinding (const void *target, const void *element) {
+  const KeyBinding *reference = target;
+  const KeyBinding *binding = element;
+  return compareKeyBindings(reference, binding);
+}
+
+static const KeyBinding *
+enumerateKeyBindings (
+  const KeyContext *ctx, const KeyValue *keys, unsigned int count,
+  const KeyValue *immediate, int *isIncomplete
+) {
+  if (!ctx->keyBindings.table) return NULL;
+  if (count > MAX_MODIFIERS_PER_COMBINATION) return NULL;
+
+  KeyBinding target = {
+    .keyCombination.modifierCount = count
+  };
+
+  if (immediate) {
+    target.keyCombination.immediateKey = *immediate;
+    target.keyCombination.flags |= KCF_IMMEDIATE_KEY;
+  }
+
+  while (1) {
+    unsigned int all = (1 << count) - 1;
+
+    for (unsigned int bits=0; bits<=all; bits+=1) {
+      for (unsigned int index=0; index<count; index+=1) {
+        KeyValue *modifier = &target.keyCombination.modifierKeys[index];
+
+        *modifier = keys[index];
+        if (bits & (1 << index)) modifier->number = KTB_KEY_ANY;
+      }
+
+      qsort(
+        target.keyCombination.modifierKeys, count,
+        sizeof(*target.keyCombination.modifierKeys), sortModifierKeys
+      );
+
+      {
+        const KeyBinding *binding = bsearch(&target, ctx->keyBindings.table,
+                                            ctx->keyBindings.count,
+                                            sizeof(*ctx->keyBindings.table),
+                                            searchKeyBinding);
+
+        if (binding) {
+          if (binding->primaryCommand.value != EOF) return binding;
+          *isIncomplete = 1;
+        }
+      }
+    }
+
+    if (!(target.keyCombination.flags & KCF_IMMEDIATE_KEY)) break;
+    if (target.keyCombination.immediateKey.number == KTB_KEY_ANY) break;
+    target.keyCombination.immediateKey.number = KTB_KEY_ANY;
+  }
+
+  return NULL;
+}
+
+typedef struct {
+  const KeyBinding *immediateBinding;
+  const KeyBinding *combinationBinding;
+  int isIncomplete;
+} KeyPressResult;
+
+typedef struct {
+  const KeyContext *ctx;
+  unsigned int keyCount;
+  KeyValue pressedKeys[MAX_MODIFIERS_PER_COMBINATION + 1];
+  KeyValue keySequence[MAX_MODIFIERS_PER_COMBINATION + 1];
+} KeyEventSequence;
+
+static void
+chooseKeyNumber (KeyEventSequence *kes, KeyValue *key) {
+  if (key->number == KTB_KEY_ANY) {
+    key->number = 0;
+
+    for (unsigned int index=0; index<kes->keyCount; index+=1) {
+      const KeyValue *kv = &kes->keySequence[index];
+
+      if ((kv->group == key->group) && (kv->number >= key->number)) {
+        key->number = kv->number + 1;
+      }
+    }
+  }
+}
+
+static void
+makeKeyEventSequence (KeyEventSequence *kes, const KeyContext *ctx, const KeyBinding *binding) {
+  const KeyCombination *combination = &binding->keyCombination;
+
+  kes->ctx = ctx;
+  kes->keyCount = 0;
+
+  for (unsigned int index=0; index<combination->modifierCount; index+=1) {
+    KeyValue key = combination->modifierKeys[combination->modifierPositions[index]];
+
+    chooseKeyNumber(kes, &key);
+    kes->keySequence[kes->keyCount++] = key;
+  }
+
+  if (combination->flags & KCF_IMMEDIATE_KEY) {
+    KeyValue key = combination->immediateKey;
+
+    chooseKeyNumber(kes, &key);
+    kes->keySequence[kes->keyCount++] = key;
+  }
+}
+
+static void
+pressKeySequence (KeyEventSequence *kes, KeyBindingFinder *findKeyBinding, KeyPressResult *results) {
+  unsigned int pressedCount = 0;
+
+  for (unsigned int index=0; index<kes->keyCount; index+=1) {
+    const KeyValue *key = &kes->keySequence[index];
+    KeyPressResult *result = &results[index];
+
+    memset(result, 0, sizeof(*result));
+    result->immediateBinding = findKeyBinding(kes->ctx, kes->pressedKeys, pressedCount, key, &result->isIncomplete);
+
+    {
+      unsigned int position;
+
+      if (!findKeyValue(kes->pressedKeys, pressedCount, key, &position)) {
+        memmove(&kes->pressedKeys[position+1], &kes->pressedKeys[position],
+                (pressedCount - position) * sizeof(*kes->pressedKeys));
+        kes->pressedKeys[position] = *key;
+        pressedCount += 1;
+      }
+    }
+
+    result->combinationBinding = findKeyBinding(kes->ctx, kes->pressedKeys, pressedCount, NULL, &result->isIncomplete);
+  }
+}
+
+static int
+verifyKeySequence (KeyTable *table, KeyEventSequence *kes) {
+  KeyPressResult expected[kes->keyCount];
+  KeyPressResult actual[kes->keyCount];
+
+  pressKeySequence(kes, enumerateKeyBindings, expected);
+  pressKeySequence(kes, findContextKeyBinding, actual);
+  if (memcmp(expected, actual, sizeof(actual)) == 0) return 1;
+
+  {
+    char log[0X100];
+    STR_BEGIN(log, sizeof(log));
+
+    STR_PRINTF("key binding lookup mismatch: %" PRIws ":", kes->ctx->name);
+
+    for (unsigned int index=0; index<kes->keyCount; index+=1) {
+      STR_PRINTF(" ");
+      STR_FORMAT(formatKeyName, table, &kes->keySequence[index]);
+    }
+
+    STR_END;
+    logMessage(LOG_WARNING, "%s", log);
+  }
+
+  return 0;
+}
+
+static unsigned long int
+measureKeyEvents (KeyTable *table, KeyBindingFinder *findKeyBinding, unsigned int rounds, long int *elapsed) {
+  unsigned long int events = 0;
+  TimeValue start;
+  TimeValue end;
+
+  getMonotonicTime(&start);
+
+  while (rounds--) {
+    for (unsigned int context=0; context<table->keyContexts.count; context+=1) {
+      const KeyContext *ctx = getKeyContext(table, context);
+
+      for (unsigned int index=0; index<ctx->keyBindings.count; index+=1) {
+        const KeyBinding *binding = &ctx->keyBindings.table[index];
+
+        if (binding->primaryCommand.value != EOF) {
+          KeyEventSequence kes;
+          makeKeyEventSequence(&kes, ctx, binding);
+
+          {
+            KeyPressResult results[kes.keyCount];
+            pressKeySequence(&kes, findKeyBinding, results);
+          }
+
+          events += kes.keyCount;
+        }
+      }
+    }
+  }
+
+  getMonotonicTime(&end);
+  *elapsed = millisecondsBetween(&start, &end);
+  return events;
+}
+
+static void
+reportKeyEventThroughput (const char *label, unsigned long int events, long int elapsed) {
+  logMessage(LOG_NOTICE,
+    "%s: %lu key presses in %ldms (%lu per second)",
+    label, events, elapsed,
+    (events * 1000UL) / (unsigned long int)MAX(elapsed, 1)
+  );
+}
+
+int
+benchmarkKeyTable (KeyTable *table, unsigned int rounds) {
+  int ok = 1;
+
+  for (unsigned int context=0; context<table->keyContexts.count; context+=1) {
+    const KeyContext *ctx = getKeyContext(table, context);
+
+    for (unsigned int index=0; index<ctx->keyBindings.count; index+=1) {
+      const KeyBinding *binding = &ctx->keyBindings.table[index];
+
+      if (binding->primaryCommand.value != EOF) {
+        KeyEventSequence kes;
+
+        makeKeyEventSequence(&kes, ctx, binding);
+        if (!verifyKeySequence(table, &kes)) ok = 0;
+      }
+    }
+  }
+
+  {
+    long int elapsed;
+    unsigned long int events = measureKeyEvents(table, enumerateKeyBindings, rounds, &elapsed);
+    reportKeyEventThroughput("subset enumeration", events, elapsed);
+  }
+
+  {
+    long int elapsed;
+    unsigned long int events = measureKeyEvents(table, findContextKeyBinding, rounds, &elapsed);
+    reportKeyEventThroughput("binding trie", events, elapsed);
+  }
+
+  return ok;
+}
@@ -187,6 +187,13 @@ getKeyContext (KeyTableData *ktd, unsigned char context) {
       ctx->keyBindings.size = 0;
       ctx->keyBindings.count = 0;
 
+      ctx->keyBindingTrie.nodes = NULL;
+      ctx->keyBindingTrie.nodeCount = 0;
+      ctx->keyBindingTrie.edges = NULL;
+      ctx->keyBindingTrie.edgeCount = 0;
+      ctx->keyBindingTrie.immediates = NULL;
+      ctx->keyBindingTrie.immediateCount = 0;
+
       ctx->hotkeys.table = NULL;
       ctx->hotkeys.size = 0;
       ctx->hotkeys.count = 0;
@@ -1533,6 +1540,163 @@ addIncompleteBindings (KeyContext *ctx) {
   return 1;
 }
 
+static int
+compareTrieBindings (const KeyBinding *binding1, const KeyBinding *binding2) {
+  const KeyCombination *combination1 = &binding1->keyCombination;
+  const KeyCombination *combination2 = &binding2->keyCombination;
+  unsigned int count = MIN(combination1->modifierCount, combination2->modifierCount);
+
+  for (unsigned int index=0; index<count; index+=1) {
+    int relation = compareKeyValues(&combination1->modifierKeys[index], &combination2->modifierKeys[index]);
+    if (relation) return relation;
+  }
+
+  if (combination1->modifierCount < combination2->modifierCount) return -1;
+  if (combination1->modifierCount > combination2->modifierCount) return 1;
+
+  if (combination1->flags & KCF_IMMEDIATE_KEY) {
+    if (!(combination2->flags & KCF_IMMEDIATE_KEY)) return 1;
+    return compareKeyValues(&combination1->immediateKey, &combination2->immediateKey);
+  }
+
+  if (combination2->flags & KCF_IMMEDIATE_KEY) return -1;
+  return 0;
+}
+
+static int
+sortTrieBindings (const void *element1, const void *element2) {
+  const KeyBinding *const *binding1 = element1;
+  const KeyBinding *const *binding2 = element2;
+  return compareTrieBindings(*binding1, *binding2);
+}
+
+static unsigned int
+addKeyBindingNode (KeyContext *ctx, const KeyBinding **bindings, unsigned int first, unsigned int last, unsigned char depth) {
+  unsigned int index = ctx->keyBindingTrie.nodeCount++;
+  KeyBindingNode *node = &ctx->keyBindingTrie.nodes[index];
+
+  node->binding = NULL;
+  node->firstImmediate = ctx->keyBindingTrie.immediateCount;
+  node->immediateCount = 0;
+  node->anyKeyDepth = 0;
+
+  while (first < last) {
+    const KeyBinding *binding = bindings[first];
+    const KeyCombination *combination = &binding->keyCombination;
+
+    if (combination->modifierCount > depth) break;
+    first += 1;
+
+    if (combination->flags & KCF_IMMEDIATE_KEY) {
+      ImmediateKeyBinding *ikb = &ctx->keyBindingTrie.immediates[ctx->keyBindingTrie.immediateCount++];
+
+      ikb->keyValue = combination->immediateKey;
+      ikb->binding = binding;
+      node->immediateCount += 1;
+    } else {
+      node->binding = binding;
+    }
+  }
+
+  node->firstEdge = ctx->keyBindingTrie.edgeCount;
+  node->edgeCount = 0;
+
+  for (unsigned int next=first; next<last; node->edgeCount+=1) {
+    const KeyValue *key = &bindings[next++]->keyCombination.modifierKeys[depth];
+
+    while ((next < last) && (compareKeyValues(key, &bindings[next]->keyCombination.modifierKeys[depth]) == 0)) {
+      next += 1;
+    }
+  }
+
+  ctx->keyBindingTrie.edgeCount += node->edgeCount;
+
+  {
+    KeyBindingEdge *edge = &ctx->keyBindingTrie.edges[node->firstEdge];
+
+    while (first < last) {
+      const KeyValue *key = &bindings[first]->keyCombination.modifierKeys[depth];
+      unsigned int next = first + 1;
+
+      while ((next < last) && (compareKeyValues(key, &bindings[next]->keyCombination.modifierKeys[depth]) == 0)) {
+        next += 1;
+      }
+
+      edge->keyValue = *key;
+      edge->node = addKeyBindingNode(ctx, bindings, first, next, depth+1);
+
+      {
+        unsigned char anyKeyDepth = ctx->keyBindingTrie.nodes[edge->node].anyKeyDepth;
+
+        if (key->number == KTB_KEY_ANY) anyKeyDepth += 1;
+        if (anyKeyDepth > node->anyKeyDepth) node->anyKeyDepth = anyKeyDepth;
+      }
+
+      edge += 1;
+      first = next;
+    }
+  }
+
+  return index;
+}
+
+static void
+destroyKeyBindingTrie (KeyContext *ctx) {
+  if (ctx->keyBindingTrie.nodes) {
+    free(ctx->keyBindingTrie.nodes);
+    ctx->keyBindingTrie.nodes = NULL;
+  }
+
+  if (ctx->keyBindingTrie.edges) {
+    free(ctx->keyBindingTrie.edges);
+    ctx->keyBindingTrie.edges = NULL;
+  }
+
+  if (ctx->keyBindingTrie.immediates) {
+    free(ctx->keyBindingTrie.immediates);
+    ctx->keyBindingTrie.immediates = NULL;
+  }
+
+  ctx->keyBindingTrie.nodeCount = 0;
+  ctx->keyBindingTrie.edgeCount = 0;
+  ctx->keyBindingTrie.immediateCount = 0;
+}
+
+static int
+compileKeyBindingTrie (KeyContext *ctx) {
+  unsigned int count = ctx->keyBindings.count;
+
+  destroyKeyBindingTrie(ctx);
+  if (!count) return 1;
+
+  {
+    unsigned int modifierCount = 0;
+    const KeyBinding *bindings[count];
+
+    for (unsigned int index=0; index<count; index+=1) {
+      const KeyBinding *binding = &ctx->keyBindings.table[index];
+
+      bindings[index] = binding;
+      modifierCount += binding->keyCombination.modifierCount;
+    }
+
+    qsort(bindings, count, sizeof(*bindings), sortTrieBindings);
+
+    if ((ctx->keyBindingTrie.nodes = malloc(ARRAY_SIZE(ctx->keyBindingTrie.nodes, modifierCount+1)))) {
+      if (!modifierCount || (ctx->keyBindingTrie.edges = malloc(ARRAY_SIZE(ctx->keyBindingTrie.edges, modifierCount)))) {
+        if ((ctx->keyBindingTrie.immediates = malloc(ARRAY_SIZE(ctx->keyBindingTrie.immediates, count)))) {
+          addKeyBindingNode(ctx, bindings, 0, count, 0);
+          return 1;
+        }
+      }
+    }
+  }
+
+  logMallocError();
+  destroyKeyBindingTrie(ctx);
+  return 0;
+}
+
 static int
 prepareKeyBindings (KeyContext *ctx) {
   if (!addIncompleteBindings(ctx)) return 0;
@@ -1555,6 +1719,7 @@ prepareKeyBindings (KeyContext *ctx) {
     ctx->keyBindings.size = ctx->keyBindings.count;
   }
 
+  if (!compileKeyBindingTrie(ctx)) return 0;
   return 1;
 }
 
@@ -1706,6 +1871,7 @@ destroyKeyTable (KeyTable *table) {
     if (ctx->title) free(ctx->title);
 
     if (ctx->keyBindings.table) free(ctx->keyBindings.table);
+    destroyKeyBindingTrie(ctx);
     if (ctx->hotkeys.table) free(ctx->hotkeys.table);
     if (ctx->mappedKeys.table) free(ctx->mappedKeys.table);
   }
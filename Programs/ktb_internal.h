@@ -90,6 +90,28 @@ typedef struct {
   unsigned char flags;
 } MappedKeyEntry;
 
+typedef struct {
+  KeyValue keyValue;
+  unsigned int node;
+} KeyBindingEdge;
+
+typedef struct {
+  KeyValue keyValue;
+  const KeyBinding *binding;
+} ImmediateKeyBinding;
+
+typedef struct {
+  const KeyBinding *binding;
+
+  unsigned int firstEdge;
+  unsigned int edgeCount;
+
+  unsigned int firstImmediate;
+  unsigned int immediateCount;
+
+  unsigned char anyKeyDepth;
+} KeyBindingNode;
+
 typedef struct {
   wchar_t *name;
   wchar_t *title;
@@ -104,6 +126,17 @@ typedef struct {
     unsigned int count;
   } keyBindings;
 
+  struct {
+    KeyBindingNode *nodes;
+    unsigned int nodeCount;
+
+    KeyBindingEdge *edges;
+    unsigned int edgeCount;
+
+    ImmediateKeyBinding *immediates;
+    unsigned int immediateCount;
+  } keyBindingTrie;
+
   struct {
     HotkeyEntry *table;
     unsigned int size;
@@ -192,6 +225,11 @@ extern void removeKeyValue (KeyValue *values, unsigned int *count, unsigned int
 extern int deleteKeyValue (KeyValue *values, unsigned int *count, const KeyValue *value);
 
 extern int compareKeyBindings (const KeyBinding *binding1, const KeyBinding *binding2);
+
+extern const KeyBinding *findContextKeyBinding (
+  const KeyContext *ctx, const KeyValue *keys, unsigned int count,
+  const KeyValue *immediate, int *isIncomplete
+);
 extern int compareHotkeyEntries (const HotkeyEntry *hotkey1, const HotkeyEntry *hotkey2);
 extern int compareMappedKeyEntries (const MappedKeyEntry *map1, const MappedKeyEntry *map2);
 
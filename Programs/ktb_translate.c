@@ -87,78 +87,160 @@ setKeyAutoreleaseTime (KeyTable *table, unsigned char setting) {
 }
 
 static int
-sortModifierKeys (const void *element1, const void *element2) {
-  const KeyValue *modifier1 = element1;
-  const KeyValue *modifier2 = element2;
-  return compareKeyValues(modifier1, modifier2);
+searchKeyBindingEdge (const void *target, const void *element) {
+  const KeyValue *reference = target;
+  const KeyBindingEdge *edge = element;
+  return compareKeyValues(reference, &edge->keyValue);
+}
+
+static const KeyBindingNode *
+getKeyBindingChild (const KeyContext *ctx, const KeyBindingNode *node, const KeyValue *keyValue) {
+  const KeyBindingEdge *edge = bsearch(keyValue, &ctx->keyBindingTrie.edges[node->firstEdge],
+                                       node->edgeCount, sizeof(*edge),
+                                       searchKeyBindingEdge);
+
+  if (!edge) return NULL;
+  return &ctx->keyBindingTrie.nodes[edge->node];
 }
 
 static int
-searchKeyBinding (const void *target, const void *element) {
-  const KeyBinding *reference = target;
-  const KeyBinding *binding = element;
-  return compareKeyBindings(reference, binding);
+searchImmediateKeyBinding (const void *target, const void *element) {
+  const KeyValue *reference = target;
+  const ImmediateKeyBinding *ikb = element;
+  return compareKeyValues(reference, &ikb->keyValue);
 }
 
 static const KeyBinding *
-findKeyBinding (KeyTable *table, unsigned char context, const KeyValue *immediate, int *isIncomplete) {
-  const KeyContext *ctx = getKeyContext(table, context);
-
-  if (!ctx) return NULL;
-  if (!ctx->keyBindings.table) return NULL;
-  if (table->pressedKeys.count > MAX_MODIFIERS_PER_COMBINATION) return NULL;
+getImmediateKeyBinding (const KeyContext *ctx, const KeyBindingNode *node, const KeyValue *keyValue) {
+  const ImmediateKeyBinding *ikb = bsearch(keyValue, &ctx->keyBindingTrie.immediates[node->firstImmediate],
+                                           node->immediateCount, sizeof(*ikb),
+                                           searchImmediateKeyBinding);
 
-  KeyBinding target = {
-    .keyCombination.modifierCount = table->pressedKeys.count
-  };
+  if (!ikb) return NULL;
+  return ikb->binding;
+}
 
-  if (immediate) {
-    target.keyCombination.immediateKey = *immediate;
-    target.keyCombination.flags |= KCF_IMMEDIATE_KEY;
-  }
+typedef struct {
+  const KeyBinding *binding;
+  unsigned int bindingMask;
 
-  while (1) {
-    unsigned int all = (1 << table->pressedKeys.count) - 1;
+  unsigned int incompleteMask;
+  unsigned isIncomplete:1;
+} KeyBindingMatch;
 
-    for (unsigned int bits=0; bits<=all; bits+=1) {
-      {
-        unsigned int index;
-        unsigned int bit;
+typedef struct {
+  const KeyContext *ctx;
+  const KeyValue *keys;
+  unsigned int count;
+  const KeyValue *immediate;
 
-        for (index=0, bit=1; index<table->pressedKeys.count; index+=1, bit<<=1) {
-          KeyValue *modifier = &target.keyCombination.modifierKeys[index];
+  KeyBindingMatch exactImmediate;
+  KeyBindingMatch anyImmediate;
+} KeyBindingSearch;
 
-          *modifier = table->pressedKeys.table[index];
-          if (bits & bit) modifier->number = KTB_KEY_ANY;
-        }
+static void
+addKeyBindingMatch (KeyBindingMatch *match, const KeyBinding *binding, unsigned int mask) {
+  if (binding) {
+    if (binding->primaryCommand.value == EOF) {
+      if (!match->isIncomplete || (mask < match->incompleteMask)) {
+        match->incompleteMask = mask;
+        match->isIncomplete = 1;
       }
+    } else if (!match->binding || (mask < match->bindingMask)) {
+      match->binding = binding;
+      match->bindingMask = mask;
+    }
+  }
+}
 
-      qsort(
-        target.keyCombination.modifierKeys, table->pressedKeys.count,
-        sizeof(*target.keyCombination.modifierKeys), sortModifierKeys
-      );
+static void
+searchKeyBindingNode (
+  KeyBindingSearch *kbs, const KeyBindingNode *node,
+  unsigned int index, unsigned int anyKeyCount, unsigned int mask
+) {
+  if (anyKeyCount) {
+    const KeyValue *previous = &kbs->keys[index-1];
+
+    if ((index == kbs->count) || (kbs->keys[index].group != previous->group)) {
+      const KeyValue anyKey = {
+        .group = previous->group,
+        .number = KTB_KEY_ANY
+      };
+
+      do {
+        if (!(node = getKeyBindingChild(kbs->ctx, node, &anyKey))) return;
+      } while (--anyKeyCount);
+    }
+  }
 
-      {
-        const KeyBinding *binding = bsearch(&target, ctx->keyBindings.table,
-                                            ctx->keyBindings.count,
-                                            sizeof(*ctx->keyBindings.table),
-                                            searchKeyBinding);
+  if (index < kbs->count) {
+    const KeyBindingNode *child = getKeyBindingChild(kbs->ctx, node, &kbs->keys[index]);
 
-        if (binding) {
-          if (binding->primaryCommand.value != EOF) return binding;
-          *isIncomplete = 1;
-        }
-      }
+    if (child) searchKeyBindingNode(kbs, child, index+1, anyKeyCount, mask);
+
+    if (anyKeyCount < node->anyKeyDepth) {
+      searchKeyBindingNode(kbs, node, index+1, anyKeyCount+1, (mask | (1 << index)));
     }
+  } else if (kbs->immediate) {
+    addKeyBindingMatch(&kbs->exactImmediate, getImmediateKeyBinding(kbs->ctx, node, kbs->immediate), mask);
+
+    if (kbs->immediate->number != KTB_KEY_ANY) {
+      const KeyValue anyKey = {
+        .group = kbs->immediate->group,
+        .number = KTB_KEY_ANY
+      };
 
-    if (!(target.keyCombination.flags & KCF_IMMEDIATE_KEY)) break;
-    if (target.keyCombination.immediateKey.number == KTB_KEY_ANY) break;
-    target.keyCombination.immediateKey.number = KTB_KEY_ANY;
+      addKeyBindingMatch(&kbs->anyImmediate, getImmediateKeyBinding(kbs->ctx, node, &anyKey), mask);
+    }
+  } else {
+    addKeyBindingMatch(&kbs->exactImmediate, node->binding, mask);
   }
+}
 
+static const KeyBinding *
+getKeyBindingMatch (const KeyBindingMatch *match, int *isIncomplete) {
+  if (match->binding) {
+    if (match->isIncomplete && (match->incompleteMask < match->bindingMask)) *isIncomplete = 1;
+    return match->binding;
+  }
+
+  if (match->isIncomplete) *isIncomplete = 1;
   return NULL;
 }
 
+const KeyBinding *
+findContextKeyBinding (
+  const KeyContext *ctx, const KeyValue *keys, unsigned int count,
+  const KeyValue *immediate, int *isIncomplete
+) {
+  if (!ctx->keyBindingTrie.nodes) return NULL;
+  if (count > MAX_MODIFIERS_PER_COMBINATION) return NULL;
+
+  KeyBindingSearch kbs = {
+    .ctx = ctx,
+    .keys = keys,
+    .count = count,
+    .immediate = immediate
+  };
+
+  searchKeyBindingNode(&kbs, ctx->keyBindingTrie.nodes, 0, 0, 0);
+
+  {
+    const KeyBinding *binding = getKeyBindingMatch(&kbs.exactImmediate, isIncomplete);
+    if (binding) return binding;
+  }
+
+  return getKeyBindingMatch(&kbs.anyImmediate, isIncomplete);
+}
+
+static const KeyBinding *
+findKeyBinding (KeyTable *table, unsigned char context, const KeyValue *immediate, int *isIncomplete) {
+  const KeyContext *ctx = getKeyContext(table, context);
+
+  if (!ctx) return NULL;
+  return findContextKeyBinding(ctx, table->pressedKeys.table, table->pressedKeys.count, immediate, isIncomplete);
+}
+
 static int
 searchHotkeyEntry (const void *target, const void *element) {
   const HotkeyEntry *reference = target;
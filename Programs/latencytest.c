@@ -0,0 +1,655 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif /* HAVE_SYS_WAIT_H */
+
+#ifdef HAVE_SHMGET
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#endif /* HAVE_SHMGET */
+
+#include "program.h"
+#include "options.h"
+#include "log.h"
+#include "parse.h"
+#include "timing.h"
+
+static char *opt_brlttyPath;
+static char *opt_clientCommand;
+static char *opt_updateCount;
+static char *opt_keyCount;
+static char *opt_updateInterval;
+static char *opt_keyHold;
+
+BEGIN_OPTION_TABLE(programOptions)
+  { .word = "brltty",
+    .letter = 'b',
+    .argument = "path",
+    .setting.string = &opt_brlttyPath,
+    .internal.setting = "brltty",
+    .description = "Path to the brltty executable."
+  },
+
+  { .word = "client",
+    .letter = 'c',
+    .argument = "command",
+    .setting.string = &opt_clientCommand,
+    .description = "Shell command to run (e.g. a BrlAPI client) while measuring."
+  },
+
+  { .word = "updates",
+    .letter = 'u',
+    .argument = "count",
+    .setting.string = &opt_updateCount,
+    .internal.setting = "200",
+    .description = "Number of screen updates to measure."
+  },
+
+  { .word = "keys",
+    .letter = 'k',
+    .argument = "count",
+    .setting.string = &opt_keyCount,
+    .internal.setting = "100",
+    .description = "Number of key presses to measure."
+  },
+
+  { .word = "interval",
+    .letter = 'i',
+    .argument = "milliseconds",
+    .setting.string = &opt_updateInterval,
+    .internal.setting = "50",
+    .description = "Delay between measurements."
+  },
+
+  { .word = "hold",
+    .letter = 'H',
+    .argument = "milliseconds",
+    .setting.string = &opt_keyHold,
+    .internal.setting = "50",
+    .description = "How long each key is held down."
+  },
+END_OPTION_TABLE
+
+#define SCREEN_COLUMNS 80
+#define SCREEN_ROWS 25
+#define SCREEN_SEGMENT_KEY 0XBACD072F
+#define SCREEN_SEGMENT_SIZE (4 + ((66 * 132) * 2))
+
+#define DISPLAY_MODEL 0X89 /* HandyTech Modular 40+4 */
+#define DISPLAY_CELLS (4 + 40)
+#define DISPLAY_RESPONSE_TIMEOUT 2000
+#define DISPLAY_STARTUP_TIMEOUT 15000
+#define KEY_LONG_PRESS_TIME 500 /* brltty's default */
+
+#define HT_PKT_BRAILLE 0X01
+#define HT_PKT_ACK 0X7E
+#define HT_PKT_OK 0XFE
+#define HT_PKT_RESET 0XFF
+#define HT_KEY_B4 0X0F
+#define HT_KEY_B5 0X13
+#define HT_KEY_RELEASE 0X80
+
+typedef struct {
+  long int *table;
+  unsigned int size;
+  unsigned int count;
+  unsigned int timeouts;
+} LatencySamples;
+
+typedef struct {
+  int descriptor;
+  char *device;
+
+  unsigned char cells[DISPLAY_CELLS];
+  unsigned int cellCount;
+  unsigned int updateCount;
+  unsigned char receiving:1;
+  unsigned char changed:1;
+  TimeValue changeTime;
+} EmulatedDisplay;
+
+#ifdef HAVE_SHMGET
+static int screenIdentifier = -1;
+static unsigned char *screenImage = NULL;
+
+static void
+destroyScreenImage (void) {
+  if (screenImage) {
+    shmdt(screenImage);
+    screenImage = NULL;
+  }
+
+  if (screenIdentifier != -1) {
+    shmctl(screenIdentifier, IPC_RMID, NULL);
+    screenIdentifier = -1;
+  }
+}
+
+static int
+createScreenImage (void) {
+  const key_t key = SCREEN_SEGMENT_KEY;
+
+  if ((screenIdentifier = shmget(key, SCREEN_SEGMENT_SIZE, (IPC_CREAT | IPC_EXCL | S_IRWXU))) == -1) {
+    logMessage(LOG_ERR, "cannot create screen image segment 0X%" PRIkey ": %s", key, strerror(errno));
+    return 0;
+  }
+
+  if ((screenImage = shmat(screenIdentifier, NULL, 0)) == (unsigned char *)-1) {
+    logSystemError("shmat");
+    screenImage = NULL;
+    destroyScreenImage();
+    return 0;
+  }
+
+  memset(screenImage, 0, SCREEN_SEGMENT_SIZE);
+  screenImage[0] = SCREEN_COLUMNS;
+  screenImage[1] = SCREEN_ROWS;
+  screenImage[2] = 0;
+  screenImage[3] = 0;
+
+  {
+    unsigned char *text = &screenImage[4];
+    unsigned char *attributes = text + (SCREEN_COLUMNS * SCREEN_ROWS);
+
+    for (unsigned int row=0; row<SCREEN_ROWS; row+=1) {
+      char line[SCREEN_COLUMNS + 1];
+      snprintf(line, sizeof(line), "line %02u: the quick brown fox jumps over the lazy dog", row);
+      memset(&text[row * SCREEN_COLUMNS], ' ', SCREEN_COLUMNS);
+      memcpy(&text[row * SCREEN_COLUMNS], line, strlen(line));
+    }
+
+    memset(attributes, 0X07, (SCREEN_COLUMNS * SCREEN_ROWS));
+  }
+
+  return 1;
+}
+
+static void
+changeScreenImage (unsigned int update) {
+  char line[SCREEN_COLUMNS + 1];
+  int length = snprintf(line, sizeof(line), "update %u", update);
+
+  unsigned char *text = &screenImage[4];
+  memset(text, ' ', SCREEN_COLUMNS);
+  memcpy(text, line, length);
+  screenImage[2] = length;
+}
+#endif /* HAVE_SHMGET */
+
+static int
+openEmulatedDisplay (EmulatedDisplay *display) {
+  memset(display, 0, sizeof(*display));
+
+  if ((display->descriptor = posix_openpt(O_RDWR | O_NOCTTY)) != -1) {
+    if (grantpt(display->descriptor) != -1) {
+      if (unlockpt(display->descriptor) != -1) {
+        const char *name = ptsname(display->descriptor);
+
+        if (name) {
+          if ((display->device = strdup(name))) return 1;
+          logMallocError();
+        } else {
+          logSystemError("ptsname");
+        }
+      } else {
+        logSystemError("unlockpt");
+      }
+    } else {
+      logSystemError("grantpt");
+    }
+
+    close(display->descriptor);
+  } else {
+    logSystemError("posix_openpt");
+  }
+
+  return 0;
+}
+
+static void
+closeEmulatedDisplay (EmulatedDisplay *display) {
+  close(display->descriptor);
+  free(display->device);
+}
+
+static int
+writeEmulatedDisplay (EmulatedDisplay *display, const unsigned char *bytes, size_t count) {
+  if (write(display->descriptor, bytes, count) == (ssize_t)count) return 1;
+  logSystemError("pty write");
+  return 0;
+}
+
+static int
+handleDisplayByte (EmulatedDisplay *display, unsigned char byte) {
+  if (display->receiving) {
+    if (display->cells[display->cellCount] != byte) {
+      display->cells[display->cellCount] = byte;
+      display->changed = 1;
+    }
+
+    if (++display->cellCount < DISPLAY_CELLS) return 1;
+    display->receiving = 0;
+
+    {
+      static const unsigned char acknowledgement[] = {HT_PKT_ACK};
+      if (!writeEmulatedDisplay(display, acknowledgement, sizeof(acknowledgement))) return 0;
+    }
+
+    display->updateCount += 1;
+    if (display->changed) getMonotonicTime(&display->changeTime);
+    return 1;
+  }
+
+  switch (byte) {
+    case HT_PKT_RESET: {
+      static const unsigned char identity[] = {HT_PKT_OK, DISPLAY_MODEL};
+      return writeEmulatedDisplay(display, identity, sizeof(identity));
+    }
+
+    case HT_PKT_BRAILLE:
+      display->receiving = 1;
+      display->cellCount = 0;
+      display->changed = 0;
+      return 1;
+
+    default:
+      return 1;
+  }
+}
+
+static int
+awaitCellsChange (EmulatedDisplay *display, const TimeValue *start, int timeout, long int *latency) {
+  unsigned int updateCount = display->updateCount;
+
+  while (1) {
+    long int elapsed = getMonotonicElapsed(start);
+    if (elapsed >= timeout) return 0;
+
+    struct pollfd pfd = {
+      .fd = display->descriptor,
+      .events = POLLIN
+    };
+
+    int result = poll(&pfd, 1, (timeout - elapsed));
+    if (result == -1) {
+      if (errno == EINTR) continue;
+      logSystemError("poll");
+      return 0;
+    }
+    if (!result) return 0;
+
+    unsigned char buffer[0X100];
+    ssize_t count = read(display->descriptor, buffer, sizeof(buffer));
+
+    if (count <= 0) {
+      if ((count == -1) && (errno == EINTR)) continue;
+      logMessage(LOG_ERR, "emulated display closed");
+      return 0;
+    }
+
+    for (ssize_t index=0; index<count; index+=1) {
+      if (!handleDisplayByte(display, buffer[index])) return 0;
+    }
+
+    if ((display->updateCount != updateCount) && display->changed) {
+      const TimeValue *to = &display->changeTime;
+
+      *latency = ((long int)(to->seconds - start->seconds) * 1000000)
+               + ((to->nanoseconds - start->nanoseconds) / 1000);
+
+      return 1;
+    }
+  }
+}
+
+static void
+addLatencySample (LatencySamples *samples, long int latency) {
+  if (samples->count < samples->size) samples->table[samples->count++] = latency;
+}
+
+static void
+measureCellsChange (EmulatedDisplay *display, const TimeValue *start, LatencySamples *samples) {
+  long int latency;
+
+  if (!awaitCellsChange(display, start, DISPLAY_RESPONSE_TIMEOUT, &latency)) {
+    samples->timeouts += 1;
+  } else {
+    addLatencySample(samples, latency);
+  }
+}
+
+static int
+sortLatencySamples (const void *element1, const void *element2) {
+  const long int *sample1 = element1;
+  const long int *sample2 = element2;
+
+  if (*sample1 < *sample2) return -1;
+  if (*sample1 > *sample2) return 1;
+  return 0;
+}
+
+static long int
+getLatencyPercentile (const LatencySamples *samples, unsigned int percentile) {
+  unsigned int index = (samples->count * percentile) / 100;
+  if (index >= samples->count) index = samples->count - 1;
+  return samples->table[index];
+}
+
+static void
+reportLatencySamples (const char *label, LatencySamples *samples) {
+  printf("%s: %u samples, %u timeouts", label, samples->count, samples->timeouts);
+
+  if (samples->count) {
+    qsort(samples->table, samples->count, sizeof(*samples->table), sortLatencySamples);
+
+    printf(", p50 %ldus, p99 %ldus, max %ldus",
+           getLatencyPercentile(samples, 50),
+           getLatencyPercentile(samples, 99),
+           samples->table[samples->count - 1]);
+  }
+
+  printf("\n");
+}
+
+static pid_t
+startProcess (const char *const *arguments) {
+  pid_t process = fork();
+
+  if (process == -1) {
+    logSystemError("fork");
+  } else if (!process) {
+    execvp(arguments[0], (char *const *)arguments);
+    logMessage(LOG_ERR, "cannot execute %s: %s", arguments[0], strerror(errno));
+    _exit(127);
+  }
+
+  return process;
+}
+
+static void
+stopProcess (pid_t process, struct rusage *usage) {
+  kill(process, SIGTERM);
+
+  while (wait4(process, NULL, 0, usage) == -1) {
+    if (errno != EINTR) {
+      logSystemError("wait4");
+      memset(usage, 0, sizeof(*usage));
+      break;
+    }
+  }
+}
+
+static long int
+getProcessorTime (const struct rusage *usage) {
+  return ((usage->ru_utime.tv_sec + usage->ru_stime.tv_sec) * 1000000)
+       + usage->ru_utime.tv_usec + usage->ru_stime.tv_usec;
+}
+
+static int
+validateCount (unsigned int *count, const char *string, const char *name) {
+  int value;
+  static const int minimum = 0;
+
+  if (!validateInteger(&value, string, &minimum, NULL)) {
+    logMessage(LOG_ERR, "invalid %s: %s", name, string);
+    return 0;
+  }
+
+  *count = value;
+  return 1;
+}
+
+static ProgramExitStatus
+measureKeyLatency (
+  EmulatedDisplay *display, unsigned char number, unsigned int hold,
+  LatencySamples *pressSamples, LatencySamples *releaseSamples
+) {
+  const unsigned char press[] = {number};
+  const unsigned char release[] = {(number | HT_KEY_RELEASE)};
+
+  TimeValue pressTime;
+  TimeValue releaseTime;
+  long int latency;
+
+  // The press and the release are written separately because the command
+  // is executed when the key is released. If both arrive together then the
+  // release isn't seen until the long press timer fires, and every sample
+  // is that timer rather than brltty's latency.
+  getMonotonicTime(&pressTime);
+  if (!writeEmulatedDisplay(display, press, sizeof(press))) return PROG_EXIT_FATAL;
+
+  // A command which is executed by the press itself shows up while the key
+  // is still being held.
+  if (awaitCellsChange(display, &pressTime, hold, &latency)) {
+    addLatencySample(pressSamples, latency);
+    if (!writeEmulatedDisplay(display, release, sizeof(release))) return PROG_EXIT_FATAL;
+    return PROG_EXIT_SUCCESS;
+  }
+
+  getMonotonicTime(&releaseTime);
+  if (!writeEmulatedDisplay(display, release, sizeof(release))) return PROG_EXIT_FATAL;
+  measureCellsChange(display, &releaseTime, releaseSamples);
+
+  return PROG_EXIT_SUCCESS;
+}
+
+static ProgramExitStatus
+measureLatency (
+  EmulatedDisplay *display,
+  unsigned int updateCount, unsigned int keyCount,
+  unsigned int interval, unsigned int hold,
+  LatencySamples *screenSamples,
+  LatencySamples *pressSamples, LatencySamples *releaseSamples
+) {
+  {
+    TimeValue start;
+    long int latency;
+
+    getMonotonicTime(&start);
+
+    if (!awaitCellsChange(display, &start, DISPLAY_STARTUP_TIMEOUT, &latency)) {
+      logMessage(LOG_ERR, "braille display not written");
+      return PROG_EXIT_FATAL;
+    }
+  }
+
+  for (unsigned int update=1; update<=updateCount; update+=1) {
+    TimeValue start;
+
+    approximateDelay(interval);
+    getMonotonicTime(&start);
+    changeScreenImage(update);
+    measureCellsChange(display, &start, screenSamples);
+  }
+
+  for (unsigned int key=0; key<keyCount; key+=1) {
+    const unsigned char number = (key % 2)? HT_KEY_B4: HT_KEY_B5;
+
+    approximateDelay(interval);
+
+    ProgramExitStatus exitStatus = measureKeyLatency(display, number, hold, pressSamples, releaseSamples);
+    if (exitStatus != PROG_EXIT_SUCCESS) return exitStatus;
+  }
+
+  return PROG_EXIT_SUCCESS;
+}
+
+static int
+checkKeyLatency (const LatencySamples *samples, unsigned int hold) {
+  // The key was released after a known delay (the hold), and that's well
+  // short of the long press time, so a change which is only seen after the
+  // long press time hasn't been caused by the release.
+  unsigned int late = 0;
+
+  for (unsigned int index=0; index<samples->count; index+=1) {
+    if ((samples->table[index] / 1000) >= (KEY_LONG_PRESS_TIME - hold)) late += 1;
+  }
+
+  if (late) {
+    logMessage(LOG_WARNING,
+      "%u key release(s) not seen before the long press time", late
+    );
+
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main (int argc, char *argv[]) {
+  ProgramExitStatus exitStatus = PROG_EXIT_FATAL;
+
+  {
+    static const OptionsDescriptor descriptor = {
+      OPTION_TABLE(programOptions),
+      .applicationName = "latencytest",
+      .argumentsSummary = "[brltty-option ...]"
+    };
+    PROCESS_OPTIONS(descriptor, argc, argv);
+  }
+
+#if defined(HAVE_SHMGET) && defined(HAVE_SYS_WAIT_H)
+  unsigned int updateCount;
+  unsigned int keyCount;
+  unsigned int interval;
+
+  if (!validateCount(&updateCount, opt_updateCount, "update count")) return PROG_EXIT_SYNTAX;
+  if (!validateCount(&keyCount, opt_keyCount, "key count")) return PROG_EXIT_SYNTAX;
+  if (!validateCount(&interval, opt_updateInterval, "interval")) return PROG_EXIT_SYNTAX;
+
+  unsigned int hold;
+  if (!validateCount(&hold, opt_keyHold, "key hold time")) return PROG_EXIT_SYNTAX;
+
+  if (hold >= (KEY_LONG_PRESS_TIME / 2)) {
+    logMessage(LOG_ERR, "key hold time too close to the long press time: %u", hold);
+    return PROG_EXIT_SYNTAX;
+  }
+
+  long int screenTable[updateCount + 1];
+  long int pressTable[keyCount + 1];
+  long int releaseTable[keyCount + 1];
+
+  LatencySamples screenSamples = {
+    .table = screenTable,
+    .size = updateCount
+  };
+
+  LatencySamples pressSamples = {
+    .table = pressTable,
+    .size = keyCount
+  };
+
+  LatencySamples releaseSamples = {
+    .table = releaseTable,
+    .size = keyCount
+  };
+
+  if (createScreenImage()) {
+    EmulatedDisplay display;
+
+    if (openEmulatedDisplay(&display)) {
+      char device[strlen(display.device) + 8];
+      snprintf(device, sizeof(device), "serial:%s", display.device);
+
+      const char *arguments[argc + 14];
+      const char **argument = arguments;
+
+      *argument++ = opt_brlttyPath;
+      *argument++ = "-n";
+      *argument++ = "-f";
+      *argument++ = "/dev/null";
+      *argument++ = "-b";
+      *argument++ = "ht";
+      *argument++ = "-d";
+      *argument++ = device;
+      *argument++ = "-x";
+      *argument++ = "sc";
+
+      // nothing but the measured input may change the cells
+      *argument++ = "-o";
+      *argument++ = "blinking-screen-cursor=no,blinking-attributes=no,blinking-capitals=no";
+
+      while (argc) *argument++ = (argc--, *argv++);
+      *argument = NULL;
+
+      pid_t brltty = startProcess(arguments);
+
+      if (brltty != -1) {
+        pid_t client = -1;
+
+        if (*opt_clientCommand) {
+          const char *const clientArguments[] = {"/bin/sh", "-c", opt_clientCommand, NULL};
+          client = startProcess(clientArguments);
+        }
+
+        exitStatus = measureLatency(
+          &display, updateCount, keyCount, interval, hold,
+          &screenSamples, &pressSamples, &releaseSamples
+        );
+
+        if (client != -1) {
+          struct rusage usage;
+          stopProcess(client, &usage);
+        }
+
+        {
+          struct rusage usage;
+          stopProcess(brltty, &usage);
+
+          if (exitStatus == PROG_EXIT_SUCCESS) {
+            long int time = getProcessorTime(&usage);
+
+            reportLatencySamples("screen change to cells", &screenSamples);
+            reportLatencySamples("key press to cells", &pressSamples);
+            reportLatencySamples("key release to cells", &releaseSamples);
+            if (!checkKeyLatency(&releaseSamples, hold)) exitStatus = PROG_EXIT_SEMANTIC;
+
+            printf("brltty: %ldus processor time, %u display writes",
+                   time, display.updateCount);
+            if (display.updateCount) printf(", %ldus per write", (time / display.updateCount));
+            printf("\n");
+          }
+        }
+      }
+
+      closeEmulatedDisplay(&display);
+    }
+
+    destroyScreenImage();
+  }
+#else /* shared memory and process control */
+  logMessage(LOG_ERR, "latency testing isn't supported on this platform");
+#endif /* shared memory and process control */
+
+  return exitStatus;
+}
@@ -42,17 +42,26 @@ extern "C" {
 #define SPEECH_DRIVER_THREAD_STOP_TIMEOUT 5000
 
 #define SPEECH_RESPONSE_WAIT_TIMEOUT 5000
+#define SPEECH_REQUEST_BATCH_LIMIT 80
 
 #define SCREEN_DRIVER_START_RETRY_INTERVAL 5000
 #define SCREEN_FREEZE_REMINDER_INTERVAL 30000
 #define SCREEN_UPDATE_POLL_INTERVAL 40
 #define SCREEN_UPDATE_SCHEDULE_DELAY 5
+#define SCREEN_HISTORY_SIZE 1000
+#define SCREEN_HISTORY_SCROLL_OVERLAP 2
 
 #define KEYBOARD_MONITOR_START_RETRY_INTERVAL 5000
 
 #define PID_FILE_CREATE_RETRY_INTERVAL 5000
 
 #define UPDATE_SCHEDULE_DELAY 15
+#define UPDATE_BACKGROUND_DELAY_LIMIT 250
+
+#define EXTERNAL_CONTRACTION_HELPER_LIMIT 3
+#define EXTERNAL_CONTRACTION_RESULT_LIMIT 0X20
+#define EXTERNAL_CONTRACTION_RESPONSE_WAIT 50
+#define EXTERNAL_CONTRACTION_RESPONSE_TIMEOUT 5000
 
 #define ROUTING_PROCESS_NICENESS 10
 #define ROUTING_POLL_INTERVAL 1
@@ -84,6 +93,7 @@ extern "C" {
 #define BLUETOOTH_CHANNEL_BUSY_RETRY_TIMEOUT 2000
 #define BLUETOOTH_CHANNEL_BUSY_RETRY_INTERVAL 100
 #define BLUETOOTH_CHANNEL_CONNECT_TIMEOUT 15000
+#define BLUETOOTH_DEVICE_NAME_REFRESH_AGE (24 * 60 * 60)
 
 #define LINUX_INPUT_DEVICE_OPEN_DELAY 1000
 #define LINUX_USB_INPUT_PIPE_DISABLE 0
@@ -127,7 +127,7 @@ static const CursorAxisEntry cursorAxisTable[] = {
 static int
 readRow (CursorRoutingData *crd, ScreenCharacter *buffer, int row) {
   if (!buffer) buffer = crd->vertical.buffer;
-  if (readScreenRow(row, crd->screen.width, buffer)) return 1;
+  if (readScreenDirectly(0, row, crd->screen.width, 1, buffer)) return 1;
   logRouting("read failed: row=%d", row);
   return 0;
 }
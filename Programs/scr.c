@@ -36,6 +36,128 @@
 MainScreen mainScreen;
 BaseScreen *currentScreen = NULL;
 
+typedef struct {
+  BaseScreen *screen;
+  unsigned long generation;
+  unsigned long geometryGeneration;
+
+  int columns;
+  int rows;
+
+  ScreenCharacter *characters;
+  unsigned long *rowGenerations;
+  ScreenRowSummary *rowSummaries;
+  size_t size;
+  int rowCapacity;
+
+  ScreenSnapshotStatistics statistics;
+} ScreenSnapshot;
+
+static ScreenSnapshot screenSnapshot = {
+  .generation = 1,
+  .statistics.generation = 1
+};
+
+static void
+invalidateScreenSnapshot (void) {
+  ScreenSnapshot *snapshot = &screenSnapshot;
+
+  snapshot->generation += 1;
+  snapshot->statistics.generation = snapshot->generation;
+  snapshot->statistics.hits = 0;
+  snapshot->statistics.misses = 0;
+}
+
+static void
+releaseScreenSnapshot (void) {
+  ScreenSnapshot *snapshot = &screenSnapshot;
+
+  if (snapshot->characters) {
+    free(snapshot->characters);
+    snapshot->characters = NULL;
+  }
+
+  if (snapshot->rowGenerations) {
+    free(snapshot->rowGenerations);
+    snapshot->rowGenerations = NULL;
+  }
+
+  if (snapshot->rowSummaries) {
+    free(snapshot->rowSummaries);
+    snapshot->rowSummaries = NULL;
+  }
+
+  snapshot->size = 0;
+  snapshot->rowCapacity = 0;
+  snapshot->columns = 0;
+  snapshot->rows = 0;
+  snapshot->screen = NULL;
+  invalidateScreenSnapshot();
+}
+
+static int
+setScreenSnapshotGeometry (int columns, int rows) {
+  ScreenSnapshot *snapshot = &screenSnapshot;
+
+  if ((columns != snapshot->columns) || (rows != snapshot->rows)) {
+    size_t size = columns * rows;
+
+    if (size > snapshot->size) {
+      ScreenCharacter *characters = realloc(snapshot->characters, ARRAY_SIZE(characters, size));
+      if (!characters) goto error;
+      snapshot->characters = characters;
+      snapshot->size = size;
+    }
+
+    /* fewer cells can still mean more rows (e.g. 80x25 to 40x50) */
+    if (rows > snapshot->rowCapacity) {
+      unsigned long *generations = realloc(snapshot->rowGenerations, ARRAY_SIZE(generations, rows));
+      if (!generations) goto error;
+      snapshot->rowGenerations = generations;
+
+      ScreenRowSummary *summaries = realloc(snapshot->rowSummaries, ARRAY_SIZE(summaries, rows));
+      if (!summaries) goto error;
+      snapshot->rowSummaries = summaries;
+
+      snapshot->rowCapacity = rows;
+    }
+
+    snapshot->columns = columns;
+    snapshot->rows = rows;
+    snapshot->screen = NULL;
+  }
+
+  /* rows read from another screen (e.g. frozen or help) are not reusable */
+  if ((snapshot->screen != currentScreen) && rows) {
+    memset(snapshot->rowGenerations, 0, ARRAY_SIZE(snapshot->rowGenerations, rows));
+  }
+
+  snapshot->screen = currentScreen;
+  snapshot->geometryGeneration = snapshot->generation;
+  return 1;
+
+error:
+  logMallocError();
+  releaseScreenSnapshot();
+  return 0;
+}
+
+static int
+prepareScreenSnapshot (void) {
+  ScreenSnapshot *snapshot = &screenSnapshot;
+
+  if (snapshot->screen == currentScreen) {
+    if (snapshot->geometryGeneration == snapshot->generation) {
+      return 1;
+    }
+  }
+
+  ScreenDescription description;
+  describeBaseScreen(currentScreen, &description);
+  if (description.unreadable) return 0;
+  return setScreenSnapshotGeometry(description.cols, description.rows);
+}
+
 int
 isMainScreen (void) {
   return currentScreen == &mainScreen.base;
@@ -81,6 +203,7 @@ void
 destructScreenDriver (void) {
   mainScreen.destruct();
   mainScreen.releaseParameters();
+  releaseScreenSnapshot();
 }
 
 
@@ -91,6 +214,7 @@ pollScreen (void) {
 
 int
 refreshScreen (void) {
+  invalidateScreenSnapshot();
   return currentScreen->refresh();
 }
 
@@ -98,21 +222,16 @@ void
 describeScreen (ScreenDescription *description) {
   describeBaseScreen(currentScreen, description);
   if (description->unreadable) description->quality = SCQ_NONE;
-}
 
-int
-readScreen (short left, short top, short width, short height, ScreenCharacter *buffer) {
-  const ScreenBox box = {
-    .left = left,
-    .top = top,
-    .width = width,
-    .height = height,
-  };
-
-  if (!currentScreen->readCharacters(&box, buffer)) return 0;
+  if (!description->unreadable) {
+    setScreenSnapshotGeometry(description->cols, description->rows);
+  }
+}
 
+static void
+validateScreenCharacters (const ScreenBox *box, ScreenCharacter *buffer) {
   ScreenCharacter *character = buffer;
-  const ScreenCharacter *end = character + (box.width * box.height);
+  const ScreenCharacter *end = character + (box->width * box->height);
 
   while (character < end) {
     wchar_t *text = &character->text;
@@ -121,8 +240,8 @@ readScreen (short left, short top, short width, short height, ScreenCharacter *b
       // This is not a valid Unicode character - return the replacement character.
 
       size_t index = character - buffer;
-      unsigned int column = box.left + (index % box.width);
-      unsigned int row = box.top + (index / box.width);
+      unsigned int column = box->left + (index % box->width);
+      unsigned int row = box->top + (index / box->width);
 
       logMessage(LOG_ERR,
         "invalid character U+%04lX on screen at [%u,%u]",
@@ -134,10 +253,126 @@ readScreen (short left, short top, short width, short height, ScreenCharacter *b
 
     character += 1;
   }
+}
+
+int
+readScreenDirectly (short left, short top, short width, short height, ScreenCharacter *buffer) {
+  const ScreenBox box = {
+    .left = left,
+    .top = top,
+    .width = width,
+    .height = height,
+  };
+
+  if (!currentScreen->readCharacters(&box, buffer)) return 0;
+  validateScreenCharacters(&box, buffer);
+  return 1;
+}
+
+#define SCREEN_ROW_HASH_BASIS 0X811C9DC5
+#define SCREEN_ROW_HASH_PRIME 0X01000193
+
+static inline uint32_t
+addScreenRowHash (uint32_t hash, uint32_t value) {
+  return (hash ^ value) * SCREEN_ROW_HASH_PRIME;
+}
+
+static void
+summarizeScreenRow (ScreenRowSummary *summary, const ScreenCharacter *characters, int count, unsigned long generation) {
+  uint32_t text = SCREEN_ROW_HASH_BASIS;
+  uint32_t attributes = SCREEN_ROW_HASH_BASIS;
+  uint32_t both = SCREEN_ROW_HASH_BASIS;
+  int isBlank = 1;
+
+  const ScreenCharacter *character = characters;
+  const ScreenCharacter *end = character + count;
+
+  while (character < end) {
+    text = addScreenRowHash(text, character->text);
+    attributes = addScreenRowHash(attributes, character->attributes);
+    both = addScreenRowHash(both, ((uint32_t)character->text << 8) ^ character->attributes);
+    if (character->text != WC_C(' ')) isBlank = 0;
+    character += 1;
+  }
+
+  summary->textHash = text;
+  summary->attributesHash = attributes;
+  summary->characterHash = both;
+  summary->generation = generation;
+  summary->isBlank = isBlank;
+}
+
+static int
+loadScreenRow (int row) {
+  ScreenSnapshot *snapshot = &screenSnapshot;
+
+  if (!prepareScreenSnapshot()) return 0;
+  if ((row < 0) || (row >= snapshot->rows)) return 0;
+  unsigned long *generation = &snapshot->rowGenerations[row];
+
+  if (*generation == snapshot->generation) {
+    snapshot->statistics.hits += 1;
+  } else {
+    ScreenCharacter *characters = &snapshot->characters[row * snapshot->columns];
+    ScreenCharacter buffer[snapshot->columns];
+
+    snapshot->statistics.misses += 1;
+    if (!readScreenDirectly(0, row, snapshot->columns, 1, buffer)) return 0;
+
+    /* a row which has been read before (its generation isn't zero) and
+     * hasn't changed since then keeps its summary */
+    if (!*generation || (memcmp(characters, buffer, sizeof(buffer)) != 0)) {
+      memcpy(characters, buffer, sizeof(buffer));
+      summarizeScreenRow(&snapshot->rowSummaries[row], characters, snapshot->columns, snapshot->generation);
+    }
+
+    *generation = snapshot->generation;
+  }
 
   return 1;
 }
 
+const ScreenCharacter *
+getScreenRowCharacters (int row) {
+  if (!loadScreenRow(row)) return NULL;
+  return &screenSnapshot.characters[row * screenSnapshot.columns];
+}
+
+const ScreenRowSummary *
+getScreenRowSummary (int row) {
+  if (!loadScreenRow(row)) return NULL;
+  return &screenSnapshot.rowSummaries[row];
+}
+
+void
+getScreenSnapshotStatistics (ScreenSnapshotStatistics *statistics) {
+  *statistics = screenSnapshot.statistics;
+}
+
+int
+readScreen (short left, short top, short width, short height, ScreenCharacter *buffer) {
+  if (prepareScreenSnapshot()) {
+    const ScreenSnapshot *snapshot = &screenSnapshot;
+
+    if ((left >= 0) && (width > 0) && ((left + width) <= snapshot->columns) &&
+        (top >= 0) && (height > 0) && ((top + height) <= snapshot->rows)) {
+      ScreenCharacter *target = buffer;
+
+      for (int row=top; row<(top+height); row+=1) {
+        const ScreenCharacter *characters = getScreenRowCharacters(row);
+        if (!characters) return 0;
+
+        memcpy(target, &characters[left], ARRAY_SIZE(target, width));
+        target += width;
+      }
+
+      return 1;
+    }
+  }
+
+  return readScreenDirectly(left, top, width, height, buffer);
+}
+
 int
 readScreenText (short left, short top, short width, short height, wchar_t *buffer) {
   unsigned int count = width * height;
@@ -247,6 +482,7 @@ constructRoutingScreen (void) {
    * in the main thread.  So we close and reopen the device.
    */
   mainScreen.destruct();
+  releaseScreenSnapshot();
   return mainScreen.construct();
 }
 
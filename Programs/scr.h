@@ -35,6 +35,31 @@ extern int refreshScreen (void);
 extern void describeScreen (ScreenDescription *);		/* get screen status */
 extern int readScreen (short left, short top, short width, short height, ScreenCharacter *buffer);
 extern int readScreenText (short left, short top, short width, short height, wchar_t *buffer);
+extern int readScreenDirectly (short left, short top, short width, short height, ScreenCharacter *buffer);
+
+/* The rows of the current screen are cached until the next refresh.
+ * The returned characters are owned by the cache and must not be modified.
+ */
+extern const ScreenCharacter *getScreenRowCharacters (int row);
+
+typedef struct {
+  uint32_t textHash;
+  uint32_t attributesHash;
+  uint32_t characterHash;
+  unsigned long generation; /* when the row's content last changed */
+  unsigned isBlank:1;
+} ScreenRowSummary;
+
+/* Equal hashes don't guarantee equal rows - confirm with a full comparison. */
+extern const ScreenRowSummary *getScreenRowSummary (int row);
+
+typedef struct {
+  unsigned long generation;
+  unsigned int hits;
+  unsigned int misses;
+} ScreenSnapshotStatistics;
+
+extern void getScreenSnapshotStatistics (ScreenSnapshotStatistics *statistics);
 extern int insertScreenKey (ScreenKey key);
 extern int routeScreenCursor (int column, int row, int screen);
 extern int highlightScreenRegion (int left, int right, int top, int bottom);
@@ -64,7 +89,8 @@ readScreenRow (int row, int width, ScreenCharacter *buffer) {
 /* Routines which apply to the routing screen.
  * An extra `thread' for the cursor routing subprocess.
  * This is needed because the forked subprocess shares its parent's
- * file descriptors.  A readScreen equivalent is not needed.
+ * file descriptors.  A readScreen equivalent is not needed,
+ * although readScreenDirectly must be used since the screen isn't refreshed.
  */
 extern int constructRoutingScreen (void);
 extern void destructRoutingScreen (void);
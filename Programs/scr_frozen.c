@@ -28,9 +28,11 @@
 #include "alert.h"
 #include "scr.h"
 #include "scr_frozen.h"
+#include "scr_history.h"
 
 static ScreenDescription screenDescription;
 static ScreenCharacter *screenCharacters;
+static unsigned int historySize;
 
 static int startFreezeReminderAlarm (void);
 static AsyncHandle freezeReminderAlarm = NULL;
@@ -63,13 +65,27 @@ static int
 construct_FrozenScreen (BaseScreen *source) {
   describeBaseScreen(source, &screenDescription);
 
-  if ((screenCharacters = calloc(screenDescription.rows*screenDescription.cols, sizeof(*screenCharacters)))) {
+  historySize = 0;
+  if (!screenDescription.unreadable) {
+    if (screenDescription.number == getScreenHistoryNumber()) {
+      historySize = getScreenHistorySize();
+    }
+  }
+
+  if ((screenCharacters = calloc((historySize+screenDescription.rows)*screenDescription.cols, sizeof(*screenCharacters)))) {
     const ScreenBox box = {
       .left=0, .width=screenDescription.cols,
       .top=0, .height=screenDescription.rows
     };
 
-    if (source->readCharacters(&box, screenCharacters)) {
+    for (unsigned int row=0; row<historySize; row+=1) {
+      readScreenHistoryRow(row, &screenCharacters[row * screenDescription.cols], screenDescription.cols);
+    }
+
+    if (source->readCharacters(&box, &screenCharacters[historySize * screenDescription.cols])) {
+      screenDescription.rows += historySize;
+      screenDescription.posy += historySize;
+
       startFreezeReminderAlarm();
       return 1;
     }
@@ -91,6 +107,13 @@ destruct_FrozenScreen (void) {
     free(screenCharacters);
     screenCharacters = NULL;
   }
+
+  historySize = 0;
+}
+
+static unsigned int
+getHistorySize_FrozenScreen (void) {
+  return historySize;
 }
 
 static void
@@ -125,5 +148,7 @@ initializeFrozenScreen (FrozenScreen *frozen) {
   frozen->base.currentVirtualTerminal = currentVirtualTerminal_FrozenScreen;
   frozen->construct = construct_FrozenScreen;
   frozen->destruct = destruct_FrozenScreen;
+  frozen->getHistorySize = getHistorySize_FrozenScreen;
   screenCharacters = NULL;
+  historySize = 0;
 }
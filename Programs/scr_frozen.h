@@ -29,6 +29,7 @@ typedef struct {
   BaseScreen base;
   int (*construct) (BaseScreen *);		/* called every time the screen is frozen */
   void (*destruct) (void);		/* called to discard frozen screen image */
+  unsigned int (*getHistorySize) (void);		/* number of scrolled off rows above the screen image */
 } FrozenScreen;
 
 extern void initializeFrozenScreen (FrozenScreen *frozen);
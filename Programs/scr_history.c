@@ -0,0 +1,417 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+#include "prologue.h"
+
+#include <string.h>
+
+#include "log.h"
+#include "parameters.h"
+#include "scr.h"
+#include "scr_history.h"
+
+typedef struct {
+  unsigned int count;
+  ScreenAttributes attributes;
+} HistoryAttributesRun;
+
+typedef struct {
+  unsigned int width;
+  unsigned int textLength;
+  unsigned int runCount;
+  HistoryAttributesRun runs[];
+} HistoryRow;
+
+static inline wchar_t *
+getHistoryRowText (HistoryRow *row) {
+  return (wchar_t *)&row->runs[row->runCount];
+}
+
+static struct {
+  HistoryRow *rows[SCREEN_HISTORY_SIZE];
+  unsigned int first;
+  unsigned int count;
+  int number;
+} history = {
+  .number = -1
+};
+
+static struct {
+  int number;
+  int columns;
+  int rows;
+
+  ScreenCharacter *characters;
+  uint32_t *hashes;
+  unsigned long *generations;
+  unsigned int origin;
+} frame = {
+  .number = -1
+};
+
+static HistoryRow *
+newHistoryRow (const ScreenCharacter *characters, unsigned int width) {
+  unsigned int textLength = width;
+  unsigned int runCount = 0;
+
+  while (textLength > 0) {
+    if (characters[textLength-1].text != WC_C(' ')) break;
+    textLength -= 1;
+  }
+
+  for (unsigned int index=0; index<width; index+=1) {
+    if (!index || (characters[index].attributes != characters[index-1].attributes)) {
+      runCount += 1;
+    }
+  }
+
+  HistoryRow *row;
+  size_t size = sizeof(*row);
+  size += ARRAY_SIZE(row->runs, runCount);
+  size += textLength * sizeof(wchar_t);
+
+  if (!(row = malloc(size))) {
+    logMallocError();
+    return NULL;
+  }
+
+  row->width = width;
+  row->textLength = textLength;
+  row->runCount = runCount;
+
+  {
+    HistoryAttributesRun *run = row->runs - 1;
+
+    for (unsigned int index=0; index<width; index+=1) {
+      ScreenAttributes attributes = characters[index].attributes;
+
+      if (!index || (attributes != run->attributes)) {
+        run += 1;
+        run->attributes = attributes;
+        run->count = 0;
+      }
+
+      run->count += 1;
+    }
+  }
+
+  {
+    wchar_t *text = getHistoryRowText(row);
+
+    for (unsigned int index=0; index<textLength; index+=1) {
+      text[index] = characters[index].text;
+    }
+  }
+
+  return row;
+}
+
+static HistoryRow **
+getHistoryRowSlot (unsigned int row) {
+  return &history.rows[(history.first + row) % SCREEN_HISTORY_SIZE];
+}
+
+static void
+pushHistoryRow (const ScreenCharacter *characters, unsigned int width) {
+  HistoryRow *row = newHistoryRow(characters, width);
+
+  if (row) {
+    if (history.count == SCREEN_HISTORY_SIZE) {
+      HistoryRow **oldest = getHistoryRowSlot(0);
+
+      free(*oldest);
+      *oldest = NULL;
+
+      history.first = (history.first + 1) % SCREEN_HISTORY_SIZE;
+      history.count -= 1;
+    }
+
+    *getHistoryRowSlot(history.count) = row;
+    history.count += 1;
+  }
+}
+
+void
+resetScreenHistory (void) {
+  while (history.count > 0) {
+    HistoryRow **slot = getHistoryRowSlot(--history.count);
+
+    free(*slot);
+    *slot = NULL;
+  }
+
+  history.first = 0;
+  history.number = -1;
+}
+
+unsigned int
+getScreenHistorySize (void) {
+  return history.count;
+}
+
+int
+getScreenHistoryNumber (void) {
+  return history.number;
+}
+
+int
+readScreenHistoryRow (unsigned int index, ScreenCharacter *buffer, unsigned int width) {
+  if (index >= history.count) return 0;
+  HistoryRow *row = *getHistoryRowSlot(index);
+
+  {
+    const wchar_t *text = getHistoryRowText(row);
+    unsigned int count = MIN(width, row->textLength);
+
+    for (unsigned int column=0; column<count; column+=1) {
+      buffer[column].text = text[column];
+    }
+
+    for (unsigned int column=count; column<width; column+=1) {
+      buffer[column].text = WC_C(' ');
+    }
+  }
+
+  {
+    const HistoryAttributesRun *run = row->runs;
+    const HistoryAttributesRun *end = run + row->runCount;
+    ScreenAttributes attributes = SCR_COLOUR_DEFAULT;
+    unsigned int column = 0;
+
+    while ((run < end) && (column < width)) {
+      unsigned int count = MIN(run->count, width-column);
+      attributes = run->attributes;
+
+      while (count--) buffer[column++].attributes = attributes;
+      run += 1;
+    }
+
+    while (column < width) buffer[column++].attributes = attributes;
+  }
+
+  return 1;
+}
+
+static inline unsigned int
+getFrameRowIndex (unsigned int row) {
+  return (frame.origin + row) % frame.rows;
+}
+
+static inline ScreenCharacter *
+getFrameRow (unsigned int row) {
+  return &frame.characters[getFrameRowIndex(row) * frame.columns];
+}
+
+static inline uint32_t *
+getFrameHash (unsigned int row) {
+  return &frame.hashes[getFrameRowIndex(row)];
+}
+
+static inline unsigned long *
+getFrameGeneration (unsigned int row) {
+  return &frame.generations[getFrameRowIndex(row)];
+}
+
+static void
+releaseScreenFrame (void) {
+  if (frame.characters) {
+    free(frame.characters);
+    frame.characters = NULL;
+  }
+
+  if (frame.hashes) {
+    free(frame.hashes);
+    frame.hashes = NULL;
+  }
+
+  if (frame.generations) {
+    free(frame.generations);
+    frame.generations = NULL;
+  }
+
+  frame.number = -1;
+}
+
+static int
+loadScreenFrameRow (unsigned int row, const ScreenRowSummary *summary) {
+  const ScreenCharacter *characters = getScreenRowCharacters(row);
+  if (!characters) return 0;
+
+  memcpy(getFrameRow(row), characters, ARRAY_SIZE(characters, frame.columns));
+  *getFrameHash(row) = summary->characterHash;
+  *getFrameGeneration(row) = summary->generation;
+  return 1;
+}
+
+static int
+setScreenFrame (const ScreenDescription *description) {
+  releaseScreenFrame();
+
+  size_t count = description->cols * description->rows;
+  if (!(frame.characters = malloc(ARRAY_SIZE(frame.characters, count)))) goto error;
+  if (!(frame.hashes = malloc(ARRAY_SIZE(frame.hashes, description->rows)))) goto error;
+  if (!(frame.generations = malloc(ARRAY_SIZE(frame.generations, description->rows)))) goto error;
+
+  frame.number = description->number;
+  frame.columns = description->cols;
+  frame.rows = description->rows;
+  frame.origin = 0;
+
+  for (unsigned int row=0; row<frame.rows; row+=1) {
+    const ScreenRowSummary *summary = getScreenRowSummary(row);
+    if (!summary) goto failed;
+    if (!loadScreenFrameRow(row, summary)) goto failed;
+  }
+
+  return 1;
+
+error:
+  logMallocError();
+failed:
+  releaseScreenFrame();
+  return 0;
+}
+
+static int
+isSameFrameRow (unsigned int row, unsigned int frameRow) {
+  const ScreenCharacter *characters = getScreenRowCharacters(row);
+  if (!characters) return 0;
+
+  const ScreenCharacter *character = getFrameRow(frameRow);
+  const ScreenCharacter *end = character + frame.columns;
+
+  while (character < end) {
+    if (character->text != characters->text) return 0;
+    if (character->attributes != characters->attributes) return 0;
+
+    character += 1;
+    characters += 1;
+  }
+
+  return 1;
+}
+
+static unsigned int
+findScreenScroll (const ScreenRowSummary *summaries) {
+  unsigned int rows = frame.rows;
+  unsigned int anchor = 0;
+
+  // Don't mistake a cleared screen for one that has been scrolled - the first
+  // row with text must be within the overlap, and it also quickly rules out
+  // most of the scroll amounts.
+  while (1) {
+    if (anchor == rows) return 0;
+    if (!summaries[anchor].isBlank) break;
+    anchor += 1;
+  }
+
+  for (unsigned int scroll=1; (scroll+SCREEN_HISTORY_SCROLL_OVERLAP)<rows; scroll+=1) {
+    // The last overlapping row is ignored because it may have been changed
+    // (e.g. by typing) after having been scrolled.
+    unsigned int overlap = rows - scroll - 1;
+    if (anchor >= overlap) break;
+    if (summaries[anchor].characterHash != *getFrameHash(anchor+scroll)) continue;
+
+    int isScroll = 1;
+
+    for (unsigned int row=0; row<overlap; row+=1) {
+      if (summaries[row].characterHash != *getFrameHash(row+scroll)) {
+        isScroll = 0;
+        break;
+      }
+    }
+
+    if (!isScroll) continue;
+
+    // Equal hashes don't guarantee equal rows, and the rows above the overlap
+    // mustn't be added to the history unless it really did scroll.
+    for (unsigned int row=0; row<overlap; row+=1) {
+      if (!isSameFrameRow(row, row+scroll)) {
+        isScroll = 0;
+        break;
+      }
+    }
+
+    if (!isScroll) continue;
+
+    // The overlapping rows have been confirmed so they needn't be reloaded,
+    // but the rest of them will be holding other rows once it's scrolled.
+    for (unsigned int row=0; row<rows; row+=1) {
+      unsigned long *generation = getFrameGeneration((row + scroll) % rows);
+      *generation = (row < overlap)? summaries[row].generation: 0;
+    }
+
+    return scroll;
+  }
+
+  return 0;
+}
+
+void
+updateScreenHistory (const ScreenDescription *description) {
+  if (description->unreadable) return;
+
+  if ((description->number != frame.number) ||
+      (description->cols != frame.columns) ||
+      (description->rows != frame.rows)) {
+    if (description->number != history.number) {
+      resetScreenHistory();
+      history.number = description->number;
+    }
+
+    setScreenFrame(description);
+    return;
+  }
+
+  ScreenRowSummary summaries[frame.rows];
+  int changed = 0;
+
+  for (unsigned int row=0; row<frame.rows; row+=1) {
+    const ScreenRowSummary *summary = getScreenRowSummary(row);
+
+    if (!summary) {
+      releaseScreenFrame();
+      return;
+    }
+
+    summaries[row] = *summary;
+    if (summary->generation != *getFrameGeneration(row)) changed = 1;
+  }
+
+  if (!changed) return;
+  unsigned int scroll = findScreenScroll(summaries);
+
+  if (scroll) {
+    logMessage(LOG_CATEGORY(SCREEN_DRIVER), "screen scrolled: %u", scroll);
+
+    for (unsigned int row=0; row<scroll; row+=1) {
+      pushHistoryRow(getFrameRow(row), frame.columns);
+    }
+
+    frame.origin = getFrameRowIndex(scroll);
+  }
+
+  for (unsigned int row=0; row<frame.rows; row+=1) {
+    if (summaries[row].generation != *getFrameGeneration(row)) {
+      if (!loadScreenFrameRow(row, &summaries[row])) {
+        releaseScreenFrame();
+        return;
+      }
+    }
+  }
+}
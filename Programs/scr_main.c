@@ -70,6 +70,8 @@ initializeMainScreen (MainScreen *main) {
 void
 mainScreenUpdated (void) {
   if (isMainScreen()) {
-    scheduleUpdateIn("main screen updated", SCREEN_UPDATE_SCHEDULE_DELAY);
+    schedulePriorityUpdate("main screen updated",
+                           SCREEN_UPDATE_SCHEDULE_DELAY,
+                           UPDATE_PRIORITY_BACKGROUND);
   }
 }
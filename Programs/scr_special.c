@@ -224,6 +224,11 @@ isSpecialScreen (SpecialScreenType type) {
   return currentScreen == getSpecialScreenEntry(type)->base;
 }
 
+unsigned int
+getFrozenScreenHistorySize (void) {
+  return frozenScreen.getHistorySize();
+}
+
 int
 constructHelpScreen (void) {
   SpecialScreenEntry *sse = getSpecialScreenEntry(SCR_HELP);
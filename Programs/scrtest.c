@@ -250,3 +250,7 @@ main (int argc, char *argv[]) {
 void
 scheduleUpdateIn (const char *reason, int delay) {
 }
+
+void
+schedulePriorityUpdate (const char *reason, int delay, UpdatePriority priority) {
+}
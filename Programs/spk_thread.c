@@ -24,6 +24,7 @@
 #include "parameters.h"
 #include "log.h"
 #include "strfmt.h"
+#include "timing.h"
 #include "prefs.h"
 #include "spk_thread.h"
 #include "spk.h"
@@ -78,6 +79,18 @@ typedef enum {
   RSP_INTEGER
 } SpeechResponseType;
 
+typedef struct {
+  unsigned long spoken;
+  unsigned long merged;
+  unsigned long dropped;
+
+  struct {
+    unsigned long count;
+    unsigned long total;
+    long int maximum;
+  } latency;
+} SpeechRequestStatistics;
+
 struct SpeechDriverThreadStruct {
   ThreadState threadState;
   Queue *requestQueue;
@@ -85,6 +98,8 @@ struct SpeechDriverThreadStruct {
   SpeechSynthesizer *speechSynthesizer;
   char **driverParameters;
 
+  SpeechRequestStatistics statistics;
+
 #ifdef GOT_PTHREADS
   pthread_t threadIdentifier;
   AsyncEvent *requestEvent;
@@ -123,17 +138,27 @@ static const char *const speechRequestNames[] = {
   [REQ_SET_PUNCTUATION] = "set punctuation"
 };
 
+typedef struct {
+  int screenNumber;
+  int firstLine;
+} SpeechRegion;
+
+typedef struct {
+  const unsigned char *text;
+  size_t length;
+  size_t count;
+  const unsigned char *attributes;
+  SayOptions options;
+  SpeechRegion region;
+  unsigned hasRegion:1;
+} SayTextArguments;
+
 typedef struct {
   SpeechRequestType type;
+  TimeValue enqueued;
 
   union {
-    struct {
-      const unsigned char *text;
-      size_t length;
-      size_t count;
-      const unsigned char *attributes;
-      SayOptions options;
-    } sayText;
+    SayTextArguments sayText;
 
     struct {
       unsigned char setting;
@@ -152,6 +177,7 @@ typedef struct {
     } setPunctuation;
   } arguments;
 
+  unsigned merged:1;
   unsigned char data[0];
 } SpeechRequest;
 
@@ -223,7 +249,7 @@ logSpeechAction (const LogSpeechActionData *lsa) {
 }
 
 static void
-logSpeechRequest (SpeechRequest *req, const char *action) {
+logSpeechRequest (const SpeechRequest *req, const char *action) {
   const LogSpeechActionData lsa = {
     .action = action,
     .type = "request",
@@ -589,12 +615,170 @@ muteSpeechRequestQueue (SpeechDriverThread *sdt) {
   removeSpeechRequests(sdt, REQ_MUTE_SPEECH);
 }
 
+typedef struct {
+  const SpeechRegion *region;
+} TestSpeechRegionData;
+
+static int
+testSpeechRegion (const void *item, void *data) {
+  const SpeechRequest *req = item;
+  const TestSpeechRegionData *tsr = data;
+
+  if (req->type != REQ_SAY_TEXT) return 0;
+  if (!req->arguments.sayText.hasRegion) return 0;
+
+  const SpeechRegion *region = &req->arguments.sayText.region;
+  if (region->screenNumber != tsr->region->screenNumber) return 0;
+  if (region->firstLine != tsr->region->firstLine) return 0;
+  return 1;
+}
+
+static void
+supersedeSpeechRegion (SpeechDriverThread *sdt, const SpeechRegion *region) {
+  TestSpeechRegionData tsr = {
+    .region = region
+  };
+
+  Element *element;
+
+  while ((element = findElement(sdt->requestQueue, testSpeechRegion, &tsr))) {
+    logMessage(LOG_CATEGORY(SPEECH_EVENTS),
+               "superseding say request: screen %d line %d",
+               region->screenNumber, region->firstLine);
+
+    deleteElement(element);
+  }
+}
+
+static void
+stopSpeechTracking (SpeechDriverThread *sdt) {
+  sdt->speechSynthesizer->track.isActive = 0;
+}
+
+static int
+mergeSpeechSetting (SpeechDriverThread *sdt, const SpeechRequest *req) {
+  /* only the newest request can be updated without applying the new
+   * setting to speech which was queued before it */
+  Element *element = getStackHead(sdt->requestQueue);
+  if (!element) return 0;
+
+  SpeechRequest *pending = getElementItem(element);
+  if (pending->type != req->type) return 0;
+
+  pending->arguments = req->arguments;
+  sdt->statistics.merged += 1;
+
+  logSpeechRequest(req, "merging");
+  return 1;
+}
+
+static int
+canBatchSpeechText (const SpeechRequest *req) {
+  if (req->type != REQ_SAY_TEXT) return 0;
+  if (req->arguments.sayText.options) return 0;
+  if (req->arguments.sayText.hasRegion) return 0;
+  return 1;
+}
+
+static SpeechRequest *newSpeechRequest (SpeechRequestType type, SpeechDatum *data);
+
+static SpeechRequest *
+batchSpeechText (SpeechDriverThread *sdt, SpeechRequest *req) {
+  if (!canBatchSpeechText(req)) return NULL;
+
+  Element *element = getStackHead(sdt->requestQueue);
+  if (!element) return NULL;
+
+  SpeechRequest *pending = getElementItem(element);
+  if (!canBatchSpeechText(pending)) return NULL;
+
+  const SayTextArguments *first = &pending->arguments.sayText;
+  const SayTextArguments *second = &req->arguments.sayText;
+
+  if (!first->attributes != !second->attributes) return NULL;
+  size_t count = first->count + 1 + second->count;
+  if (count > SPEECH_REQUEST_BATCH_LIMIT) return NULL;
+
+  size_t length = first->length + 1 + second->length;
+  char text[length + 1];
+  unsigned char attributes[count];
+
+  {
+    char *t = text;
+
+    t = mempcpy(t, first->text, first->length);
+    *t++ = ' ';
+    t = mempcpy(t, second->text, second->length);
+    *t = 0;
+  }
+
+  if (first->attributes) {
+    unsigned char *a = attributes;
+
+    a = mempcpy(a, first->attributes, first->count);
+    *a++ = second->count? second->attributes[0]: 0;
+    memcpy(a, second->attributes, second->count);
+  }
+
+  BEGIN_SPEECH_DATA
+    {.address=text, .size=length+1},
+    {.address=(first->attributes? attributes: NULL), .size=count},
+  END_SPEECH_DATA
+
+  SpeechRequest *batch = newSpeechRequest(REQ_SAY_TEXT, data);
+  if (!batch) return NULL;
+
+  batch->enqueued = pending->enqueued;
+  batch->arguments.sayText.text = data[0].address;
+  batch->arguments.sayText.length = length;
+  batch->arguments.sayText.count = count;
+  batch->arguments.sayText.attributes = data[1].address;
+  batch->arguments.sayText.options = 0;
+
+  pending->merged = 1;
+  deleteElement(element);
+
+  sdt->statistics.merged += 1;
+  stopSpeechTracking(sdt);
+  logSpeechRequest(req, "batching");
+  return batch;
+}
+
+static void
+logSpeechRequestStatistics (SpeechDriverThread *sdt) {
+  const SpeechRequestStatistics *stats = &sdt->statistics;
+  unsigned long count = stats->latency.count;
+
+  logMessage(LOG_CATEGORY(SPEECH_EVENTS),
+             "request statistics: Spoken:%lu Merged:%lu Dropped:%lu Latency:%lu/%ld",
+             stats->spoken, stats->merged, stats->dropped,
+             (count? (stats->latency.total / count): 0),
+             stats->latency.maximum);
+}
+
+static void
+addSpeechRequestLatency (SpeechDriverThread *sdt, const SpeechRequest *req) {
+  SpeechRequestStatistics *stats = &sdt->statistics;
+  TimeValue now;
+  getMonotonicTime(&now);
+
+  long int latency = millisecondsBetween(&req->enqueued, &now);
+  if (latency < 0) latency = 0;
+
+  stats->latency.count += 1;
+  stats->latency.total += latency;
+  if (latency > stats->latency.maximum) stats->latency.maximum = latency;
+
+  if (req->type == REQ_SAY_TEXT) stats->spoken += 1;
+}
+
 static void
 sendSpeechRequest (SpeechDriverThread *sdt) {
   while (getQueueSize(sdt->requestQueue) > 0) {
     SpeechRequest *req = dequeueItem(sdt->requestQueue);
 
     logSpeechRequest(req, "sending");
+    if (req) addSpeechRequestLatency(sdt, req);
     setResponsePending(sdt);
 
 #ifdef GOT_PTHREADS
@@ -630,6 +814,18 @@ enqueueSpeechRequest (SpeechDriverThread *sdt, SpeechRequest *req) {
   return 0;
 }
 
+static int
+enqueueSpeechSetting (SpeechDriverThread *sdt, SpeechRequest *req) {
+  if (testThreadValidity(sdt)) {
+    if (mergeSpeechSetting(sdt, req)) {
+      free(req);
+      return 1;
+    }
+  }
+
+  return enqueueSpeechRequest(sdt, req);
+}
+
 static SpeechRequest *
 newSpeechRequest (SpeechRequestType type, SpeechDatum *data) {
   SpeechRequest *req;
@@ -638,6 +834,7 @@ newSpeechRequest (SpeechRequestType type, SpeechDatum *data) {
   if ((req = malloc(size))) {
     memset(req, 0, sizeof(*req));
     req->type = type;
+    getMonotonicTime(&req->enqueued);
     moveSpeechData(req->data, data);
     return req;
   } else {
@@ -668,7 +865,31 @@ speechRequest_sayText (
     req->arguments.sayText.attributes = data[1].address;
     req->arguments.sayText.options = options;
 
-    if (options & SAY_OPT_MUTE_FIRST) muteSpeechRequestQueue(sdt);
+    if (testThreadValidity(sdt)) {
+      const SpeechSynthesizer *spk = sdt->speechSynthesizer;
+
+      if (spk->track.isActive) {
+        SpeechRegion *region = &req->arguments.sayText.region;
+
+        region->screenNumber = spk->track.screenNumber;
+        region->firstLine = spk->track.firstLine;
+        req->arguments.sayText.hasRegion = 1;
+      }
+    }
+
+    if (options & SAY_OPT_MUTE_FIRST) {
+      muteSpeechRequestQueue(sdt);
+    } else if (req->arguments.sayText.hasRegion) {
+      supersedeSpeechRegion(sdt, &req->arguments.sayText.region);
+    } else if (testThreadValidity(sdt)) {
+      SpeechRequest *batch = batchSpeechText(sdt, req);
+
+      if (batch) {
+        free(req);
+        req = batch;
+      }
+    }
+
     if (enqueueSpeechRequest(sdt, req)) return 1;
 
     free(req);
@@ -720,7 +941,7 @@ speechRequest_setVolume (
 
   if ((req = newSpeechRequest(REQ_SET_VOLUME, NULL))) {
     req->arguments.setVolume.setting = setting;
-    if (enqueueSpeechRequest(sdt, req)) return 1;
+    if (enqueueSpeechSetting(sdt, req)) return 1;
 
     free(req);
   }
@@ -737,7 +958,7 @@ speechRequest_setRate (
 
   if ((req = newSpeechRequest(REQ_SET_RATE, NULL))) {
     req->arguments.setRate.setting = setting;
-    if (enqueueSpeechRequest(sdt, req)) return 1;
+    if (enqueueSpeechSetting(sdt, req)) return 1;
 
     free(req);
   }
@@ -754,7 +975,7 @@ speechRequest_setPitch (
 
   if ((req = newSpeechRequest(REQ_SET_PITCH, NULL))) {
     req->arguments.setPitch.setting = setting;
-    if (enqueueSpeechRequest(sdt, req)) return 1;
+    if (enqueueSpeechSetting(sdt, req)) return 1;
 
     free(req);
   }
@@ -771,7 +992,7 @@ speechRequest_setPunctuation (
 
   if ((req = newSpeechRequest(REQ_SET_PUNCTUATION, NULL))) {
     req->arguments.setPunctuation.setting = setting;
-    if (enqueueSpeechRequest(sdt, req)) return 1;
+    if (enqueueSpeechSetting(sdt, req)) return 1;
 
     free(req);
   }
@@ -859,8 +1080,10 @@ THREAD_FUNCTION(runSpeechDriverThread) {
 static void
 deallocateSpeechRequest (void *item, void *data) {
   SpeechRequest *req = item;
+  SpeechDriverThread *sdt = data;
 
   logSpeechRequest(req, "unqueuing");
+  if (!req->merged) sdt->statistics.dropped += 1;
   free(req);
 }
 
@@ -880,6 +1103,7 @@ constructSpeechDriverThread (
     sdt->driverParameters = parameters;
 
     if ((sdt->requestQueue = newQueue(deallocateSpeechRequest, NULL))) {
+      setQueueData(sdt->requestQueue, sdt);
       spk->driver.thread = sdt;
 
 #ifdef GOT_PTHREADS
@@ -938,6 +1162,7 @@ destroySpeechDriverThread (SpeechSynthesizer *spk) {
   SpeechDriverThread *sdt = spk->driver.thread;
 
   deleteElements(sdt->requestQueue);
+  logSpeechRequestStatistics(sdt);
 
 #ifdef GOT_PTHREADS
   if (enqueueSpeechRequest(sdt, NULL)) {
@@ -243,7 +243,9 @@ static void
 renderStatusField_time (unsigned char *cells) {
   TimeValue value;
   getCurrentTime(&value);
-  scheduleUpdateIn("time status field", millisecondsTillNextMinute(&value));
+  schedulePriorityUpdate("time status field",
+                         millisecondsTillNextMinute(&value),
+                         UPDATE_PRIORITY_BACKGROUND);
 
   TimeComponents components;
   expandTimeValue(&value, &components);
@@ -273,3 +273,21 @@ const ContractionTableTranslationMethods *
 getContractionTableTranslationMethods_louis (void) {
   return NULL;
 }
+
+int
+prepareContractionTable (ContractionTable *table) {
+  return 1;
+}
+
+void
+releaseContractionTable (ContractionTable *table) {
+}
+
+int
+startContractionCommand (ContractionTable *table) {
+  return 0;
+}
+
+void
+stopContractionCommand (ContractionTable *table) {
+}
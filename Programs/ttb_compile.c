@@ -329,7 +329,7 @@ processTextTableLines (FILE *stream, const char *name, DataOperandsProcessor *pr
       };
 
       if (processDataStream(NULL, stream, name, &parameters)) {
-        if (finishTextTableData(ttd)) {
+        if (finishTextTableData(ttd) && compactDataArea(ttd->area)) {
           return ttd;
         }
       }
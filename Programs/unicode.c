@@ -24,6 +24,35 @@
 #include "unicode.h"
 #include "ascii.h"
 
+typedef struct {
+  signed char width;
+  unsigned char category;
+} UnicodePropertiesEntry;
+
+#include "unicode_tables.h"
+
+static inline const UnicodePropertiesEntry *
+getPropertiesEntry (wchar_t character) {
+  uint32_t index = character;
+  if (index >= UNICODE_TABLES_LIMIT) return &unicodePropertiesEntries[0];
+
+  unsigned int block = unicodePropertiesIndex[index >> UNICODE_PROPERTIES_SHIFT];
+  block <<= UNICODE_PROPERTIES_SHIFT;
+  block |= index & UNICODE_PROPERTIES_MASK;
+  return &unicodePropertiesEntries[unicodePropertiesBlocks[block]];
+}
+
+static inline uint32_t
+getAlternates (wchar_t character) {
+  uint32_t index = character;
+  if (index >= UNICODE_TABLES_LIMIT) return 0;
+
+  unsigned int block = unicodeAlternatesIndex[index >> UNICODE_ALTERNATES_SHIFT];
+  block <<= UNICODE_ALTERNATES_SHIFT;
+  block |= index & UNICODE_ALTERNATES_MASK;
+  return unicodeAlternatesBlocks[block];
+}
+
 #ifdef HAVE_ICU
 #include <unicode/uversion.h>
 #include <unicode/uchar.h>
@@ -67,10 +96,6 @@ nextBaseCharacter (const UChar **current, const UChar *end) {
 }
 #endif /* HAVE_ICU */
 
-#ifdef HAVE_ICONV_H
-#include <iconv.h>
-#endif /* HAVE_ICONV_H */
-
 int
 getCharacterName (wchar_t character, char *buffer, size_t size) {
 #ifdef HAVE_ICU
@@ -107,58 +132,14 @@ getCharacterByAlias (wchar_t *character, const char *alias) {
 #endif /* HAVE_ICU */
 }
 
+UnicodeCategory
+getCharacterCategory (wchar_t character) {
+  return getPropertiesEntry(character)->category;
+}
+
 int
 getCharacterWidth (wchar_t character) {
-#if defined(HAVE_WCWIDTH)
-  return wcwidth(character);
-#elif defined(HAVE_ICU)
-  UCharCategory category = u_getIntPropertyValue(character, UCHAR_GENERAL_CATEGORY);
-  UEastAsianWidth width = u_getIntPropertyValue(character, UCHAR_EAST_ASIAN_WIDTH);
-
-  if (character == 0) return 0;
-  if (category == U_CONTROL_CHAR) return -1;
-
-  if (category == U_NON_SPACING_MARK) return 0;
-  if (category == U_ENCLOSING_MARK) return 0;
-
-  /* Hangul Jamo medial vowels and final consonants */
-  if ((character >= 0X1160) && (character <= 0X11FF) && (category == U_OTHER_LETTER)) return 0;
-
-  /*  */
-  if (character == 0XAD) return 1; /* soft hyphen */
-  if (category == U_FORMAT_CHAR) return 0;
-
-  if (width == U_EA_FULLWIDTH) return 2;
-  if (width == U_EA_HALFWIDTH) return 1;
-
-  if (width == U_EA_WIDE) return 2;
-  if (width == U_EA_NARROW) return 1;
-
-  if (width == U_EA_AMBIGUOUS) {
-    /* CJK Unified Ideographs block */
-    if ((character >= 0X4E00) && (character <= 0X9FFF)) return 2;
-
-    /* CJK Unified Ideographs Externsion A block */
-    if ((character >= 0X3400) && (character <= 0X4DBF)) return 2;
-
-    /* CJK Compatibility Ideographs block */
-    if ((character >= 0XF900) && (character <= 0XFAFF)) return 2;
-
-    /* Supplementary Ideographic Plane */
-  //if ((character >= 0X20000) && (character <= 0X2FFFF)) return 2;
-
-    /* Tertiary Ideographic Plane */
-  //if ((character >= 0X30000) && (character <= 0X3FFFF)) return 2;
-  }
-
-  if (category == U_UNASSIGNED) return -1;
-  return 1;
-#else /* character width */
-  if (character == NUL) return 0;
-  if (character == DEL) return -1;
-  if (!(character & 0X60)) return -1;
-  return 1;
-#endif /* character width */
+  return getPropertiesEntry(character)->width;
 }
 
 int
@@ -337,42 +318,12 @@ decomposeCharacter (
 
 wchar_t
 getBaseCharacter (wchar_t character) {
-  wchar_t decomposed[0X10];
-  size_t count = decomposeCharacter(character, decomposed, sizeof(decomposed));
-  if (count) return decomposed[0];
-  return 0;
+  return getAlternates(character) & UNICODE_ALTERNATE_BASE_MASK;
 }
 
 wchar_t
 getTransliteratedCharacter (wchar_t character) {
-#ifdef HAVE_ICONV_H
-  static iconv_t handle = NULL;
-  if (!handle) handle = iconv_open("ASCII//TRANSLIT", "WCHAR_T");
-
-  if (handle != (iconv_t)-1) {
-    char *inputAddress = (char *)&character;
-    size_t inputSize = sizeof(character);
-    size_t outputSize = 0X10;
-    char outputBuffer[outputSize];
-    char *outputAddress = outputBuffer;
-
-    if (iconv(handle, &inputAddress, &inputSize, &outputAddress, &outputSize) != (size_t)-1) {
-      if ((outputAddress - outputBuffer) == 1) {
-        wchar_t result = outputBuffer[0] & 0XFF;
-
-        if (result != character) {
-          if (result == WC_C('?')) {
-            return 0;
-          }
-        }
-
-        return result;
-      }
-    }
-  }
-#endif /* HAVE_ICONV_H */
-
-  return 0;
+  return getAlternates(character) >> UNICODE_ALTERNATE_TRANSLITERATION_SHIFT;
 }
 
 int
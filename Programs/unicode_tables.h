@@ -0,0 +1,6609 @@
+/*
+ * BRLTTY - A background process providing access to the console screen (when in
+ *          text mode) for a blind person using a refreshable braille display.
+ *
+ * Copyright (C) 1995-2022 by The BRLTTY Developers.
+ *
+ * BRLTTY comes with ABSOLUTELY NO WARRANTY.
+ *
+ * This is free software, placed under the terms of the
+ * GNU Lesser General Public License, as published by the Free Software
+ * Foundation; either version 2.1 of the License, or (at your option) any
+ * later version. Please see the file LICENSE-LGPL for details.
+ *
+ * Web Page: http://brltty.app/
+ *
+ * This software is maintained by Dave Mielke <dave@mielke.cc>.
+ */
+
+/* Generated by Tools/mkunicode - do not edit. */
+
+#define UNICODE_TABLES_VERSION "14.0.0"
+#define UNICODE_TABLES_LIMIT 0X110000
+
+static const UnicodePropertiesEntry unicodePropertiesEntries[] = {
+  { .width = -1, .category = UNICODE_CATEGORY_UNASSIGNED },
+  { .width = 0, .category = UNICODE_CATEGORY_CONTROL },
+  { .width = -1, .category = UNICODE_CATEGORY_CONTROL },
+  { .width = 1, .category = UNICODE_CATEGORY_SPACE_SEPARATOR },
+  { .width = 1, .category = UNICODE_CATEGORY_OTHER_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_CURRENCY_SYMBOL },
+  { .width = 1, .category = UNICODE_CATEGORY_OPEN_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_CLOSE_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_MATH_SYMBOL },
+  { .width = 1, .category = UNICODE_CATEGORY_DASH_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_DECIMAL_NUMBER },
+  { .width = 1, .category = UNICODE_CATEGORY_UPPERCASE_LETTER },
+  { .width = 1, .category = UNICODE_CATEGORY_MODIFIER_SYMBOL },
+  { .width = 1, .category = UNICODE_CATEGORY_CONNECTOR_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_LOWERCASE_LETTER },
+  { .width = 1, .category = UNICODE_CATEGORY_OTHER_SYMBOL },
+  { .width = 1, .category = UNICODE_CATEGORY_OTHER_LETTER },
+  { .width = 1, .category = UNICODE_CATEGORY_INITIAL_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_FORMAT },
+  { .width = 1, .category = UNICODE_CATEGORY_OTHER_NUMBER },
+  { .width = 1, .category = UNICODE_CATEGORY_FINAL_PUNCTUATION },
+  { .width = 1, .category = UNICODE_CATEGORY_TITLECASE_LETTER },
+  { .width = 1, .category = UNICODE_CATEGORY_MODIFIER_LETTER },
+  { .width = 0, .category = UNICODE_CATEGORY_NONSPACING_MARK },
+  { .width = 2, .category = UNICODE_CATEGORY_UNASSIGNED },
+  { .width = 0, .category = UNICODE_CATEGORY_ENCLOSING_MARK },
+  { .width = 0, .category = UNICODE_CATEGORY_FORMAT },
+  { .width = 1, .category = UNICODE_CATEGORY_SPACING_MARK },
+  { .width = 2, .category = UNICODE_CATEGORY_OTHER_LETTER },
+  { .width = 0, .category = UNICODE_CATEGORY_OTHER_LETTER },
+  { .width = 1, .category = UNICODE_CATEGORY_LETTER_NUMBER },
+  { .width = 1, .category = UNICODE_CATEGORY_LINE_SEPARATOR },
+  { .width = 1, .category = UNICODE_CATEGORY_PARAGRAPH_SEPARATOR },
+  { .width = 2, .category = UNICODE_CATEGORY_OTHER_SYMBOL },
+  { .width = 2, .category = UNICODE_CATEGORY_OPEN_PUNCTUATION },
+  { .width = 2, .category = UNICODE_CATEGORY_CLOSE_PUNCTUATION },
+  { .width = 2, .category = UNICODE_CATEGORY_MATH_SYMBOL },
+  { .width = 2, .category = UNICODE_CATEGORY_SPACE_SEPARATOR },
+  { .width = 2, .category = UNICODE_CATEGORY_OTHER_PUNCTUATION },
+  { .width = 2, .category = UNICODE_CATEGORY_MODIFIER_LETTER },
+  { .width = 2, .category = UNICODE_CATEGORY_LETTER_NUMBER },
+  { .width = 2, .category = UNICODE_CATEGORY_DASH_PUNCTUATION },
+  { .width = 2, .category = UNICODE_CATEGORY_SPACING_MARK },
+  { .width = 2, .category = UNICODE_CATEGORY_MODIFIER_SYMBOL },
+  { .width = 2, .category = UNICODE_CATEGORY_OTHER_NUMBER },
+  { .width = -1, .category = UNICODE_CATEGORY_SURROGATE },
+  { .width = 1, .category = UNICODE_CATEGORY_PRIVATE_USE },
+  { .width = 2, .category = UNICODE_CATEGORY_CONNECTOR_PUNCTUATION },
+  { .width = 2, .category = UNICODE_CATEGORY_CURRENCY_SYMBOL },
+  { .width = 2, .category = UNICODE_CATEGORY_DECIMAL_NUMBER },
+  { .width = 2, .category = UNICODE_CATEGORY_UPPERCASE_LETTER },
+  { .width = 2, .category = UNICODE_CATEGORY_LOWERCASE_LETTER },
+};
+
+#define UNICODE_PROPERTIES_SHIFT 8
+#define UNICODE_PROPERTIES_MASK ((1 << UNICODE_PROPERTIES_SHIFT) - 1)
+
+static const uint8_t unicodePropertiesIndex[] = {
+  0X00, 0X01, 0X02, 0X03, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09, 0X0A, 0X0B,
+  0X0C, 0X0D, 0X0E, 0X0F, 0X10, 0X11, 0X12, 0X13, 0X14, 0X15, 0X16, 0X17,
+  0X18, 0X19, 0X1A, 0X1B, 0X1C, 0X1D, 0X1E, 0X1F, 0X20, 0X21, 0X22, 0X23,
+  0X24, 0X25, 0X26, 0X27, 0X28, 0X29, 0X22, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E,
+  0X2F, 0X30, 0X31, 0X32, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X34, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X35, 0X33, 0X33, 0X33, 0X36, 0X15, 0X37, 0X38,
+  0X39, 0X3A, 0X3B, 0X3C, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X3D,
+  0X3E, 0X3E, 0X3E, 0X3E, 0X3E, 0X3E, 0X3E, 0X3E, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X33, 0X40, 0X41,
+  0X15, 0X42, 0X43, 0X44, 0X45, 0X46, 0X47, 0X48, 0X49, 0X4A, 0X15, 0X4B,
+  0X4C, 0X4D, 0X4E, 0X4F, 0X50, 0X51, 0X52, 0X53, 0X54, 0X55, 0X56, 0X57,
+  0X58, 0X59, 0X5A, 0X5B, 0X5C, 0X5D, 0X5E, 0X5F, 0X60, 0X61, 0X62, 0X63,
+  0X15, 0X15, 0X15, 0X64, 0X65, 0X66, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X67, 0X15, 0X15, 0X15, 0X15, 0X68, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X15, 0X15, 0X69, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X15, 0X15, 0X6A, 0X6B, 0X5F, 0X5F, 0X6C, 0X6D, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X6E, 0X33, 0X33, 0X33, 0X33,
+  0X6F, 0X70, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X71,
+  0X33, 0X72, 0X73, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X74, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X75, 0X76, 0X77, 0X78, 0X79,
+  0X7A, 0X7B, 0X7C, 0X7D, 0X28, 0X28, 0X7E, 0X5F, 0X5F, 0X5F, 0X5F, 0X7F,
+  0X80, 0X81, 0X82, 0X5F, 0X5F, 0X5F, 0X5F, 0X83, 0X84, 0X85, 0X5F, 0X5F,
+  0X86, 0X87, 0X88, 0X5F, 0X89, 0X8A, 0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X90,
+  0X91, 0X92, 0X93, 0X94, 0X5F, 0X5F, 0X5F, 0X5F, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X95, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X96,
+  0X97, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X98, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X99, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X33, 0X33, 0X9A, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X9B, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X9C, 0X9D, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X9E, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F,
+  0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X3F, 0X9E,
+};
+
+static const uint8_t unicodePropertiesBlocks[] = {
+  0X01, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02,
+  0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02,
+  0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X03, 0X04, 0X04, 0X04,
+  0X05, 0X04, 0X04, 0X04, 0X06, 0X07, 0X04, 0X08, 0X04, 0X09, 0X04, 0X04,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04,
+  0X08, 0X08, 0X08, 0X04, 0X04, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X06, 0X04, 0X07, 0X0C, 0X0D,
+  0X0C, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X06, 0X08, 0X07, 0X08, 0X02, 0X02, 0X02, 0X02, 0X02,
+  0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02,
+  0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02, 0X02,
+  0X02, 0X02, 0X02, 0X02, 0X03, 0X04, 0X05, 0X05, 0X05, 0X05, 0X0F, 0X04,
+  0X0C, 0X0F, 0X10, 0X11, 0X08, 0X12, 0X0F, 0X0C, 0X0F, 0X08, 0X13, 0X13,
+  0X0C, 0X0E, 0X04, 0X04, 0X0C, 0X13, 0X10, 0X14, 0X13, 0X13, 0X13, 0X04,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X08,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X08, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B, 0X0B,
+  0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B,
+  0X0B, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B,
+  0X0E, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0E, 0X10,
+  0X0B, 0X0E, 0X0E, 0X0E, 0X10, 0X10, 0X10, 0X10, 0X0B, 0X15, 0X0E, 0X0B,
+  0X15, 0X0E, 0X0B, 0X15, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X15, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X10, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X16, 0X16, 0X16, 0X16, 0X16, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X16, 0X0C, 0X16, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X0B, 0X0E, 0X0B, 0X0E, 0X16, 0X0C, 0X0B, 0X0E,
+  0X18, 0X18, 0X16, 0X0E, 0X0E, 0X0E, 0X04, 0X0B, 0X18, 0X18, 0X18, 0X18,
+  0X0C, 0X0C, 0X0B, 0X04, 0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X18, 0X0B, 0X0B,
+  0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X08, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E,
+  0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0F, 0X17, 0X17, 0X17, 0X17, 0X17, 0X19, 0X19, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X18, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18,
+  0X18, 0X16, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X04, 0X09, 0X18, 0X18, 0X0F, 0X0F, 0X05, 0X18, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X09, 0X17, 0X04, 0X17, 0X17, 0X04,
+  0X17, 0X17, 0X04, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X04,
+  0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X12, 0X12, 0X12, 0X12, 0X12, 0X12, 0X08, 0X08, 0X08, 0X04, 0X04, 0X05,
+  0X04, 0X04, 0X0F, 0X0F, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X04, 0X1A, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X16, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04,
+  0X04, 0X04, 0X10, 0X10, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X04, 0X10, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X12, 0X0F, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X16, 0X16, 0X17, 0X17, 0X0F, 0X17, 0X17, 0X17, 0X17, 0X10, 0X10,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X10, 0X10,
+  0X10, 0X0F, 0X0F, 0X10, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X12, 0X10, 0X17, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X16, 0X16, 0X0F, 0X04,
+  0X04, 0X04, 0X16, 0X18, 0X18, 0X17, 0X05, 0X05, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X16, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X16, 0X17, 0X17, 0X17,
+  0X16, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X17, 0X17, 0X18, 0X18, 0X04, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X0C, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X12, 0X12, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X16, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X12, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X1B,
+  0X17, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X10, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X17, 0X04, 0X04, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X16, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X1B, 0X1B,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10,
+  0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X18,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X17, 0X10, 0X1B, 0X1B,
+  0X1B, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X1B, 0X1B, 0X18, 0X18, 0X1B,
+  0X1B, 0X17, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1B,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X17, 0X17,
+  0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X10, 0X10, 0X05, 0X05, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X05,
+  0X10, 0X04, 0X17, 0X18, 0X18, 0X17, 0X17, 0X1B, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X18, 0X18, 0X17, 0X18, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X17, 0X17, 0X18, 0X18, 0X17, 0X17, 0X17, 0X18, 0X18,
+  0X18, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X17, 0X17, 0X10, 0X10,
+  0X10, 0X17, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X17, 0X17, 0X1B, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X17, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17,
+  0X17, 0X1B, 0X18, 0X1B, 0X1B, 0X17, 0X18, 0X18, 0X10, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X17, 0X17, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X05, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X1B, 0X1B,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10,
+  0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X17, 0X10, 0X1B, 0X17,
+  0X1B, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X1B, 0X1B, 0X18, 0X18, 0X1B,
+  0X1B, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X1B,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X17, 0X17,
+  0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0F, 0X10, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X10, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X18,
+  0X18, 0X18, 0X1B, 0X1B, 0X1B, 0X18, 0X1B, 0X1B, 0X1B, 0X17, 0X18, 0X18,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1B, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X13, 0X13, 0X13, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X05, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X1B, 0X1B, 0X1B, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X17, 0X10, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X18, 0X17, 0X17,
+  0X17, 0X18, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X17, 0X17, 0X18, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X18, 0X18,
+  0X10, 0X10, 0X17, 0X17, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X04,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X10, 0X17, 0X1B, 0X1B,
+  0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X17, 0X10, 0X1B, 0X17,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X18, 0X17, 0X1B, 0X1B, 0X18, 0X1B, 0X1B,
+  0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1B, 0X1B, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X17, 0X17,
+  0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X18, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X1B, 0X1B, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X17, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17,
+  0X17, 0X18, 0X1B, 0X1B, 0X1B, 0X18, 0X1B, 0X1B, 0X1B, 0X17, 0X10, 0X0F,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X1B, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X10, 0X10, 0X10, 0X17, 0X17, 0X18, 0X18, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X17, 0X1B, 0X1B, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X17, 0X18, 0X18, 0X18, 0X18, 0X1B, 0X1B, 0X1B, 0X17, 0X17,
+  0X17, 0X18, 0X17, 0X18, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X1B, 0X1B, 0X04, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X10, 0X10,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X05,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X16, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X04, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X16, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X0F, 0X0F, 0X0F, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0F, 0X04, 0X0F, 0X0F, 0X0F,
+  0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X0F, 0X17, 0X0F, 0X17, 0X0F, 0X17, 0X06, 0X07,
+  0X06, 0X07, 0X1B, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X04, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X18, 0X0F, 0X0F, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B,
+  0X1B, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X1B, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X10, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X17, 0X17, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X17, 0X17, 0X10, 0X1B, 0X1B, 0X1B, 0X10, 0X10, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17,
+  0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X17, 0X10, 0X1B, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X1B, 0X1B, 0X1B, 0X17, 0X0F, 0X0F, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0B,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X0B, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X04, 0X16, 0X0E, 0X0E, 0X0E, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X17, 0X17, 0X17, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X18,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X18, 0X09, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X0F, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X03, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X06, 0X07, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X04,
+  0X04, 0X04, 0X1E, 0X1E, 0X1E, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X17, 0X17, 0X1B, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17,
+  0X1B, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X18, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X1B, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X04, 0X04, 0X04, 0X16, 0X04, 0X04, 0X04, 0X05,
+  0X10, 0X17, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X09, 0X04, 0X04, 0X04, 0X04, 0X17,
+  0X17, 0X17, 0X1A, 0X17, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X16, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X17, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X1B, 0X1B, 0X1B,
+  0X18, 0X18, 0X18, 0X18, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X18, 0X18, 0X18,
+  0X04, 0X04, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X13, 0X18, 0X18, 0X18, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X1B, 0X1B, 0X17,
+  0X18, 0X18, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X17, 0X1B,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X1B, 0X17, 0X1B,
+  0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X18, 0X18, 0X17, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X16, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X19, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X17, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B,
+  0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X04, 0X04, 0X18, 0X17, 0X17, 0X1B, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B,
+  0X17, 0X17, 0X1B, 0X17, 0X17, 0X17, 0X10, 0X10, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X1B, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X17, 0X1B, 0X17,
+  0X17, 0X17, 0X1B, 0X1B, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X04, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17,
+  0X18, 0X18, 0X18, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X04, 0X04,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18,
+  0X18, 0X0B, 0X0B, 0X0B, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X04,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X10, 0X10, 0X1B,
+  0X17, 0X17, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X18,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X18,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X0B, 0X18, 0X0B,
+  0X18, 0X0B, 0X18, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X18,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X15, 0X15, 0X15, 0X15,
+  0X15, 0X15, 0X15, 0X15, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X15, 0X15, 0X15, 0X15, 0X15, 0X15, 0X15, 0X15, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X15, 0X15, 0X15, 0X15, 0X15, 0X15, 0X15, 0X15,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X15, 0X0C, 0X0E, 0X0C, 0X0C, 0X0C, 0X0E, 0X0E, 0X0E, 0X18, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X15, 0X0C, 0X0C, 0X0C, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X18, 0X18, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0C, 0X0C, 0X0C,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0C, 0X0C, 0X0C, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X18, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X15, 0X0C, 0X0C, 0X18, 0X03, 0X03, 0X03, 0X03,
+  0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X03, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X09, 0X09, 0X09, 0X09, 0X09, 0X09, 0X04, 0X04, 0X11, 0X14, 0X06, 0X11,
+  0X11, 0X14, 0X06, 0X11, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X1F, 0X20, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X03, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X11, 0X14, 0X04, 0X04, 0X04, 0X04, 0X0D,
+  0X0D, 0X04, 0X04, 0X04, 0X08, 0X06, 0X07, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X08, 0X04, 0X0D, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X03, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X18, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X13, 0X16, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X08, 0X08,
+  0X08, 0X06, 0X07, 0X16, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X08, 0X08, 0X08, 0X06, 0X07, 0X18, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X18, 0X18, 0X18,
+  0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05,
+  0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05,
+  0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X05, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X19, 0X19, 0X19, 0X19, 0X17, 0X19, 0X19, 0X19, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0B, 0X0F, 0X0F, 0X0F, 0X0F, 0X0B, 0X0F, 0X0F, 0X0E, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0E, 0X0F, 0X0B, 0X0F, 0X0F,
+  0X08, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0B, 0X0F, 0X0B, 0X0F, 0X0B, 0X0F, 0X0B, 0X0B, 0X0B, 0X0B, 0X0F, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X10, 0X10, 0X10, 0X10, 0X0E, 0X0F, 0X0F,
+  0X0E, 0X0E, 0X0B, 0X0B, 0X08, 0X08, 0X08, 0X08, 0X08, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0F, 0X08, 0X0F, 0X0F, 0X0E, 0X0F, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X0B,
+  0X0E, 0X1E, 0X1E, 0X1E, 0X1E, 0X13, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X08,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X0F, 0X0F, 0X08, 0X0F, 0X0F, 0X08, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X08, 0X08, 0X0F, 0X0F, 0X08, 0X0F, 0X08, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X06, 0X07, 0X06, 0X07, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X22, 0X23, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X24, 0X24, 0X08, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21,
+  0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X21, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X21,
+  0X21, 0X21, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X06, 0X07, 0X06, 0X07,
+  0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X0F, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X06, 0X07, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X06, 0X07, 0X06, 0X07, 0X06,
+  0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06,
+  0X07, 0X06, 0X07, 0X06, 0X07, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X06, 0X07, 0X06, 0X07,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X06, 0X07, 0X08, 0X08,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X08,
+  0X08, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0B,
+  0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0E, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X16, 0X0B, 0X0B,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0B,
+  0X0E, 0X0B, 0X0E, 0X17, 0X17, 0X17, 0X0B, 0X0E, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X04, 0X04, 0X04, 0X04, 0X13, 0X04, 0X04, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X0E,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X0E, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X16,
+  0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X04, 0X04, 0X11, 0X14, 0X11, 0X14, 0X04, 0X04, 0X04, 0X11, 0X14, 0X04,
+  0X11, 0X14, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X09,
+  0X04, 0X04, 0X09, 0X04, 0X11, 0X14, 0X04, 0X04, 0X11, 0X14, 0X06, 0X07,
+  0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X04, 0X04, 0X04, 0X04, 0X04, 0X16,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X09, 0X09,
+  0X04, 0X04, 0X04, 0X04, 0X09, 0X04, 0X06, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0F, 0X0F, 0X04, 0X04,
+  0X04, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X06, 0X07, 0X09, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X25, 0X26, 0X26, 0X26,
+  0X21, 0X27, 0X1C, 0X28, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23,
+  0X22, 0X23, 0X21, 0X21, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23,
+  0X29, 0X22, 0X23, 0X23, 0X21, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28, 0X28,
+  0X28, 0X28, 0X17, 0X17, 0X17, 0X17, 0X2A, 0X2A, 0X29, 0X27, 0X27, 0X27,
+  0X27, 0X27, 0X21, 0X21, 0X28, 0X28, 0X28, 0X27, 0X1C, 0X26, 0X21, 0X0F,
+  0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X17, 0X17, 0X2B, 0X2B, 0X27, 0X27, 0X1C,
+  0X29, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X26, 0X27, 0X27, 0X27, 0X1C,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18,
+  0X21, 0X21, 0X2C, 0X2C, 0X2C, 0X2C, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18,
+  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X21, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C,
+  0X2C, 0X2C, 0X2C, 0X2C, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C, 0X2C,
+  0X2C, 0X2C, 0X2C, 0X2C, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X27, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X16, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X10, 0X17, 0X19, 0X19, 0X19, 0X04,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X04, 0X16,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X16, 0X16, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X17, 0X17, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X0C, 0X0C, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X16, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X0B,
+  0X0E, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X16, 0X0C, 0X0C, 0X0B, 0X0E, 0X0B, 0X0E, 0X10, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0E, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0B, 0X0E, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0B, 0X0E, 0X18, 0X0E, 0X18, 0X0E, 0X0B, 0X0E, 0X0B, 0X0E, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X16, 0X16,
+  0X16, 0X0B, 0X0E, 0X10, 0X16, 0X16, 0X0E, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X17, 0X10, 0X10, 0X10, 0X17, 0X10, 0X10, 0X10, 0X10, 0X17,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B,
+  0X1B, 0X17, 0X17, 0X1B, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X18, 0X18, 0X18,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X0F, 0X05, 0X0F, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X04, 0X04, 0X04, 0X04,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1B, 0X1B, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X04, 0X04, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X04, 0X04, 0X04, 0X10,
+  0X04, 0X10, 0X10, 0X17, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X1B, 0X1B, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X04, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B,
+  0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X16, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X04, 0X04,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X16, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X1B,
+  0X1B, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X17, 0X1B, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X04, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X16, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X0F, 0X0F, 0X0F, 0X10, 0X1B,
+  0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X17, 0X10, 0X17, 0X17, 0X17, 0X10, 0X10, 0X17,
+  0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X10, 0X17, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10,
+  0X10, 0X16, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X1B, 0X17, 0X17, 0X1B, 0X1B, 0X04, 0X04, 0X10, 0X16,
+  0X16, 0X1B, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0C, 0X16, 0X16, 0X16, 0X16,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X16, 0X0C, 0X0C,
+  0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B,
+  0X1B, 0X17, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X04, 0X1B, 0X17, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X18,
+  0X18, 0X18, 0X18, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D, 0X1D,
+  0X1D, 0X1D, 0X1D, 0X1D, 0X18, 0X18, 0X18, 0X18, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D, 0X2D,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X10, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X08, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X18,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C,
+  0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X0C, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X07, 0X06, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X05, 0X0F, 0X0F, 0X0F, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X26, 0X26, 0X26, 0X26,
+  0X26, 0X26, 0X26, 0X22, 0X23, 0X26, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X26, 0X29, 0X29, 0X2F, 0X2F, 0X22, 0X23, 0X22,
+  0X23, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23, 0X22, 0X23, 0X22,
+  0X23, 0X26, 0X26, 0X22, 0X23, 0X26, 0X26, 0X26, 0X26, 0X2F, 0X2F, 0X2F,
+  0X26, 0X26, 0X26, 0X18, 0X26, 0X26, 0X26, 0X26, 0X29, 0X22, 0X23, 0X22,
+  0X23, 0X22, 0X23, 0X26, 0X26, 0X26, 0X24, 0X29, 0X24, 0X24, 0X24, 0X18,
+  0X26, 0X30, 0X26, 0X26, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X1A, 0X18, 0X26, 0X26, 0X26,
+  0X30, 0X26, 0X26, 0X26, 0X22, 0X23, 0X26, 0X24, 0X26, 0X29, 0X26, 0X26,
+  0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X31, 0X26, 0X26,
+  0X24, 0X24, 0X24, 0X26, 0X26, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32,
+  0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32,
+  0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X32, 0X22, 0X26, 0X23, 0X2B, 0X2F,
+  0X2B, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33, 0X33,
+  0X33, 0X33, 0X33, 0X22, 0X24, 0X23, 0X24, 0X22, 0X23, 0X04, 0X06, 0X07,
+  0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X16, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X16, 0X16,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X30, 0X30, 0X24, 0X2B, 0X21, 0X30, 0X30, 0X18,
+  0X0F, 0X08, 0X08, 0X08, 0X08, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X1A, 0X1A, 0X1A, 0X0F, 0X0F, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X13, 0X13,
+  0X0F, 0X0F, 0X0F, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X0F, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X17, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X13, 0X13, 0X13, 0X13,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X1E, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X1E, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X04, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X04,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18,
+  0X0B, 0X0B, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X0E, 0X0E, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X18, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X18, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X04, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X0F, 0X0F, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X18, 0X18, 0X18, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X04,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X10, 0X10, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X10, 0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X17, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X17, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X13, 0X13, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X0F, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18,
+  0X18, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X17, 0X17, 0X09, 0X18, 0X18,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X13, 0X13, 0X13, 0X13, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X04, 0X04,
+  0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X1B, 0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X17, 0X10, 0X10, 0X17, 0X17, 0X10, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X1B, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17,
+  0X17, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X04, 0X04, 0X12, 0X04, 0X04,
+  0X04, 0X04, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X12, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04, 0X04, 0X04,
+  0X10, 0X1B, 0X1B, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17,
+  0X04, 0X04, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X1B, 0X1B, 0X10, 0X10, 0X10, 0X10, 0X04, 0X04, 0X04,
+  0X04, 0X17, 0X17, 0X17, 0X17, 0X04, 0X1B, 0X17, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X10, 0X04, 0X10, 0X04, 0X04, 0X04,
+  0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X1B, 0X1B,
+  0X17, 0X1B, 0X17, 0X17, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X04, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X1B, 0X1B, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X10, 0X10, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X17,
+  0X17, 0X10, 0X1B, 0X1B, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X18, 0X18, 0X1B,
+  0X1B, 0X18, 0X18, 0X1B, 0X1B, 0X1B, 0X18, 0X18, 0X10, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X1B, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X1B, 0X1B, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17,
+  0X17, 0X1B, 0X17, 0X10, 0X10, 0X10, 0X10, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X04, 0X04,
+  0X18, 0X04, 0X17, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X10, 0X10, 0X04, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B,
+  0X1B, 0X17, 0X1B, 0X17, 0X17, 0X04, 0X04, 0X04, 0X10, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X17, 0X1B, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X1B, 0X17, 0X10, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X17, 0X17, 0X17,
+  0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X13, 0X13, 0X04, 0X04, 0X04, 0X0F, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X17, 0X04, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X10, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X18, 0X1B, 0X1B, 0X18, 0X18, 0X17,
+  0X17, 0X1B, 0X17, 0X10, 0X1B, 0X10, 0X1B, 0X17, 0X04, 0X04, 0X04, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X17,
+  0X18, 0X18, 0X17, 0X17, 0X1B, 0X1B, 0X1B, 0X1B, 0X17, 0X10, 0X04, 0X10,
+  0X1B, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X1B, 0X10, 0X17, 0X17, 0X17, 0X17, 0X04, 0X04, 0X04, 0X04, 0X04,
+  0X04, 0X04, 0X04, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X1B, 0X17, 0X17, 0X17,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B,
+  0X17, 0X17, 0X04, 0X04, 0X04, 0X10, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X1B, 0X17, 0X10, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X18, 0X18, 0X18, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X18, 0X1B, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X1B, 0X17, 0X17,
+  0X1B, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X17, 0X18, 0X17, 0X17, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X10, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10,
+  0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X18, 0X17, 0X17, 0X18, 0X1B, 0X1B, 0X17, 0X1B, 0X17,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17,
+  0X17, 0X1B, 0X1B, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X05, 0X05, 0X05, 0X05, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X04, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E,
+  0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X1E, 0X18,
+  0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X04, 0X04, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X04, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X04, 0X04, 0X04, 0X04, 0X04, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X16, 0X16, 0X16, 0X16, 0X04, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X04, 0X04, 0X04, 0X04, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X17,
+  0X10, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X1B, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X16, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X27, 0X27, 0X26, 0X27, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X2A, 0X2A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X27, 0X27, 0X27, 0X27,
+  0X18, 0X27, 0X27, 0X27, 0X27, 0X27, 0X27, 0X27, 0X18, 0X27, 0X27, 0X18,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X0F, 0X17, 0X17, 0X04,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18,
+  0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X1B, 0X1B, 0X17, 0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X1B, 0X1B, 0X1B,
+  0X1B, 0X1B, 0X1B, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X0F, 0X0F, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X17,
+  0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X17, 0X17, 0X0F, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X18, 0X0B, 0X0B,
+  0X18, 0X18, 0X0B, 0X18, 0X18, 0X0B, 0X0B, 0X18, 0X18, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X0E, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X18,
+  0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X18, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0B, 0X18,
+  0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X18, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X08, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X08,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X08, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X08, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X08,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0B, 0X0E, 0X18, 0X18, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X17, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X17, 0X0F, 0X0F, 0X04, 0X04, 0X04, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X10, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18, 0X17, 0X17, 0X18, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X16, 0X16, 0X16, 0X16, 0X16,
+  0X16, 0X16, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X10, 0X0F, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X17, 0X17, 0X17, 0X17, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X05, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B, 0X0B,
+  0X0B, 0X0B, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E, 0X0E,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X16, 0X18, 0X18, 0X18, 0X18,
+  0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X18, 0X18,
+  0X18, 0X18, 0X04, 0X04, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X0F, 0X13, 0X13, 0X13, 0X05, 0X13, 0X13, 0X13, 0X13, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X0F, 0X13,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X13, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X18, 0X10, 0X18, 0X18, 0X10, 0X18, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X18, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X18,
+  0X18, 0X18, 0X18, 0X10, 0X18, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X18, 0X10, 0X18, 0X18, 0X10, 0X18, 0X10, 0X18, 0X10,
+  0X18, 0X10, 0X18, 0X10, 0X18, 0X10, 0X10, 0X18, 0X10, 0X18, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X18,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X18, 0X18, 0X18, 0X18, 0X18, 0X10, 0X10, 0X10,
+  0X18, 0X10, 0X10, 0X10, 0X10, 0X10, 0X18, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10, 0X10,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X08, 0X08, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21,
+  0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13, 0X13,
+  0X13, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F,
+  0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F,
+  0X21, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X2B, 0X2B, 0X2B, 0X2B, 0X2B,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X0F, 0X21, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X0F,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X0F, 0X0F, 0X0F,
+  0X21, 0X21, 0X21, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X21, 0X21, 0X21, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18,
+  0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X18,
+  0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X0F, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X21, 0X21, 0X21, 0X21,
+  0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X21, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X18, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F, 0X0F,
+  0X0F, 0X0F, 0X0F, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A, 0X0A,
+  0X0A, 0X0A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C,
+  0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X1C, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X1A, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A,
+  0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X1A, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17, 0X17,
+  0X17, 0X17, 0X17, 0X17, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18,
+  0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X18, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E,
+  0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X2E, 0X18, 0X18,
+};
+
+#define UNICODE_ALTERNATE_BASE_MASK 0XFFFFFF
+#define UNICODE_ALTERNATE_TRANSLITERATION_SHIFT 24
+
+#define UNICODE_ALTERNATES_SHIFT 6
+#define UNICODE_ALTERNATES_MASK ((1 << UNICODE_ALTERNATES_SHIFT) - 1)
+
+static const uint8_t unicodeAlternatesIndex[] = {
+  0X00, 0X00, 0X01, 0X02, 0X03, 0X04, 0X05, 0X06, 0X07, 0X08, 0X09, 0X0A,
+  0X00, 0X0B, 0X0C, 0X0D, 0X0E, 0X0F, 0X00, 0X10, 0X00, 0X00, 0X00, 0X00,
+  0X11, 0X00, 0X00, 0X12, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X13, 0X14, 0X00, 0X15, 0X16, 0X17, 0X00, 0X00, 0X00, 0X18, 0X19, 0X1A,
+  0X00, 0X1B, 0X00, 0X1C, 0X00, 0X1D, 0X00, 0X1E, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X1F, 0X20, 0X00, 0X21, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X22, 0X23, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X24, 0X25, 0X26, 0X00,
+  0X27, 0X28, 0X29, 0X2A, 0X2B, 0X2C, 0X2D, 0X2E, 0X2F, 0X30, 0X31, 0X00,
+  0X32, 0X33, 0X34, 0X35, 0X36, 0X37, 0X38, 0X39, 0X3A, 0X00, 0X00, 0X00,
+  0X00, 0X3B, 0X3C, 0X3D, 0X3E, 0X00, 0X00, 0X3F, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X40, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X41, 0X00, 0X00, 0X00, 0X00, 0X00, 0X42, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X43, 0X44, 0X45, 0X46, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X47, 0X48, 0X49, 0X4A,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X4B, 0X4C, 0X00, 0X00, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D, 0X4D,
+  0X4D, 0X4E, 0X4F, 0X4F, 0X4F, 0X4F, 0X4F, 0X4F, 0X4F, 0X4F, 0X50, 0X51,
+  0X51, 0X51, 0X51, 0X51, 0X51, 0X51, 0X51, 0X52, 0X53, 0X53, 0X53, 0X53,
+  0X53, 0X53, 0X53, 0X53, 0X54, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55, 0X55,
+  0X55, 0X56, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X57, 0X58,
+  0X59, 0X59, 0X59, 0X59, 0X59, 0X59, 0X59, 0X59, 0X5A, 0X5B, 0X5B, 0X5B,
+  0X5B, 0X5B, 0X5B, 0X5B, 0X5B, 0X5C, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D, 0X5D,
+  0X5D, 0X5D, 0X5E, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X5F, 0X60,
+  0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X61, 0X62, 0X63, 0X63,
+  0X63, 0X63, 0X63, 0X63, 0X63, 0X63, 0X64, 0X65, 0X65, 0X65, 0X65, 0X65,
+  0X65, 0X65, 0X65, 0X66, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67, 0X67,
+  0X68, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X69, 0X6A, 0X6B, 0X6B,
+  0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6B, 0X6C, 0X6C, 0X6C, 0X6C, 0X6C,
+  0X6C, 0X6C, 0X6C, 0X6C, 0X6D, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E, 0X6E,
+  0X6E, 0X6F, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X70, 0X71, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X72, 0X73, 0X74, 0X75, 0X76, 0X77, 0X78, 0X79, 0X7A, 0X7B, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X7C, 0X7D, 0X00, 0X00,
+  0X7E, 0X7F, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X80, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X81, 0X00,
+  0X82, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X83, 0X00, 0X00,
+  0X00, 0X00, 0X84, 0X00, 0X00, 0X00, 0X85, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X86, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X87, 0X88, 0X89, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X8A, 0X8B, 0X8C, 0X8D, 0X8E, 0X8F, 0X90, 0X91, 0X92, 0X93, 0X94, 0X00,
+  0X00, 0X00, 0X00, 0X95, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X96, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X97, 0X98, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X99, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X9A, 0X9B, 0X9C, 0X9D, 0X9E, 0X9F, 0XA0, 0XA1,
+  0XA2, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+  0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00, 0X00,
+};
+
+static const uint32_t unicodeAlternatesBlocks[] = {
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X20000000, 0X21000000, 0X63000000, 0X00000000, 0X00000000, 0X00000000, 0X7C000000, 0X00000000,
+  0X00000000, 0X00000000, 0X61000000, 0X00000000, 0X21000000, 0X2D000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X32000000, 0X33000000, 0X27000000, 0X75000000, 0X00000000, 0X2E000000,
+  0X2C000000, 0X31000000, 0X6F000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000041, 0X41000041, 0X41000041, 0X41000041, 0X41000041, 0X41000041, 0X00000000, 0X43000043,
+  0X45000045, 0X45000045, 0X45000045, 0X45000045, 0X49000049, 0X49000049, 0X49000049, 0X49000049,
+  0X44000000, 0X4E00004E, 0X4F00004F, 0X4F00004F, 0X4F00004F, 0X4F00004F, 0X4F00004F, 0X78000000,
+  0X4F000000, 0X55000055, 0X55000055, 0X55000055, 0X55000055, 0X59000059, 0X00000000, 0X00000000,
+  0X61000061, 0X61000061, 0X61000061, 0X61000061, 0X61000061, 0X61000061, 0X00000000, 0X63000063,
+  0X65000065, 0X65000065, 0X65000065, 0X65000065, 0X69000069, 0X69000069, 0X69000069, 0X69000069,
+  0X64000000, 0X6E00006E, 0X6F00006F, 0X6F00006F, 0X6F00006F, 0X6F00006F, 0X6F00006F, 0X2F000000,
+  0X6F000000, 0X75000075, 0X75000075, 0X75000075, 0X75000075, 0X79000079, 0X00000000, 0X79000079,
+  0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X43000043, 0X63000063,
+  0X43000043, 0X63000063, 0X43000043, 0X63000063, 0X43000043, 0X63000063, 0X44000044, 0X64000064,
+  0X44000000, 0X64000000, 0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065,
+  0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X47000047, 0X67000067, 0X47000047, 0X67000067,
+  0X47000047, 0X67000067, 0X47000047, 0X67000067, 0X48000048, 0X68000068, 0X48000000, 0X68000000,
+  0X49000049, 0X69000069, 0X49000049, 0X69000069, 0X49000049, 0X69000069, 0X49000049, 0X69000069,
+  0X49000049, 0X69000000, 0X00000000, 0X00000000, 0X4A00004A, 0X6A00006A, 0X4B00004B, 0X6B00006B,
+  0X00000000, 0X4C00004C, 0X6C00006C, 0X4C00004C, 0X6C00006C, 0X4C00004C, 0X6C00006C, 0X4C000000,
+  0X6C000000, 0X4C000000, 0X6C000000, 0X4E00004E, 0X6E00006E, 0X4E00004E, 0X6E00006E, 0X4E00004E,
+  0X6E00006E, 0X00000000, 0X00000000, 0X00000000, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X00000000, 0X00000000, 0X52000052, 0X72000072, 0X52000052, 0X72000072,
+  0X52000052, 0X72000072, 0X53000053, 0X73000073, 0X53000053, 0X73000073, 0X53000053, 0X73000073,
+  0X53000053, 0X73000073, 0X54000054, 0X74000074, 0X54000054, 0X74000074, 0X54000000, 0X74000000,
+  0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075,
+  0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X57000057, 0X77000077, 0X59000059, 0X79000079,
+  0X59000059, 0X5A00005A, 0X7A00007A, 0X5A00005A, 0X7A00007A, 0X5A00005A, 0X7A00007A, 0X73000000,
+  0X62000000, 0X42000000, 0X42000000, 0X62000000, 0X00000000, 0X00000000, 0X00000000, 0X43000000,
+  0X63000000, 0X00000000, 0X44000000, 0X44000000, 0X64000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X46000000, 0X66000000, 0X47000000, 0X00000000, 0X00000000, 0X00000000, 0X49000000,
+  0X4B000000, 0X6B000000, 0X6C000000, 0X00000000, 0X00000000, 0X4E000000, 0X6E000000, 0X4F000000,
+  0X4F00004F, 0X6F00006F, 0X00000000, 0X00000000, 0X50000000, 0X70000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X74000000, 0X54000000, 0X74000000, 0X54000000, 0X55000055,
+  0X75000075, 0X00000000, 0X56000000, 0X59000000, 0X79000000, 0X5A000000, 0X7A000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X44000000, 0X00000000, 0X00000000,
+  0X4C000000, 0X00000000, 0X00000000, 0X4E000000, 0X00000000, 0X41000041, 0X61000061, 0X49000049,
+  0X69000069, 0X4F00004F, 0X6F00006F, 0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055,
+  0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X00000000, 0X41000041, 0X61000061,
+  0X41000041, 0X61000061, 0X000000C6, 0X000000E6, 0X47000000, 0X67000000, 0X47000047, 0X67000067,
+  0X4B00004B, 0X6B00006B, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X000001B7, 0X00000292,
+  0X6A00006A, 0X00000000, 0X44000000, 0X00000000, 0X47000047, 0X67000067, 0X00000000, 0X00000000,
+  0X4E00004E, 0X6E00006E, 0X41000041, 0X61000061, 0X000000C6, 0X000000E6, 0X4F0000D8, 0X6F0000F8,
+  0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X45000045, 0X65000065, 0X45000045, 0X65000065,
+  0X49000049, 0X69000069, 0X49000049, 0X69000069, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X52000052, 0X72000072, 0X52000052, 0X72000072, 0X55000055, 0X75000075, 0X55000055, 0X75000075,
+  0X53000053, 0X73000073, 0X54000054, 0X74000074, 0X00000000, 0X00000000, 0X48000048, 0X68000068,
+  0X4E000000, 0X64000000, 0X00000000, 0X00000000, 0X5A000000, 0X7A000000, 0X41000041, 0X61000061,
+  0X45000045, 0X65000065, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X59000059, 0X79000079, 0X6C000000, 0X6E000000, 0X74000000, 0X6A000000,
+  0X00000000, 0X00000000, 0X41000000, 0X43000000, 0X63000000, 0X4C000000, 0X54000000, 0X73000000,
+  0X7A000000, 0X00000000, 0X00000000, 0X42000000, 0X55000000, 0X00000000, 0X45000000, 0X65000000,
+  0X4A000000, 0X6A000000, 0X00000000, 0X71000000, 0X52000000, 0X72000000, 0X59000000, 0X79000000,
+  0X00000000, 0X00000000, 0X00000000, 0X62000000, 0X00000000, 0X63000000, 0X64000000, 0X64000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X6A000000,
+  0X67000000, 0X00000000, 0X47000000, 0X00000000, 0X00000000, 0X00000000, 0X68000000, 0X00000000,
+  0X69000000, 0X00000000, 0X49000000, 0X6C000000, 0X6C000000, 0X6C000000, 0X00000000, 0X00000000,
+  0X00000000, 0X6D000000, 0X6E000000, 0X6E000000, 0X4E000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X72000000, 0X72000000, 0X72000000, 0X00000000,
+  0X52000000, 0X00000000, 0X73000000, 0X00000000, 0X6A000000, 0X00000000, 0X00000000, 0X00000000,
+  0X74000000, 0X75000000, 0X00000000, 0X76000000, 0X00000000, 0X00000000, 0X00000000, 0X59000000,
+  0X7A000000, 0X7A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X42000000, 0X00000000, 0X47000000, 0X48000000, 0X6A000000, 0X00000000, 0X4C000000,
+  0X71000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X68000000, 0X00000000, 0X6A000000, 0X72000000, 0X00000000, 0X00000000, 0X00000000, 0X77000000,
+  0X79000000, 0X00000000, 0X00000000, 0X00000000, 0X27000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X5E000000, 0X00000000,
+  0X27000000, 0X00000000, 0X00000000, 0X60000000, 0X00000000, 0X5F000000, 0X00000000, 0X00000000,
+  0X3A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X7E000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X6C000000, 0X73000000, 0X78000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000300, 0X00000301, 0X00000000, 0X00000313, 0X00000308, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000002B9, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X3B00003B, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000000A8, 0X00000391, 0X000000B7,
+  0X00000395, 0X00000397, 0X00000399, 0X00000000, 0X0000039F, 0X00000000, 0X000003A5, 0X000003A9,
+  0X000003B9, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000399, 0X000003A5, 0X000003B1, 0X000003B5, 0X000003B7, 0X000003B9,
+  0X000003C5, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X75000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X000003B9, 0X000003C5, 0X000003BF, 0X000003C5, 0X000003C9, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X000003D2, 0X000003D2, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000415, 0X00000415, 0X00000000, 0X00000413, 0X00000000, 0X00000000, 0X00000000, 0X00000406,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0000041A, 0X00000418, 0X00000423, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000418, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000438, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000435, 0X00000435, 0X00000000, 0X00000433, 0X00000000, 0X00000000, 0X00000000, 0X00000456,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0000043A, 0X00000438, 0X00000443, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000474, 0X00000475,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000416, 0X00000436, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000410, 0X00000430, 0X00000410, 0X00000430, 0X00000000, 0X00000000, 0X00000415, 0X00000435,
+  0X00000000, 0X00000000, 0X000004D8, 0X000004D9, 0X00000416, 0X00000436, 0X00000417, 0X00000437,
+  0X00000000, 0X00000000, 0X00000418, 0X00000438, 0X00000418, 0X00000438, 0X0000041E, 0X0000043E,
+  0X00000000, 0X00000000, 0X000004E8, 0X000004E9, 0X0000042D, 0X0000044D, 0X00000423, 0X00000443,
+  0X00000423, 0X00000443, 0X00000423, 0X00000443, 0X00000427, 0X00000447, 0X00000000, 0X00000000,
+  0X0000042B, 0X0000044B, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000627, 0X00000627, 0X00000648, 0X00000627, 0X0000064A, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X000006D5, 0X00000000, 0X000006C1, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X000006D2, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000928, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000930, 0X00000000, 0X00000000, 0X00000933, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000915, 0X00000916, 0X00000917, 0X0000091C, 0X00000921, 0X00000922, 0X0000092B, 0X0000092F,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X000009C7, 0X000009C7, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000009A1, 0X000009A2, 0X00000000, 0X000009AF,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000A32, 0X00000000, 0X00000000, 0X00000A38, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000A16, 0X00000A17, 0X00000A1C, 0X00000000, 0X00000000, 0X00000A2B, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000B47, 0X00000000, 0X00000000, 0X00000B47, 0X00000B47, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000B21, 0X00000B22, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000B92, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000BC6, 0X00000BC7, 0X00000BC6, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000C46, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000CBF, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000CC6,
+  0X00000CC6, 0X00000000, 0X00000CC6, 0X00000CC6, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000D46, 0X00000D47, 0X00000D46, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000DD9, 0X00000000, 0X00000DD9, 0X00000DD9, 0X00000DD9, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000F42, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000F4C, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000F51, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000F56,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000F5B, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000F40, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000F71, 0X00000000, 0X00000F71, 0X00000FB2, 0X00000000,
+  0X00000FB3, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000F71, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000F92, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000F9C, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000FA1, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000FA6,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000FAB, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000F90, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00001025, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00001B05, 0X00000000,
+  0X00001B07, 0X00000000, 0X00001B09, 0X00000000, 0X00001B0B, 0X00000000, 0X00001B0D, 0X00000000,
+  0X00000000, 0X00000000, 0X00001B11, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00001B3A, 0X00000000, 0X00001B3C, 0X00000000, 0X00000000,
+  0X00001B3E, 0X00001B3F, 0X00000000, 0X00001B42, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000000, 0X00000000, 0X00000000, 0X00000000, 0X43000000, 0X44000000, 0X00000000, 0X45000000,
+  0X00000000, 0X00000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X00000000, 0X4F000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X50000000, 0X00000000, 0X00000000, 0X54000000, 0X55000000, 0X00000000, 0X00000000, 0X00000000,
+  0X56000000, 0X57000000, 0X5A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X41000000, 0X00000000, 0X42000000, 0X00000000,
+  0X44000000, 0X45000000, 0X00000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000, 0X4B000000,
+  0X4C000000, 0X4D000000, 0X4E000000, 0X00000000, 0X4F000000, 0X00000000, 0X50000000, 0X52000000,
+  0X54000000, 0X55000000, 0X57000000, 0X61000000, 0X00000000, 0X00000000, 0X00000000, 0X62000000,
+  0X64000000, 0X65000000, 0X00000000, 0X00000000, 0X00000000, 0X67000000, 0X00000000, 0X6B000000,
+  0X6D000000, 0X00000000, 0X6F000000, 0X00000000, 0X00000000, 0X00000000, 0X70000000, 0X74000000,
+  0X75000000, 0X00000000, 0X00000000, 0X76000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X69000000, 0X72000000, 0X75000000, 0X76000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X62000000, 0X64000000, 0X66000000, 0X6D000000,
+  0X6E000000, 0X70000000, 0X72000000, 0X72000000, 0X73000000, 0X74000000, 0X7A000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X70000000, 0X00000000, 0X00000000,
+  0X62000000, 0X64000000, 0X66000000, 0X67000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X70000000, 0X72000000, 0X73000000, 0X00000000, 0X76000000, 0X78000000, 0X7A000000, 0X61000000,
+  0X00000000, 0X64000000, 0X65000000, 0X00000000, 0X00000000, 0X00000000, 0X69000000, 0X00000000,
+  0X00000000, 0X75000000, 0X00000000, 0X00000000, 0X63000000, 0X00000000, 0X00000000, 0X00000000,
+  0X66000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X7A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000041, 0X61000061, 0X42000042, 0X62000062, 0X42000042, 0X62000062, 0X42000042, 0X62000062,
+  0X43000043, 0X63000063, 0X44000044, 0X64000064, 0X44000044, 0X64000064, 0X44000044, 0X64000064,
+  0X44000044, 0X64000064, 0X44000044, 0X64000064, 0X45000045, 0X65000065, 0X45000045, 0X65000065,
+  0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X46000046, 0X66000066,
+  0X47000047, 0X67000067, 0X48000048, 0X68000068, 0X48000048, 0X68000068, 0X48000048, 0X68000068,
+  0X48000048, 0X68000068, 0X48000048, 0X68000068, 0X49000049, 0X69000069, 0X49000049, 0X69000069,
+  0X4B00004B, 0X6B00006B, 0X4B00004B, 0X6B00006B, 0X4B00004B, 0X6B00006B, 0X4C00004C, 0X6C00006C,
+  0X4C00004C, 0X6C00006C, 0X4C00004C, 0X6C00006C, 0X4C00004C, 0X6C00006C, 0X4D00004D, 0X6D00006D,
+  0X4D00004D, 0X6D00006D, 0X4D00004D, 0X6D00006D, 0X4E00004E, 0X6E00006E, 0X4E00004E, 0X6E00006E,
+  0X4E00004E, 0X6E00006E, 0X4E00004E, 0X6E00006E, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X50000050, 0X70000070, 0X50000050, 0X70000070,
+  0X52000052, 0X72000072, 0X52000052, 0X72000072, 0X52000052, 0X72000072, 0X52000052, 0X72000072,
+  0X53000053, 0X73000073, 0X53000053, 0X73000073, 0X53000053, 0X73000073, 0X53000053, 0X73000073,
+  0X53000053, 0X73000073, 0X54000054, 0X74000074, 0X54000054, 0X74000074, 0X54000054, 0X74000074,
+  0X54000054, 0X74000074, 0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075,
+  0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X56000056, 0X76000076, 0X56000056, 0X76000076,
+  0X57000057, 0X77000077, 0X57000057, 0X77000077, 0X57000057, 0X77000077, 0X57000057, 0X77000077,
+  0X57000057, 0X77000077, 0X58000058, 0X78000078, 0X58000058, 0X78000078, 0X59000059, 0X79000079,
+  0X5A00005A, 0X7A00007A, 0X5A00005A, 0X7A00007A, 0X5A00005A, 0X7A00007A, 0X68000068, 0X74000074,
+  0X77000077, 0X79000079, 0X61000000, 0X7300017F, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061,
+  0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061,
+  0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061, 0X41000041, 0X61000061,
+  0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065,
+  0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065, 0X45000045, 0X65000065,
+  0X49000049, 0X69000069, 0X49000049, 0X69000069, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F,
+  0X4F00004F, 0X6F00006F, 0X4F00004F, 0X6F00006F, 0X55000055, 0X75000075, 0X55000055, 0X75000075,
+  0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075, 0X55000055, 0X75000075,
+  0X55000055, 0X75000075, 0X59000059, 0X79000079, 0X59000059, 0X79000079, 0X59000059, 0X79000079,
+  0X59000059, 0X79000079, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X59000000, 0X79000000,
+  0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1,
+  0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391,
+  0X000003B5, 0X000003B5, 0X000003B5, 0X000003B5, 0X000003B5, 0X000003B5, 0X00000000, 0X00000000,
+  0X00000395, 0X00000395, 0X00000395, 0X00000395, 0X00000395, 0X00000395, 0X00000000, 0X00000000,
+  0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7,
+  0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397,
+  0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9,
+  0X00000399, 0X00000399, 0X00000399, 0X00000399, 0X00000399, 0X00000399, 0X00000399, 0X00000399,
+  0X000003BF, 0X000003BF, 0X000003BF, 0X000003BF, 0X000003BF, 0X000003BF, 0X00000000, 0X00000000,
+  0X0000039F, 0X0000039F, 0X0000039F, 0X0000039F, 0X0000039F, 0X0000039F, 0X00000000, 0X00000000,
+  0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5,
+  0X00000000, 0X000003A5, 0X00000000, 0X000003A5, 0X00000000, 0X000003A5, 0X00000000, 0X000003A5,
+  0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9,
+  0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9,
+  0X000003B1, 0X000003B1, 0X000003B5, 0X000003B5, 0X000003B7, 0X000003B7, 0X000003B9, 0X000003B9,
+  0X000003BF, 0X000003BF, 0X000003C5, 0X000003C5, 0X000003C9, 0X000003C9, 0X00000000, 0X00000000,
+  0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1,
+  0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391,
+  0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7, 0X000003B7,
+  0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397, 0X00000397,
+  0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9, 0X000003C9,
+  0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9, 0X000003A9,
+  0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X000003B1, 0X00000000, 0X000003B1, 0X000003B1,
+  0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000391, 0X00000000, 0X000003B9, 0X00000000,
+  0X00000000, 0X000000A8, 0X000003B7, 0X000003B7, 0X000003B7, 0X00000000, 0X000003B7, 0X000003B7,
+  0X00000395, 0X00000395, 0X00000397, 0X00000397, 0X00000397, 0X00001FBF, 0X00001FBF, 0X00001FBF,
+  0X000003B9, 0X000003B9, 0X000003B9, 0X000003B9, 0X00000000, 0X00000000, 0X000003B9, 0X000003B9,
+  0X00000399, 0X00000399, 0X00000399, 0X00000399, 0X00000000, 0X00001FFE, 0X00001FFE, 0X00001FFE,
+  0X000003C5, 0X000003C5, 0X000003C5, 0X000003C5, 0X000003C1, 0X000003C1, 0X000003C5, 0X000003C5,
+  0X000003A5, 0X000003A5, 0X000003A5, 0X000003A5, 0X000003A1, 0X000000A8, 0X000000A8, 0X60000060,
+  0X00000000, 0X00000000, 0X000003C9, 0X000003C9, 0X000003C9, 0X00000000, 0X000003C9, 0X000003C9,
+  0X0000039F, 0X0000039F, 0X000003A9, 0X000003A9, 0X000003A9, 0X000000B4, 0X00000000, 0X00000000,
+  0X20002002, 0X20002003, 0X20000000, 0X20000000, 0X20000000, 0X20000000, 0X20000000, 0X20000000,
+  0X20000000, 0X20000000, 0X20000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X2D000000, 0X2D000000, 0X2D000000, 0X2D000000, 0X2D000000, 0X2D000000, 0X00000000, 0X00000000,
+  0X27000000, 0X27000000, 0X2C000000, 0X27000000, 0X22000000, 0X22000000, 0X22000000, 0X22000000,
+  0X2B000000, 0X00000000, 0X6F000000, 0X00000000, 0X2E000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X20000000,
+  0X00000000, 0X00000000, 0X27000000, 0X22000000, 0X00000000, 0X60000000, 0X00000000, 0X00000000,
+  0X00000000, 0X3C000000, 0X3E000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2F000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X20000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X30000000, 0X69000000, 0X00000000, 0X00000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000,
+  0X38000000, 0X39000000, 0X2B000000, 0X00000000, 0X3D000000, 0X28000000, 0X29000000, 0X6E000000,
+  0X30000000, 0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000,
+  0X38000000, 0X39000000, 0X2B000000, 0X00000000, 0X3D000000, 0X28000000, 0X29000000, 0X00000000,
+  0X61000000, 0X65000000, 0X6F000000, 0X78000000, 0X00000000, 0X68000000, 0X6B000000, 0X6C000000,
+  0X6D000000, 0X6E000000, 0X70000000, 0X73000000, 0X74000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X43000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X67000000, 0X48000000, 0X48000000, 0X48000000, 0X68000000, 0X00000000,
+  0X49000000, 0X49000000, 0X4C000000, 0X6C000000, 0X00000000, 0X4E000000, 0X00000000, 0X00000000,
+  0X00000000, 0X50000000, 0X51000000, 0X52000000, 0X52000000, 0X52000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X5A000000, 0X00000000, 0X000003A9, 0X00000000,
+  0X5A000000, 0X00000000, 0X4B00004B, 0X41000041, 0X42000000, 0X43000000, 0X00000000, 0X65000000,
+  0X45000000, 0X46000000, 0X00000000, 0X4D000000, 0X6F000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X69000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X44000000, 0X64000000, 0X65000000,
+  0X69000000, 0X6A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X49000000, 0X00000000, 0X00000000, 0X00000000, 0X56000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X58000000, 0X00000000, 0X00000000, 0X4C000000, 0X43000000, 0X44000000, 0X4D000000,
+  0X69000000, 0X00000000, 0X00000000, 0X00000000, 0X76000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X78000000, 0X00000000, 0X00000000, 0X6C000000, 0X63000000, 0X64000000, 0X6D000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00002190, 0X00002192, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00002194, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000021D0, 0X000021D4, 0X000021D2,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00002203, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00002208, 0X00000000, 0X00000000, 0X0000220B, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X2D000000, 0X00000000, 0X00000000, 0X2F000000, 0X5C000000, 0X2A000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X7C000000, 0X00002223, 0X00000000, 0X00002225, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X3A000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X7E000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X0000223C, 0X00000000, 0X00000000, 0X00002243, 0X00000000, 0X00000000, 0X00002245,
+  0X00000000, 0X00002248, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X3D00003D, 0X00000000, 0X00002261, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0000224D, 0X3C00003C, 0X3E00003E,
+  0X00002264, 0X00002265, 0X00000000, 0X00000000, 0X00002272, 0X00002273, 0X00000000, 0X00000000,
+  0X00002276, 0X00002277, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X0000227A, 0X0000227B, 0X00000000, 0X00000000, 0X00002282, 0X00002283, 0X00000000, 0X00000000,
+  0X00002286, 0X00002287, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000022A2, 0X000022A8, 0X000022A9, 0X000022AB,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X0000227C, 0X0000227D, 0X00002291, 0X00002292, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X000022B2, 0X000022B3, 0X000022B4, 0X000022B5, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X3C003008, 0X3E003009, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000, 0X38000000,
+  0X39000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X41000000, 0X42000000,
+  0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000,
+  0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X52000000,
+  0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000,
+  0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X68000000,
+  0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000,
+  0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000,
+  0X79000000, 0X7A000000, 0X30000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X2D000000, 0X00000000, 0X7C000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X2B000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X2B000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X2B000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X6F000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X3C000000, 0X3E000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00002ADD, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X4C000000, 0X6C000000, 0X4C000000, 0X50000000, 0X52000000, 0X61000000, 0X74000000, 0X48000000,
+  0X68000000, 0X4B000000, 0X6B000000, 0X5A000000, 0X7A000000, 0X00000000, 0X4D000000, 0X00000000,
+  0X00000000, 0X76000000, 0X57000000, 0X77000000, 0X76000000, 0X00000000, 0X00000000, 0X00000000,
+  0X65000000, 0X00000000, 0X6F000000, 0X00000000, 0X6A000000, 0X56000000, 0X53000000, 0X5A000000,
+  0X20000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X3C000000, 0X3E000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0000304B, 0X00000000, 0X0000304D, 0X00000000,
+  0X0000304F, 0X00000000, 0X00003051, 0X00000000, 0X00003053, 0X00000000, 0X00003055, 0X00000000,
+  0X00003057, 0X00000000, 0X00003059, 0X00000000, 0X0000305B, 0X00000000, 0X0000305D, 0X00000000,
+  0X0000305F, 0X00000000, 0X00003061, 0X00000000, 0X00000000, 0X00003064, 0X00000000, 0X00003066,
+  0X00000000, 0X00003068, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X0000306F, 0X0000306F, 0X00000000, 0X00003072, 0X00003072, 0X00000000, 0X00003075, 0X00003075,
+  0X00000000, 0X00003078, 0X00003078, 0X00000000, 0X0000307B, 0X0000307B, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00003046, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0000309D, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000030AB, 0X00000000, 0X000030AD, 0X00000000,
+  0X000030AF, 0X00000000, 0X000030B1, 0X00000000, 0X000030B3, 0X00000000, 0X000030B5, 0X00000000,
+  0X000030B7, 0X00000000, 0X000030B9, 0X00000000, 0X000030BB, 0X00000000, 0X000030BD, 0X00000000,
+  0X000030BF, 0X00000000, 0X000030C1, 0X00000000, 0X00000000, 0X000030C4, 0X00000000, 0X000030C6,
+  0X00000000, 0X000030C8, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X000030CF, 0X000030CF, 0X00000000, 0X000030D2, 0X000030D2, 0X00000000, 0X000030D5, 0X000030D5,
+  0X00000000, 0X000030D8, 0X000030D8, 0X00000000, 0X000030DB, 0X000030DB, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000030A6, 0X00000000, 0X00000000, 0X000030EF,
+  0X000030F0, 0X000030F1, 0X000030F2, 0X00000000, 0X00000000, 0X00000000, 0X000030FD, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X46000000, 0X53000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X4B000000, 0X6B000000, 0X4B000000, 0X6B000000, 0X4B000000, 0X6B000000, 0X00000000, 0X00000000,
+  0X4C000000, 0X6C000000, 0X4F000000, 0X6F000000, 0X4F000000, 0X6F000000, 0X00000000, 0X00000000,
+  0X50000000, 0X70000000, 0X50000000, 0X70000000, 0X50000000, 0X70000000, 0X51000000, 0X71000000,
+  0X51000000, 0X71000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X56000000, 0X76000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X6C000000, 0X00000000,
+  0X4E000000, 0X6E000000, 0X43000000, 0X63000000, 0X63000000, 0X68000000, 0X42000000, 0X62000000,
+  0X46000000, 0X66000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X47000000, 0X67000000, 0X4B000000, 0X6B000000, 0X4E000000, 0X6E000000, 0X52000000, 0X72000000,
+  0X53000000, 0X73000000, 0X48000000, 0X00000000, 0X00000000, 0X4C000000, 0X00000000, 0X51000000,
+  0X00000000, 0X00000000, 0X4A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X55000000, 0X75000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X43000000, 0X53000000, 0X5A000000, 0X44000000,
+  0X64000000, 0X53000000, 0X73000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X43000000, 0X46000000, 0X51000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X65000000, 0X00000000, 0X00000000, 0X6C000000,
+  0X6C000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X52000000, 0X00000000,
+  0X00000000, 0X72000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X75000000, 0X00000000,
+  0X00000000, 0X00000000, 0X75000000, 0X00000000, 0X00000000, 0X00000000, 0X78000000, 0X78000000,
+  0X78000000, 0X78000000, 0X79000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001100,
+  0X00001100, 0X00001100, 0X00001100, 0X00001100, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101, 0X00001101,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001102,
+  0X00001102, 0X00001102, 0X00001102, 0X00001102, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103, 0X00001103,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001104,
+  0X00001104, 0X00001104, 0X00001104, 0X00001104, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105, 0X00001105,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001106,
+  0X00001106, 0X00001106, 0X00001106, 0X00001106, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107, 0X00001107,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001108,
+  0X00001108, 0X00001108, 0X00001108, 0X00001108, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109, 0X00001109,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A,
+  0X0000110A, 0X0000110A, 0X0000110A, 0X0000110A, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B, 0X0000110B,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C,
+  0X0000110C, 0X0000110C, 0X0000110C, 0X0000110C, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D, 0X0000110D,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E,
+  0X0000110E, 0X0000110E, 0X0000110E, 0X0000110E, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F, 0X0000110F,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001110,
+  0X00001110, 0X00001110, 0X00001110, 0X00001110, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111, 0X00001111,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00001112,
+  0X00001112, 0X00001112, 0X00001112, 0X00001112, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00008C48, 0X000066F4, 0X00008ECA, 0X00008CC8, 0X00006ED1, 0X00004E32, 0X000053E5, 0X00009F9C,
+  0X00009F9C, 0X00005951, 0X000091D1, 0X00005587, 0X00005948, 0X000061F6, 0X00007669, 0X00007F85,
+  0X0000863F, 0X000087BA, 0X000088F8, 0X0000908F, 0X00006A02, 0X00006D1B, 0X000070D9, 0X000073DE,
+  0X0000843D, 0X0000916A, 0X000099F1, 0X00004E82, 0X00005375, 0X00006B04, 0X0000721B, 0X0000862D,
+  0X00009E1E, 0X00005D50, 0X00006FEB, 0X000085CD, 0X00008964, 0X000062C9, 0X000081D8, 0X0000881F,
+  0X00005ECA, 0X00006717, 0X00006D6A, 0X000072FC, 0X000090CE, 0X00004F86, 0X000051B7, 0X000052DE,
+  0X000064C4, 0X00006AD3, 0X00007210, 0X000076E7, 0X00008001, 0X00008606, 0X0000865C, 0X00008DEF,
+  0X00009732, 0X00009B6F, 0X00009DFA, 0X0000788C, 0X0000797F, 0X00007DA0, 0X000083C9, 0X00009304,
+  0X00009E7F, 0X00008AD6, 0X000058DF, 0X00005F04, 0X00007C60, 0X0000807E, 0X00007262, 0X000078CA,
+  0X00008CC2, 0X000096F7, 0X000058D8, 0X00005C62, 0X00006A13, 0X00006DDA, 0X00006F0F, 0X00007D2F,
+  0X00007E37, 0X0000964B, 0X000052D2, 0X0000808B, 0X000051DC, 0X000051CC, 0X00007A1C, 0X00007DBE,
+  0X000083F1, 0X00009675, 0X00008B80, 0X000062CF, 0X00006A02, 0X00008AFE, 0X00004E39, 0X00005BE7,
+  0X00006012, 0X00007387, 0X00007570, 0X00005317, 0X000078FB, 0X00004FBF, 0X00005FA9, 0X00004E0D,
+  0X00006CCC, 0X00006578, 0X00007D22, 0X000053C3, 0X0000585E, 0X00007701, 0X00008449, 0X00008AAA,
+  0X00006BBA, 0X00008FB0, 0X00006C88, 0X000062FE, 0X000082E5, 0X000063A0, 0X00007565, 0X00004EAE,
+  0X00005169, 0X000051C9, 0X00006881, 0X00007CE7, 0X0000826F, 0X00008AD2, 0X000091CF, 0X000052F5,
+  0X00005442, 0X00005973, 0X00005EEC, 0X000065C5, 0X00006FFE, 0X0000792A, 0X000095AD, 0X00009A6A,
+  0X00009E97, 0X00009ECE, 0X0000529B, 0X000066C6, 0X00006B77, 0X00008F62, 0X00005E74, 0X00006190,
+  0X00006200, 0X0000649A, 0X00006F23, 0X00007149, 0X00007489, 0X000079CA, 0X00007DF4, 0X0000806F,
+  0X00008F26, 0X000084EE, 0X00009023, 0X0000934A, 0X00005217, 0X000052A3, 0X000054BD, 0X000070C8,
+  0X000088C2, 0X00008AAA, 0X00005EC9, 0X00005FF5, 0X0000637B, 0X00006BAE, 0X00007C3E, 0X00007375,
+  0X00004EE4, 0X000056F9, 0X00005BE7, 0X00005DBA, 0X0000601C, 0X000073B2, 0X00007469, 0X00007F9A,
+  0X00008046, 0X00009234, 0X000096F6, 0X00009748, 0X00009818, 0X00004F8B, 0X000079AE, 0X000091B4,
+  0X000096B8, 0X000060E1, 0X00004E86, 0X000050DA, 0X00005BEE, 0X00005C3F, 0X00006599, 0X00006A02,
+  0X000071CE, 0X00007642, 0X000084FC, 0X0000907C, 0X00009F8D, 0X00006688, 0X0000962E, 0X00005289,
+  0X0000677B, 0X000067F3, 0X00006D41, 0X00006E9C, 0X00007409, 0X00007559, 0X0000786B, 0X00007D10,
+  0X0000985E, 0X0000516D, 0X0000622E, 0X00009678, 0X0000502B, 0X00005D19, 0X00006DEA, 0X00008F2A,
+  0X00005F8B, 0X00006144, 0X00006817, 0X00007387, 0X00009686, 0X00005229, 0X0000540F, 0X00005C65,
+  0X00006613, 0X0000674E, 0X000068A8, 0X00006CE5, 0X00007406, 0X000075E2, 0X00007F79, 0X000088CF,
+  0X000088E1, 0X000091CC, 0X000096E2, 0X0000533F, 0X00006EBA, 0X0000541D, 0X000071D0, 0X00007498,
+  0X000085FA, 0X000096A3, 0X00009C57, 0X00009E9F, 0X00006797, 0X00006DCB, 0X000081E8, 0X00007ACB,
+  0X00007B20, 0X00007C92, 0X000072C0, 0X00007099, 0X00008B58, 0X00004EC0, 0X00008336, 0X0000523A,
+  0X00005207, 0X00005EA6, 0X000062D3, 0X00007CD6, 0X00005B85, 0X00006D1E, 0X000066B4, 0X00008F3B,
+  0X0000884C, 0X0000964D, 0X0000898B, 0X00005ED3, 0X00005140, 0X000055C0, 0X00000000, 0X00000000,
+  0X0000585A, 0X00000000, 0X00006674, 0X00000000, 0X00000000, 0X000051DE, 0X0000732A, 0X000076CA,
+  0X0000793C, 0X0000795E, 0X00007965, 0X0000798F, 0X00009756, 0X00007CBE, 0X00007FBD, 0X00000000,
+  0X00008612, 0X00000000, 0X00008AF8, 0X00000000, 0X00000000, 0X00009038, 0X000090FD, 0X00000000,
+  0X00000000, 0X00000000, 0X000098EF, 0X000098FC, 0X00009928, 0X00009DB4, 0X000090DE, 0X000096B7,
+  0X00004FAE, 0X000050E7, 0X0000514D, 0X000052C9, 0X000052E4, 0X00005351, 0X0000559D, 0X00005606,
+  0X00005668, 0X00005840, 0X000058A8, 0X00005C64, 0X00005C6E, 0X00006094, 0X00006168, 0X0000618E,
+  0X000061F2, 0X0000654F, 0X000065E2, 0X00006691, 0X00006885, 0X00006D77, 0X00006E1A, 0X00006F22,
+  0X0000716E, 0X0000722B, 0X00007422, 0X00007891, 0X0000793E, 0X00007949, 0X00007948, 0X00007950,
+  0X00007956, 0X0000795D, 0X0000798D, 0X0000798E, 0X00007A40, 0X00007A81, 0X00007BC0, 0X00007DF4,
+  0X00007E09, 0X00007E41, 0X00007F72, 0X00008005, 0X000081ED, 0X00008279, 0X00008279, 0X00008457,
+  0X00008910, 0X00008996, 0X00008B01, 0X00008B39, 0X00008CD3, 0X00008D08, 0X00008FB6, 0X00009038,
+  0X000096E3, 0X000097FF, 0X0000983B, 0X00006075, 0X000242EE, 0X00008218, 0X00000000, 0X00000000,
+  0X00004E26, 0X000051B5, 0X00005168, 0X00004F80, 0X00005145, 0X00005180, 0X000052C7, 0X000052FA,
+  0X0000559D, 0X00005555, 0X00005599, 0X000055E2, 0X0000585A, 0X000058B3, 0X00005944, 0X00005954,
+  0X00005A62, 0X00005B28, 0X00005ED2, 0X00005ED9, 0X00005F69, 0X00005FAD, 0X000060D8, 0X0000614E,
+  0X00006108, 0X0000618E, 0X00006160, 0X000061F2, 0X00006234, 0X000063C4, 0X0000641C, 0X00006452,
+  0X00006556, 0X00006674, 0X00006717, 0X0000671B, 0X00006756, 0X00006B79, 0X00006BBA, 0X00006D41,
+  0X00006EDB, 0X00006ECB, 0X00006F22, 0X0000701E, 0X0000716E, 0X000077A7, 0X00007235, 0X000072AF,
+  0X0000732A, 0X00007471, 0X00007506, 0X0000753B, 0X0000761D, 0X0000761F, 0X000076CA, 0X000076DB,
+  0X000076F4, 0X0000774A, 0X00007740, 0X000078CC, 0X00007AB1, 0X00007BC0, 0X00007C7B, 0X00007D5B,
+  0X00007DF4, 0X00007F3E, 0X00008005, 0X00008352, 0X000083EF, 0X00008779, 0X00008941, 0X00008986,
+  0X00008996, 0X00008ABF, 0X00008AF8, 0X00008ACB, 0X00008B01, 0X00008AFE, 0X00008AED, 0X00008B39,
+  0X00008B8A, 0X00008D08, 0X00008F38, 0X00009072, 0X00009199, 0X00009276, 0X0000967C, 0X000096E3,
+  0X00009756, 0X000097DB, 0X000097FF, 0X0000980B, 0X0000983B, 0X00009B12, 0X00009F9C, 0X0002284A,
+  0X00022844, 0X000233D5, 0X00003B9D, 0X00004018, 0X00004039, 0X00025249, 0X00025CD0, 0X00027ED3,
+  0X00009F43, 0X00009F8E, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X000005D9, 0X00000000, 0X000005F2,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X2B000000, 0X000005E9, 0X000005E9, 0X000005E9, 0X000005E9, 0X000005D0, 0X000005D0,
+  0X000005D0, 0X000005D1, 0X000005D2, 0X000005D3, 0X000005D4, 0X000005D5, 0X000005D6, 0X00000000,
+  0X000005D8, 0X000005D9, 0X000005DA, 0X000005DB, 0X000005DC, 0X00000000, 0X000005DE, 0X00000000,
+  0X000005E0, 0X000005E1, 0X00000000, 0X000005E3, 0X000005E4, 0X00000000, 0X000005E6, 0X000005E7,
+  0X000005E8, 0X000005E9, 0X000005EA, 0X000005D5, 0X000005D1, 0X000005DB, 0X000005E4, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X2C000000, 0X00000000, 0X00000000, 0X3A000000, 0X3B000000, 0X21000000, 0X3F000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X5F000000, 0X5F000000, 0X28000000, 0X29000000, 0X7B000000,
+  0X7D000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X5B000000,
+  0X5D000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X5F000000, 0X5F000000, 0X5F000000,
+  0X2C000000, 0X00000000, 0X2E000000, 0X00000000, 0X3B000000, 0X3A000000, 0X3F000000, 0X21000000,
+  0X00000000, 0X28000000, 0X29000000, 0X7B000000, 0X7D000000, 0X00000000, 0X00000000, 0X23000000,
+  0X26000000, 0X2A000000, 0X2B000000, 0X2D000000, 0X3C000000, 0X3E000000, 0X3D000000, 0X00000000,
+  0X5C000000, 0X24000000, 0X25000000, 0X40000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X21000000, 0X22000000, 0X23000000, 0X24000000, 0X25000000, 0X26000000, 0X27000000,
+  0X28000000, 0X29000000, 0X2A000000, 0X2B000000, 0X2C000000, 0X2D000000, 0X2E000000, 0X2F000000,
+  0X30000000, 0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000,
+  0X38000000, 0X39000000, 0X3A000000, 0X3B000000, 0X3C000000, 0X3D000000, 0X3E000000, 0X3F000000,
+  0X40000000, 0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000,
+  0X48000000, 0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000,
+  0X50000000, 0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000,
+  0X58000000, 0X59000000, 0X5A000000, 0X5B000000, 0X5C000000, 0X5D000000, 0X5E000000, 0X5F000000,
+  0X60000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000,
+  0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000,
+  0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000,
+  0X78000000, 0X79000000, 0X7A000000, 0X7B000000, 0X7C000000, 0X7D000000, 0X7E000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X71000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00011099, 0X00000000, 0X0001109B, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X000110A5, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00011131, 0X00011132,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00011347, 0X00011347, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X000114B9, 0X000114B9, 0X00000000, 0X000114B9, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X000115B8, 0X000115B9, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00011935, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X0001D157, 0X0001D158,
+  0X0001D158, 0X0001D158, 0X0001D158, 0X0001D158, 0X0001D158, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X0001D1B9, 0X0001D1BA, 0X0001D1B9, 0X0001D1BA, 0X0001D1B9,
+  0X0001D1BA, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X42000000, 0X43000000, 0X44000000,
+  0X45000000, 0X46000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000, 0X4B000000, 0X4C000000,
+  0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X52000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X00000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X00000000, 0X43000000, 0X44000000,
+  0X00000000, 0X00000000, 0X47000000, 0X00000000, 0X00000000, 0X4A000000, 0X4B000000, 0X00000000,
+  0X00000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X00000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X00000000, 0X66000000, 0X00000000, 0X68000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X00000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X42000000, 0X00000000, 0X44000000,
+  0X45000000, 0X46000000, 0X47000000, 0X00000000, 0X00000000, 0X4A000000, 0X4B000000, 0X4C000000,
+  0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X00000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X00000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X68000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X00000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X00000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X00000000, 0X4F000000, 0X00000000,
+  0X00000000, 0X00000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X00000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X42000000, 0X43000000, 0X44000000,
+  0X45000000, 0X46000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000, 0X4B000000, 0X4C000000,
+  0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X52000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X68000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X42000000, 0X43000000, 0X44000000,
+  0X45000000, 0X46000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000, 0X4B000000, 0X4C000000,
+  0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X52000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X68000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X41000000, 0X42000000, 0X43000000, 0X44000000,
+  0X45000000, 0X46000000, 0X47000000, 0X48000000, 0X49000000, 0X4A000000, 0X4B000000, 0X4C000000,
+  0X4D000000, 0X4E000000, 0X4F000000, 0X50000000, 0X51000000, 0X52000000, 0X53000000, 0X54000000,
+  0X55000000, 0X56000000, 0X57000000, 0X58000000, 0X59000000, 0X5A000000, 0X61000000, 0X62000000,
+  0X63000000, 0X64000000, 0X65000000, 0X66000000, 0X67000000, 0X68000000, 0X69000000, 0X6A000000,
+  0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000, 0X6F000000, 0X70000000, 0X71000000, 0X72000000,
+  0X73000000, 0X74000000, 0X75000000, 0X76000000, 0X77000000, 0X78000000, 0X79000000, 0X7A000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X61000000, 0X62000000, 0X63000000, 0X64000000, 0X65000000, 0X66000000,
+  0X67000000, 0X68000000, 0X69000000, 0X6A000000, 0X6B000000, 0X6C000000, 0X6D000000, 0X6E000000,
+  0X6F000000, 0X70000000, 0X71000000, 0X72000000, 0X73000000, 0X74000000, 0X75000000, 0X76000000,
+  0X77000000, 0X78000000, 0X79000000, 0X7A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X30000000, 0X31000000,
+  0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000, 0X38000000, 0X39000000,
+  0X30000000, 0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000,
+  0X38000000, 0X39000000, 0X30000000, 0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000,
+  0X36000000, 0X37000000, 0X38000000, 0X39000000, 0X30000000, 0X31000000, 0X32000000, 0X33000000,
+  0X34000000, 0X35000000, 0X36000000, 0X37000000, 0X38000000, 0X39000000, 0X30000000, 0X31000000,
+  0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000, 0X38000000, 0X39000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X4C000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X74000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X6C000000, 0X00000000, 0X6C000000, 0X00000000, 0X00000000, 0X72000000, 0X00000000,
+  0X00000000, 0X00000000, 0X69000000, 0X6F000000, 0X00000000, 0X63000000, 0X73000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X43000000, 0X52000000, 0X00000000, 0X00000000, 0X00000000,
+  0X41000000, 0X42000000, 0X43000000, 0X44000000, 0X45000000, 0X46000000, 0X47000000, 0X48000000,
+  0X49000000, 0X4A000000, 0X4B000000, 0X4C000000, 0X4D000000, 0X4E000000, 0X4F000000, 0X50000000,
+  0X51000000, 0X52000000, 0X53000000, 0X54000000, 0X55000000, 0X56000000, 0X57000000, 0X58000000,
+  0X59000000, 0X5A000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X30000000, 0X31000000, 0X32000000, 0X33000000, 0X34000000, 0X35000000, 0X36000000, 0X37000000,
+  0X38000000, 0X39000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00004E3D, 0X00004E38, 0X00004E41, 0X00020122, 0X00004F60, 0X00004FAE, 0X00004FBB, 0X00005002,
+  0X0000507A, 0X00005099, 0X000050E7, 0X000050CF, 0X0000349E, 0X0002063A, 0X0000514D, 0X00005154,
+  0X00005164, 0X00005177, 0X0002051C, 0X000034B9, 0X00005167, 0X0000518D, 0X0002054B, 0X00005197,
+  0X000051A4, 0X00004ECC, 0X000051AC, 0X000051B5, 0X000291DF, 0X000051F5, 0X00005203, 0X000034DF,
+  0X0000523B, 0X00005246, 0X00005272, 0X00005277, 0X00003515, 0X000052C7, 0X000052C9, 0X000052E4,
+  0X000052FA, 0X00005305, 0X00005306, 0X00005317, 0X00005349, 0X00005351, 0X0000535A, 0X00005373,
+  0X0000537D, 0X0000537F, 0X0000537F, 0X0000537F, 0X00020A2C, 0X00007070, 0X000053CA, 0X000053DF,
+  0X00020B63, 0X000053EB, 0X000053F1, 0X00005406, 0X0000549E, 0X00005438, 0X00005448, 0X00005468,
+  0X000054A2, 0X000054F6, 0X00005510, 0X00005553, 0X00005563, 0X00005584, 0X00005584, 0X00005599,
+  0X000055AB, 0X000055B3, 0X000055C2, 0X00005716, 0X00005606, 0X00005717, 0X00005651, 0X00005674,
+  0X00005207, 0X000058EE, 0X000057CE, 0X000057F4, 0X0000580D, 0X0000578B, 0X00005832, 0X00005831,
+  0X000058AC, 0X000214E4, 0X000058F2, 0X000058F7, 0X00005906, 0X0000591A, 0X00005922, 0X00005962,
+  0X000216A8, 0X000216EA, 0X000059EC, 0X00005A1B, 0X00005A27, 0X000059D8, 0X00005A66, 0X000036EE,
+  0X000036FC, 0X00005B08, 0X00005B3E, 0X00005B3E, 0X000219C8, 0X00005BC3, 0X00005BD8, 0X00005BE7,
+  0X00005BF3, 0X00021B18, 0X00005BFF, 0X00005C06, 0X00005F53, 0X00005C22, 0X00003781, 0X00005C60,
+  0X00005C6E, 0X00005CC0, 0X00005C8D, 0X00021DE4, 0X00005D43, 0X00021DE6, 0X00005D6E, 0X00005D6B,
+  0X00005D7C, 0X00005DE1, 0X00005DE2, 0X0000382F, 0X00005DFD, 0X00005E28, 0X00005E3D, 0X00005E69,
+  0X00003862, 0X00022183, 0X0000387C, 0X00005EB0, 0X00005EB3, 0X00005EB6, 0X00005ECA, 0X0002A392,
+  0X00005EFE, 0X00022331, 0X00022331, 0X00008201, 0X00005F22, 0X00005F22, 0X000038C7, 0X000232B8,
+  0X000261DA, 0X00005F62, 0X00005F6B, 0X000038E3, 0X00005F9A, 0X00005FCD, 0X00005FD7, 0X00005FF9,
+  0X00006081, 0X0000393A, 0X0000391C, 0X00006094, 0X000226D4, 0X000060C7, 0X00006148, 0X0000614C,
+  0X0000614E, 0X0000614C, 0X0000617A, 0X0000618E, 0X000061B2, 0X000061A4, 0X000061AF, 0X000061DE,
+  0X000061F2, 0X000061F6, 0X00006210, 0X0000621B, 0X0000625D, 0X000062B1, 0X000062D4, 0X00006350,
+  0X00022B0C, 0X0000633D, 0X000062FC, 0X00006368, 0X00006383, 0X000063E4, 0X00022BF1, 0X00006422,
+  0X000063C5, 0X000063A9, 0X00003A2E, 0X00006469, 0X0000647E, 0X0000649D, 0X00006477, 0X00003A6C,
+  0X0000654F, 0X0000656C, 0X0002300A, 0X000065E3, 0X000066F8, 0X00006649, 0X00003B19, 0X00006691,
+  0X00003B08, 0X00003AE4, 0X00005192, 0X00005195, 0X00006700, 0X0000669C, 0X000080AD, 0X000043D9,
+  0X00006717, 0X0000671B, 0X00006721, 0X0000675E, 0X00006753, 0X000233C3, 0X00003B49, 0X000067FA,
+  0X00006785, 0X00006852, 0X00006885, 0X0002346D, 0X0000688E, 0X0000681F, 0X00006914, 0X00003B9D,
+  0X00006942, 0X000069A3, 0X000069EA, 0X00006AA8, 0X000236A3, 0X00006ADB, 0X00003C18, 0X00006B21,
+  0X000238A7, 0X00006B54, 0X00003C4E, 0X00006B72, 0X00006B9F, 0X00006BBA, 0X00006BBB, 0X00023A8D,
+  0X00021D0B, 0X00023AFA, 0X00006C4E, 0X00023CBC, 0X00006CBF, 0X00006CCD, 0X00006C67, 0X00006D16,
+  0X00006D3E, 0X00006D77, 0X00006D41, 0X00006D69, 0X00006D78, 0X00006D85, 0X00023D1E, 0X00006D34,
+  0X00006E2F, 0X00006E6E, 0X00003D33, 0X00006ECB, 0X00006EC7, 0X00023ED1, 0X00006DF9, 0X00006F6E,
+  0X00023F5E, 0X00023F8E, 0X00006FC6, 0X00007039, 0X0000701E, 0X0000701B, 0X00003D96, 0X0000704A,
+  0X0000707D, 0X00007077, 0X000070AD, 0X00020525, 0X00007145, 0X00024263, 0X0000719C, 0X000243AB,
+  0X00007228, 0X00007235, 0X00007250, 0X00024608, 0X00007280, 0X00007295, 0X00024735, 0X00024814,
+  0X0000737A, 0X0000738B, 0X00003EAC, 0X000073A5, 0X00003EB8, 0X00003EB8, 0X00007447, 0X0000745C,
+  0X00007471, 0X00007485, 0X000074CA, 0X00003F1B, 0X00007524, 0X00024C36, 0X0000753E, 0X00024C92,
+  0X00007570, 0X0002219F, 0X00007610, 0X00024FA1, 0X00024FB8, 0X00025044, 0X00003FFC, 0X00004008,
+  0X000076F4, 0X000250F3, 0X000250F2, 0X00025119, 0X00025133, 0X0000771E, 0X0000771F, 0X0000771F,
+  0X0000774A, 0X00004039, 0X0000778B, 0X00004046, 0X00004096, 0X0002541D, 0X0000784E, 0X0000788C,
+  0X000078CC, 0X000040E3, 0X00025626, 0X00007956, 0X0002569A, 0X000256C5, 0X0000798F, 0X000079EB,
+  0X0000412F, 0X00007A40, 0X00007A4A, 0X00007A4F, 0X0002597C, 0X00025AA7, 0X00025AA7, 0X00007AEE,
+  0X00004202, 0X00025BAB, 0X00007BC6, 0X00007BC9, 0X00004227, 0X00025C80, 0X00007CD2, 0X000042A0,
+  0X00007CE8, 0X00007CE3, 0X00007D00, 0X00025F86, 0X00007D63, 0X00004301, 0X00007DC7, 0X00007E02,
+  0X00007E45, 0X00004334, 0X00026228, 0X00026247, 0X00004359, 0X000262D9, 0X00007F7A, 0X0002633E,
+  0X00007F95, 0X00007FFA, 0X00008005, 0X000264DA, 0X00026523, 0X00008060, 0X000265A8, 0X00008070,
+  0X0002335F, 0X000043D5, 0X000080B2, 0X00008103, 0X0000440B, 0X0000813E, 0X00005AB5, 0X000267A7,
+  0X000267B5, 0X00023393, 0X0002339C, 0X00008201, 0X00008204, 0X00008F9E, 0X0000446B, 0X00008291,
+  0X0000828B, 0X0000829D, 0X000052B3, 0X000082B1, 0X000082B3, 0X000082BD, 0X000082E6, 0X00026B3C,
+  0X000082E5, 0X0000831D, 0X00008363, 0X000083AD, 0X00008323, 0X000083BD, 0X000083E7, 0X00008457,
+  0X00008353, 0X000083CA, 0X000083CC, 0X000083DC, 0X00026C36, 0X00026D6B, 0X00026CD5, 0X0000452B,
+  0X000084F1, 0X000084F3, 0X00008516, 0X000273CA, 0X00008564, 0X00026F2C, 0X0000455D, 0X00004561,
+  0X00026FB1, 0X000270D2, 0X0000456B, 0X00008650, 0X0000865C, 0X00008667, 0X00008669, 0X000086A9,
+  0X00008688, 0X0000870E, 0X000086E2, 0X00008779, 0X00008728, 0X0000876B, 0X00008786, 0X000045D7,
+  0X000087E1, 0X00008801, 0X000045F9, 0X00008860, 0X00008863, 0X00027667, 0X000088D7, 0X000088DE,
+  0X00004635, 0X000088FA, 0X000034BB, 0X000278AE, 0X00027966, 0X000046BE, 0X000046C7, 0X00008AA0,
+  0X00008AED, 0X00008B8A, 0X00008C55, 0X00027CA8, 0X00008CAB, 0X00008CC1, 0X00008D1B, 0X00008D77,
+  0X00027F2F, 0X00020804, 0X00008DCB, 0X00008DBC, 0X00008DF0, 0X000208DE, 0X00008ED4, 0X00008F38,
+  0X000285D2, 0X000285ED, 0X00009094, 0X000090F1, 0X00009111, 0X0002872E, 0X0000911B, 0X00009238,
+  0X000092D7, 0X000092D8, 0X0000927C, 0X000093F9, 0X00009415, 0X00028BFA, 0X0000958B, 0X00004995,
+  0X000095B7, 0X00028D77, 0X000049E6, 0X000096C3, 0X00005DB2, 0X00009723, 0X00029145, 0X0002921A,
+  0X00004A6E, 0X00004A76, 0X000097E0, 0X0002940A, 0X00004AB2, 0X00029496, 0X0000980B, 0X0000980B,
+  0X00009829, 0X000295B6, 0X000098E2, 0X00004B33, 0X00009929, 0X000099A7, 0X000099C2, 0X000099FE,
+  0X00004BCE, 0X00029B30, 0X00009B12, 0X00009C40, 0X00009CFD, 0X00004CCE, 0X00004CED, 0X00009D67,
+  0X0002A0CE, 0X00004CF8, 0X0002A105, 0X0002A20E, 0X0002A291, 0X00009EBB, 0X00004D56, 0X00009EF9,
+  0X00009EFE, 0X00009F05, 0X00009F0F, 0X00009F16, 0X00009F3B, 0X0002A600, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+  0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000, 0X00000000,
+};
+
@@ -37,6 +37,7 @@
 #include "brl_dots.h"
 #include "spk.h"
 #include "scr.h"
+#include "scr_history.h"
 #include "scr_special.h"
 #include "scr_utils.h"
 #include "prefs.h"
@@ -230,28 +231,27 @@ getScreenCursorPosition (int x, int y) {
   return position;
 }
 
-static void
-overlayAttributesUnderline (unsigned char *cell, unsigned char attributes) {
-  unsigned char dots;
-
+static unsigned char
+getAttributesUnderlineDots (unsigned char attributes) {
   switch (attributes) {
     case SCR_COLOUR_FG_DARK_GREY | SCR_COLOUR_BG_BLACK:
     case SCR_COLOUR_FG_LIGHT_GREY | SCR_COLOUR_BG_BLACK:
     case SCR_COLOUR_FG_LIGHT_GREY | SCR_COLOUR_BG_BLUE:
     case SCR_COLOUR_FG_BLACK | SCR_COLOUR_BG_CYAN:
-      return;
+      return 0;
 
     case SCR_COLOUR_FG_BLACK | SCR_COLOUR_BG_LIGHT_GREY:
-      dots = BRL_DOT_7 | BRL_DOT_8;
-      break;
+      return BRL_DOT_7 | BRL_DOT_8;
 
     case SCR_COLOUR_FG_WHITE | SCR_COLOUR_BG_BLACK:
     default:
-      dots = BRL_DOT_8;
-      break;
+      return BRL_DOT_8;
   }
+}
 
-  {
+static void
+overlayUnderlineDots (unsigned char *cell, unsigned char dots) {
+  if (dots) {
     BlinkDescriptor *blink = &attributesUnderlineBlinkDescriptor;
 
     requireBlinkDescriptor(blink);
@@ -259,6 +259,11 @@ overlayAttributesUnderline (unsigned char *cell, unsigned char attributes) {
   }
 }
 
+static void
+overlayAttributesUnderline (unsigned char *cell, unsigned char attributes) {
+  overlayUnderlineDots(cell, getAttributesUnderlineDots(attributes));
+}
+
 static int
 writeStatusCells (void) {
   if (braille->writeStatus) {
@@ -385,9 +390,13 @@ renderInfoLine (void) {
     STR_FORMAT(formatBrailleTime, &fmt);
 
     if (prefs.showSeconds) {
-      scheduleUpdateIn("info clock second", millisecondsTillNextSecond(&fmt.value));
+      schedulePriorityUpdate("info clock second",
+                             millisecondsTillNextSecond(&fmt.value),
+                             UPDATE_PRIORITY_BACKGROUND);
     } else {
-      scheduleUpdateIn("info clock minute", millisecondsTillNextMinute(&fmt.value));
+      schedulePriorityUpdate("info clock minute",
+                             millisecondsTillNextMinute(&fmt.value),
+                             UPDATE_PRIORITY_BACKGROUND);
     }
   }
 
@@ -815,79 +824,217 @@ readBrailleWindow (ScreenCharacter *characters, size_t count) {
   }
 }
 
+typedef struct {
+  wchar_t text;
+  unsigned char dots;
+  unsigned char underline;
+  unsigned char isUppercase;
+} BrailleWindowCell;
+
 typedef void ScreenCharacterTranslator (
-  const ScreenCharacter *character, unsigned char *cell, wchar_t *text
+  const ScreenCharacter *character, BrailleWindowCell *cell
 );
 
 static void
 translateScreenCharacterText (
-  const ScreenCharacter *character, unsigned char *cell, wchar_t *text
+  const ScreenCharacter *character, BrailleWindowCell *cell
 ) {
-  *cell = convertCharacterToDots(textTable, character->text);
-  *text = character->text;
+  unsigned char dots = convertCharacterToDots(textTable, character->text);
 
   {
-    const unsigned char dots = BRL_DOT_7 | BRL_DOT_8;
+    const unsigned char dots78 = BRL_DOT_7 | BRL_DOT_8;
 
-    if (*cell & dots) {
+    if (dots & dots78) {
       if (isSixDotComputerBraille()) {
-        *cell &= ~dots;
+        dots &= ~dots78;
       }
     }
   }
 
-  if (prefs.showAttributes) {
-    overlayAttributesUnderline(cell, character->attributes);
-  }
-
-  {
-    BlinkDescriptor *blink = &uppercaseLettersBlinkDescriptor;
-
-    if (isBlinkEnabled(blink)) {
-      if (iswupper(character->text)) {
-        requireBlinkDescriptor(blink);
-        if (!isBlinkVisible(blink)) *cell = 0;
-      }
-    }
-  }
+  cell->text = character->text;
+  cell->dots = dots;
+  cell->underline = prefs.showAttributes? getAttributesUnderlineDots(character->attributes): 0;
+  cell->isUppercase = !!iswupper(character->text);
 }
 
 static void
 translateScreenCharacterAttributes (
-  const ScreenCharacter *character, unsigned char *cell, wchar_t *text
+  const ScreenCharacter *character, BrailleWindowCell *cell
 ) {
-  *text = UNICODE_BRAILLE_ROW | (*cell = convertAttributesToDots(attributesTable, character->attributes));
+  cell->dots = convertAttributesToDots(attributesTable, character->attributes);
+  cell->text = UNICODE_BRAILLE_ROW | cell->dots;
+  cell->underline = 0;
+  cell->isUppercase = 0;
 }
 
 static void
 translateBrailleWindow (
-  const ScreenCharacter *characters, wchar_t *textBuffer
+  const ScreenCharacter *characters, BrailleWindowCell *cells, size_t count
 ) {
   ScreenCharacterTranslator *translateScreenCharacter =
     ses->displayMode?
     translateScreenCharacterAttributes:
     translateScreenCharacterText;
 
+  const ScreenCharacter *character = characters;
+  const ScreenCharacter *end = character + count;
+
+  while (character < end) {
+    translateScreenCharacter(character++, cells++);
+  }
+}
+
+typedef struct {
+  int column;
+  int row;
+  unsigned int textCount;
+  unsigned int textRows;
+  unsigned char displayMode;
+  const TextTable *textTable;
+  const AttributesTable *attributesTable;
+  PreferenceSettings preferences;
+} BrailleWindowCacheKey;
+
+typedef struct {
+  BrailleWindowCacheKey key;
+  ScreenCharacter *characters;
+  BrailleWindowCell *cells;
+  size_t size;
+  unsigned isValid:1;
+} BrailleWindowCache;
+
+static BrailleWindowCache brailleWindowCache;
+
+void
+resetBrailleWindowCache (void) {
+  brailleWindowCache.isValid = 0;
+}
+
+static void
+makeBrailleWindowCacheKey (BrailleWindowCacheKey *key) {
+  memset(key, 0, sizeof(*key));
+
+  key->column = ses->winx;
+  key->row = ses->winy;
+  key->textCount = textCount;
+  key->textRows = brl.textRows;
+  key->displayMode = ses->displayMode;
+  key->textTable = textTable;
+  key->attributesTable = attributesTable;
+  key->preferences = prefs;
+}
+
+static int
+prepareBrailleWindowCache (size_t count) {
+  BrailleWindowCache *cache = &brailleWindowCache;
+
+  if (count > cache->size) {
+    ScreenCharacter *characters = realloc(cache->characters, ARRAY_SIZE(characters, count));
+    if (!characters) goto error;
+    cache->characters = characters;
+
+    BrailleWindowCell *cells = realloc(cache->cells, ARRAY_SIZE(cells, count));
+    if (!cells) goto error;
+    cache->cells = cells;
+
+    cache->size = count;
+  }
+
+  return 1;
+
+error:
+  logMallocError();
+  cache->isValid = 0;
+  return 0;
+}
+
+static const BrailleWindowCell *
+getBrailleWindowCells (const ScreenCharacter *characters, size_t count, BrailleWindowCell *buffer) {
+  BrailleWindowCache *cache = &brailleWindowCache;
+
+  BrailleWindowCacheKey key;
+  makeBrailleWindowCacheKey(&key);
+
+  if (cache->isValid && (count <= cache->size)) {
+    if (memcmp(&key, &cache->key, sizeof(key)) == 0) {
+      if (memcmp(characters, cache->characters, ARRAY_SIZE(characters, count)) == 0) {
+        logMessage(LOG_CATEGORY(UPDATE_EVENTS), "braille window unchanged");
+        return cache->cells;
+      }
+    }
+  }
+
+  if (!prepareBrailleWindowCache(count)) {
+    translateBrailleWindow(characters, buffer, count);
+    return buffer;
+  }
+
+  translateBrailleWindow(characters, cache->cells, count);
+  memcpy(cache->characters, characters, ARRAY_SIZE(characters, count));
+  cache->key = key;
+  cache->isValid = 1;
+  return cache->cells;
+}
+
+static void
+renderBrailleWindow (
+  const ScreenCharacter *characters, wchar_t *textBuffer
+) {
+  size_t count = textCount * brl.textRows;
+  BrailleWindowCell buffer[count];
+  const BrailleWindowCell *cells = getBrailleWindowCells(characters, count, buffer);
+
+  BlinkDescriptor *uppercaseBlink = &uppercaseLettersBlinkDescriptor;
+  int uppercaseBlinkEnabled = isBlinkEnabled(uppercaseBlink);
+
   for (unsigned int row=0; row<brl.textRows; row+=1) {
-    const ScreenCharacter *character = &characters[row * textCount];
-    const ScreenCharacter *end = character + textCount;
+    const BrailleWindowCell *cell = &cells[row * textCount];
+    const BrailleWindowCell *end = cell + textCount;
 
     unsigned int start = (row * brl.textColumns) + textStart;
-    unsigned char *cell = &brl.buffer[start];
+    unsigned char *dots = &brl.buffer[start];
     wchar_t *text = &textBuffer[start];
 
-    while (character < end) {
-      translateScreenCharacter(character++, cell++, text++);
+    while (cell < end) {
+      *dots = cell->dots;
+      overlayUnderlineDots(dots, cell->underline);
+
+      if (cell->isUppercase && uppercaseBlinkEnabled) {
+        requireBlinkDescriptor(uppercaseBlink);
+        if (!isBlinkVisible(uppercaseBlink)) *dots = 0;
+      }
+
+      *text++ = cell->text;
+      dots += 1;
+      cell += 1;
     }
   }
 }
 
+static void
+anticipateContractedRow (int row, int outputLength) {
+  if ((row < 0) || (row >= scr.rows)) return;
+
+  int inputLength = scr.cols - ses->winx;
+  if (inputLength <= 0) return;
+
+  wchar_t inputText[inputLength];
+  readScreenText(ses->winx, row, inputLength, 1, inputText);
+
+  int cursor = ((row == scr.posy) && (scr.posx >= ses->winx) && !ses->hideScreenCursor)?
+               (scr.posx - ses->winx):
+               CTB_NO_CURSOR;
+
+  anticipateContraction(contractionTable, inputText, inputLength, outputLength, cursor);
+}
+
 static void
 doUpdate (void) {
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "starting");
   unrequireAllBlinkDescriptors();
   refreshScreen();
   updateSessionAttributes();
+  if (isMainScreen()) updateScreenHistory(&scr);
   api.flushOutput();
 
   if (scr.unreadable) {
@@ -1043,6 +1190,11 @@ doUpdate (void) {
             contractedOffsets, getContractedCursor()
           );
 
+          if (canAnticipateContraction(contractionTable)) {
+            anticipateContractedRow(ses->winy - 1, textLength);
+            anticipateContractedRow(ses->winy + 1, textLength);
+          }
+
           {
             int inputEnd = inputLength;
 
@@ -1132,7 +1284,7 @@ doUpdate (void) {
       if (!isContracted) {
         ScreenCharacter characters[textLength];
         readBrailleWindow(characters, ARRAY_COUNT(characters));
-        translateBrailleWindow(characters, textBuffer);
+        renderBrailleWindow(characters, textBuffer);
       }
 
       if ((brl.cursor = getScreenCursorPosition(scr.posx, scr.posy)) != BRL_NO_CURSOR) {
@@ -1184,6 +1336,16 @@ doUpdate (void) {
   }
 
   resetAllBlinkDescriptors();
+
+  {
+    ScreenSnapshotStatistics statistics;
+    getScreenSnapshotStatistics(&statistics);
+
+    logMessage(LOG_CATEGORY(UPDATE_EVENTS),
+               "screen rows: Generation:%lu Cached:%u Read:%u",
+               statistics.generation, statistics.hits, statistics.misses);
+  }
+
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "finished");
 }
 
@@ -1192,19 +1354,60 @@ static AsyncHandle updateAlarm;
 static int updateSuspendCount;
 
 static TimeValue updateTime;
-static TimeValue earliestTime;
+static UpdatePriority updatePriority;
+
+static TimeValue finishTime;
+static int transferTime;
+
+static const char *const updatePriorityNames[] = {
+  [UPDATE_PRIORITY_BACKGROUND] = "background",
+  [UPDATE_PRIORITY_NORMAL] = "normal",
+  [UPDATE_PRIORITY_FEEDBACK] = "feedback",
+};
+
+static void
+getEarliestTime (TimeValue *time) {
+  // never write again before the link has drained what was last written
+  int delay = transferTime + 1;
+
+  switch (updatePriority) {
+    case UPDATE_PRIORITY_FEEDBACK:
+      break;
+
+    case UPDATE_PRIORITY_NORMAL:
+      if (delay < UPDATE_SCHEDULE_DELAY) delay = UPDATE_SCHEDULE_DELAY;
+      break;
+
+    default:
+    case UPDATE_PRIORITY_BACKGROUND:
+      if (delay < UPDATE_SCHEDULE_DELAY) {
+        delay = UPDATE_SCHEDULE_DELAY;
+      } else {
+        // on a slow link, merge background changes into fewer frames
+        // so that the link is free sooner for feedback
+        delay += MIN(transferTime, UPDATE_BACKGROUND_DELAY_LIMIT);
+      }
+      break;
+  }
+
+  *time = finishTime;
+  adjustTimeValue(time, delay);
+}
 
 static void
 enforceEarliestTime (void) {
+  TimeValue earliestTime;
+  getEarliestTime(&earliestTime);
+
   if (compareTimeValues(&updateTime, &earliestTime) < 0) {
     updateTime = earliestTime;
   }
 }
 
 static void
-setUpdateDelay (int delay) {
-  getMonotonicTime(&earliestTime);
-  adjustTimeValue(&earliestTime, delay);
+setTransferTime (int milliseconds) {
+  getMonotonicTime(&finishTime);
+  transferTime = milliseconds;
   enforceEarliestTime();
 }
 
@@ -1227,10 +1430,20 @@ setUpdateTime (int delay, const TimeValue *from, int ifEarlier) {
 }
 
 void
-scheduleUpdateIn (const char *reason, int delay) {
+schedulePriorityUpdate (const char *reason, int delay, UpdatePriority priority) {
+  if (priority > updatePriority) updatePriority = priority;
   setUpdateTime(delay, NULL, 1);
   if (updateAlarm) asyncResetAlarmTo(updateAlarm, &updateTime);
-  logMessage(LOG_CATEGORY(UPDATE_EVENTS), "scheduled: %s", reason);
+
+  logMessage(LOG_CATEGORY(UPDATE_EVENTS),
+             "scheduled: %s: Priority:%s Due:%ld",
+             reason, updatePriorityNames[priority],
+             -getMonotonicElapsed(&updateTime));
+}
+
+void
+scheduleUpdateIn (const char *reason, int delay) {
+  schedulePriorityUpdate(reason, delay, UPDATE_PRIORITY_NORMAL);
 }
 
 void
@@ -1243,6 +1456,10 @@ ASYNC_ALARM_CALLBACK(handleUpdateAlarm) {
   updateAlarm = NULL;
 
   suspendUpdates();
+  logMessage(LOG_CATEGORY(UPDATE_EVENTS),
+             "starting: Priority:%s", updatePriorityNames[updatePriority]);
+
+  updatePriority = UPDATE_PRIORITY_BACKGROUND;
   setUpdateTime((pollScreen()? SCREEN_UPDATE_POLL_INTERVAL: (SECS_PER_DAY * MSECS_PER_SEC)),
                 parameters->now, 0);
 
@@ -1257,8 +1474,16 @@ ASYNC_ALARM_CALLBACK(handleUpdateAlarm) {
     }
   }
 
-  setUpdateDelay(MAX((brl.writeDelay + 1), UPDATE_SCHEDULE_DELAY));
-  brl.writeDelay = 0;
+  {
+    int transferTime = brl.writeDelay;
+    brl.writeDelay = 0;
+
+    if (transferTime) {
+      logMessage(LOG_CATEGORY(UPDATE_EVENTS), "transfer time: %d", transferTime);
+    }
+
+    setTransferTime(transferTime);
+  }
 
   resumeUpdates(0);
 }
@@ -1280,7 +1505,8 @@ void
 beginUpdates (void) {
   logMessage(LOG_CATEGORY(UPDATE_EVENTS), "begin");
 
-  setUpdateDelay(0);
+  updatePriority = UPDATE_PRIORITY_FEEDBACK;
+  setTransferTime(0);
   setUpdateTime(0, NULL, 0);
 
   updateAlarm = NULL;
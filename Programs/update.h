@@ -26,10 +26,18 @@ extern "C" {
 #endif /* __cplusplus */
 
 extern int writeBrailleWindow (BrailleDisplay *brl, const wchar_t *text, unsigned char quality);
+extern void resetBrailleWindowCache (void);
 extern void reportBrailleWindowMoved (void);
 
+typedef enum {
+  UPDATE_PRIORITY_BACKGROUND,
+  UPDATE_PRIORITY_NORMAL,
+  UPDATE_PRIORITY_FEEDBACK
+} UpdatePriority;
+
 extern void scheduleUpdate (const char *reason);
 extern void scheduleUpdateIn (const char *reason, int delay);
+extern void schedulePriorityUpdate (const char *reason, int delay, UpdatePriority priority);
 
 extern void beginUpdates (void);
 extern void suspendUpdates (void);